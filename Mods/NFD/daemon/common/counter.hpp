@@ -28,6 +28,8 @@
 
 #include "core/common.hpp"
 
+#include <atomic>
+
 namespace nfd {
 
 /**
@@ -35,6 +37,9 @@ namespace nfd {
  *
  * SimpleCounter is noncopyable, because increment should be called on the counter,
  * not a copy of it; it's implicitly convertible to an integral type to be observed.
+ *
+ * A counter must only be modified by one thread, but it can be observed from any thread,
+ * e.g., the counters of a face that runs in an IoThread are read by the management thread.
  */
 class SimpleCounter : noncopyable
 {
@@ -46,7 +51,7 @@ public:
    */
   operator rep() const noexcept
   {
-    return m_value;
+    return m_value.load(std::memory_order_relaxed);
   }
 
   /**
@@ -55,11 +60,19 @@ public:
   void
   set(rep value) noexcept
   {
-    m_value = value;
+    m_value.store(value, std::memory_order_relaxed);
   }
 
 protected:
-  rep m_value = 0;
+  // with a single writer, a relaxed load and store is enough and avoids a locked instruction
+  void
+  add(rep n) noexcept
+  {
+    m_value.store(m_value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<rep> m_value{0};
 };
 
 /** \brief Represents a counter of number of packets.
@@ -74,7 +87,7 @@ public:
   PacketCounter&
   operator++() noexcept
   {
-    ++m_value;
+    add(1);
     return *this;
   }
   // postfix ++ operator is not provided because it's not needed
@@ -92,7 +105,7 @@ public:
   ByteCounter&
   operator+=(rep n) noexcept
   {
-    m_value += n;
+    add(n);
     return *this;
   }
 };
@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022  Regents of the University of California,
+ *                          Arizona Board of Regents,
+ *                          Colorado State University,
+ *                          University Pierre & Marie Curie, Sorbonne University,
+ *                          Washington University in St. Louis,
+ *                          Beijing Institute of Technology
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "common/io-thread.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <future>
+
+namespace nfd {
+
+NFD_LOG_INIT(IoThread);
+
+IoThread::IoThread()
+  : m_parentIo(getGlobalIoService())
+{
+  std::promise<void> isReady;
+  m_thread = std::thread([this, &isReady] {
+    m_ioService = &getGlobalIoService();
+    getScheduler();
+    m_work = make_unique<boost::asio::io_service::work>(*m_ioService);
+    isReady.set_value();
+
+    try {
+      m_ioService->run();
+    }
+    catch (const std::exception& e) {
+      NFD_LOG_FATAL(boost::diagnostic_information(e));
+      // let the parent thread fail as well, as it would if the I/O ran there
+      m_parentIo.post([ep = std::current_exception()] { std::rethrow_exception(ep); });
+    }
+  });
+  isReady.get_future().wait();
+}
+
+IoThread::~IoThread()
+{
+  BOOST_ASSERT(!isCurrentThread());
+  m_ioService->post([this] { m_work.reset(); });
+  m_thread.join();
+}
+
+void
+IoThread::runAndWait(const std::function<void()>& f)
+{
+  if (isCurrentThread()) {
+    f();
+    return;
+  }
+
+  std::promise<void> done;
+  m_ioService->post([&] {
+    try {
+      f();
+      done.set_value();
+    }
+    catch (...) {
+      done.set_exception(std::current_exception());
+    }
+  });
+  done.get_future().get();
+}
+
+} // namespace nfd
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022  Regents of the University of California,
+ *                          Arizona Board of Regents,
+ *                          Colorado State University,
+ *                          University Pierre & Marie Curie, Sorbonne University,
+ *                          Washington University in St. Louis,
+ *                          Beijing Institute of Technology
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#ifndef NFD_DAEMON_COMMON_IO_THREAD_HPP
+#define NFD_DAEMON_COMMON_IO_THREAD_HPP
+
+#include "core/common.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#include <thread>
+
+namespace nfd {
+
+/** \brief A thread that runs its own global io_service and Scheduler.
+ *
+ *  An IoThread is used to take face I/O off the thread that created it, which is referred to
+ *  as the parent thread. Code running in the IoThread sees the IoThread's io_service and
+ *  Scheduler through getGlobalIoService() and getScheduler(), so objects constructed in the
+ *  IoThread are bound to it. Work can be handed back to the parent thread with postToParent().
+ */
+class IoThread : noncopyable
+{
+public:
+  /** \brief Start the thread and wait until its io_service is ready.
+   *
+   *  The calling thread becomes the parent thread.
+   */
+  IoThread();
+
+  /** \brief Let the io_service run out of work, then join the thread.
+   *
+   *  Handlers already posted to the thread are invoked before it exits.
+   *  \pre Not called from this IoThread.
+   */
+  ~IoThread();
+
+  /** \brief Returns the io_service that runs in this thread.
+   */
+  boost::asio::io_service&
+  getIoService() const noexcept
+  {
+    return *m_ioService;
+  }
+
+  /** \brief Returns the io_service of the parent thread.
+   */
+  boost::asio::io_service&
+  getParentIoService() const noexcept
+  {
+    return m_parentIo;
+  }
+
+  /** \brief Whether the calling thread is this IoThread.
+   */
+  bool
+  isCurrentThread() const noexcept
+  {
+    return std::this_thread::get_id() == m_thread.get_id();
+  }
+
+  /** \brief Invoke \p f in this IoThread.
+   */
+  template<typename F>
+  void
+  post(F&& f)
+  {
+    m_ioService->post(std::forward<F>(f));
+  }
+
+  /** \brief Invoke \p f in the parent thread.
+   */
+  template<typename F>
+  void
+  postToParent(F&& f)
+  {
+    m_parentIo.post(std::forward<F>(f));
+  }
+
+  /** \brief Invoke \p f in this IoThread and wait for it to return.
+   *
+   *  If called from this IoThread, \p f is invoked immediately. Otherwise, \p f is queued
+   *  after all previously posted handlers. An exception thrown by \p f is rethrown here.
+   */
+  void
+  runAndWait(const std::function<void()>& f);
+
+private:
+  boost::asio::io_service& m_parentIo;
+  boost::asio::io_service* m_ioService = nullptr;
+  std::unique_ptr<boost::asio::io_service::work> m_work;
+  std::thread m_thread;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_IO_THREAD_HPP
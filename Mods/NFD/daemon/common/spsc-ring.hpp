@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_SPSC_RING_HPP
+#define NFD_DAEMON_COMMON_SPSC_RING_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/scope.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+namespace nfd {
+
+/** \brief A bounded lock-free queue with a single producer thread and a single consumer thread.
+ *
+ *  tryPush() must only be called by the producer, and consume() and empty() must only be
+ *  called by the consumer. Each side keeps a cached copy of the other side's index, so that
+ *  the shared cache line is only read when the cached copy indicates a full or empty ring.
+ */
+template<typename T>
+class SpscRing : noncopyable
+{
+public:
+  /** \brief Create a ring that can hold at least \p capacity items.
+   *
+   *  The capacity is rounded up to a power of two.
+   */
+  explicit
+  SpscRing(size_t capacity)
+    : m_capacity(roundUpToPowerOfTwo(std::max<size_t>(capacity, 2)))
+    , m_mask(m_capacity - 1)
+    , m_slots(new Slot[m_capacity])
+  {
+  }
+
+  ~SpscRing()
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+      at(head).~T();
+    }
+  }
+
+  size_t
+  capacity() const noexcept
+  {
+    return m_capacity;
+  }
+
+  /** \brief Append an item at the producer side.
+   *  \return true if \p item has been moved into the ring, false if the ring is full,
+   *          in which case \p item is left untouched
+   */
+  bool
+  tryPush(T&& item)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cachedHead == m_capacity) {
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead == m_capacity) {
+        return false;
+      }
+    }
+
+    new (&m_slots[tail & m_mask]) T(std::move(item));
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** \brief Remove up to \p maxItems items at the consumer side, and pass each of them to \p f.
+   *  \return number of items removed
+   */
+  template<typename F>
+  size_t
+  consume(F&& f, size_t maxItems = std::numeric_limits<size_t>::max())
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t n = 0;
+    for (; n < maxItems; ++n, ++head) {
+      if (head == m_cachedTail) {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail) {
+          break;
+        }
+      }
+
+      T& item = at(head);
+      // release the slot even if f throws
+      auto release = ndn::make_scope_exit([&] {
+        item.~T();
+        m_head.store(head + 1, std::memory_order_release);
+      });
+      f(std::move(item));
+    }
+    return n;
+  }
+
+  /** \brief Whether the ring is empty, as seen by the consumer.
+   */
+  bool
+  empty() const noexcept
+  {
+    return m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_acquire);
+  }
+
+private:
+  static size_t
+  roundUpToPowerOfTwo(size_t n) noexcept
+  {
+    size_t p = 1;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  T&
+  at(size_t index) noexcept
+  {
+    return *std::launder(reinterpret_cast<T*>(&m_slots[index & m_mask]));
+  }
+
+private:
+  using Slot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  const size_t m_capacity;
+  const size_t m_mask;
+  std::unique_ptr<Slot[]> m_slots;
+
+  /// index of the next item to be consumed, written by the consumer
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0};
+  /// consumer's copy of m_tail
+  size_t m_cachedTail = 0;
+
+  /// index of the next slot to be filled, written by the producer
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0};
+  /// producer's copy of m_head
+  size_t m_cachedHead = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_SPSC_RING_HPP
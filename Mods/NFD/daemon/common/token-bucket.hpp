@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_TOKEN_BUCKET_HPP
+#define NFD_DAEMON_COMMON_TOKEN_BUCKET_HPP
+
+#include "core/common.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+
+/** \brief A token bucket that is refilled at a constant rate, up to a maximum number of tokens.
+ *
+ *  The bucket is refilled lazily, from the time points passed to its methods, which must
+ *  not decrease. A new bucket is full.
+ */
+class TokenBucket
+{
+public:
+  /** \param rate number of tokens added per second, must be positive
+   *  \param burst maximum number of tokens, must be at least one
+   *  \param now time of creation
+   */
+  TokenBucket(double rate, double burst, time::steady_clock::time_point now)
+    : m_rate(rate)
+    , m_burst(burst)
+    , m_tokens(burst)
+    , m_lastRefill(now)
+  {
+    BOOST_ASSERT(rate > 0);
+    BOOST_ASSERT(burst >= 1);
+  }
+
+  double
+  getRate() const noexcept
+  {
+    return m_rate;
+  }
+
+  double
+  getBurst() const noexcept
+  {
+    return m_burst;
+  }
+
+  /** \brief Returns the number of tokens available at \p now.
+   */
+  double
+  getTokens(time::steady_clock::time_point now) noexcept
+  {
+    refill(now);
+    return m_tokens;
+  }
+
+  /** \brief Returns whether a token is available at \p now, without taking it.
+   */
+  bool
+  hasToken(time::steady_clock::time_point now) noexcept
+  {
+    return getTokens(now) >= 1;
+  }
+
+  /** \brief Take a token if one is available at \p now.
+   *  \return whether a token was taken
+   */
+  bool
+  tryConsume(time::steady_clock::time_point now) noexcept
+  {
+    if (!hasToken(now)) {
+      return false;
+    }
+    m_tokens -= 1;
+    return true;
+  }
+
+  /** \brief Returns how long after \p now a token becomes available.
+   */
+  time::nanoseconds
+  getTimeUntilToken(time::steady_clock::time_point now) noexcept
+  {
+    double missing = 1 - getTokens(now);
+    if (missing <= 0) {
+      return 0_ns;
+    }
+    return time::nanoseconds(static_cast<time::nanoseconds::rep>(missing / m_rate * 1e9) + 1);
+  }
+
+private:
+  void
+  refill(time::steady_clock::time_point now) noexcept
+  {
+    if (now > m_lastRefill) {
+      double elapsed = time::duration_cast<time::nanoseconds>(now - m_lastRefill).count() / 1e9;
+      m_tokens = std::min(m_burst, m_tokens + elapsed * m_rate);
+      m_lastRefill = now;
+    }
+  }
+
+private:
+  double m_rate;
+  double m_burst;
+  double m_tokens;
+  time::steady_clock::time_point m_lastRefill;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_TOKEN_BUCKET_HPP
@@ -28,6 +28,7 @@
 
 #include "channel.hpp"
 #include "ethernet-protocol.hpp"
+#include "ethernet-transport.hpp"
 #include "pcap-helper.hpp"
 
 #include <boost/asio/posix/stream_descriptor.hpp>
@@ -55,9 +56,13 @@ public:
    *
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call EthernetChannel::listen method.
+   *
+   * \param ioMode I/O mode of the unicast transports created by this channel; the channel's
+   *               own listener, which only sees the first frame from each peer, always uses libpcap
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  EthernetIoMode ioMode = EthernetIoMode::PCAP);
 
   bool
   isListening() const final
@@ -126,6 +131,7 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const EthernetIoMode m_ioMode;
 
 #ifdef _DEBUG
   /// number of frames dropped by the kernel, as reported by libpcap
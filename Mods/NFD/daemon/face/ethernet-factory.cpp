@@ -62,6 +62,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   //   mcast yes
   //   mcast_group 01:00:5E:00:17:AA
   //   mcast_ad_hoc no
+  //   packet_ring no
   //   whitelist
   //   {
   //     *
@@ -107,6 +108,17 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
         bool wantAdHoc = ConfigFile::parseYesNo(pair, "face_system.ether");
         mcastConfig.linkType = wantAdHoc ? ndn::nfd::LINK_TYPE_AD_HOC : ndn::nfd::LINK_TYPE_MULTI_ACCESS;
       }
+      else if (key == "packet_ring") {
+        bool wantPacketRing = ConfigFile::parseYesNo(pair, "face_system.ether");
+#ifndef NFD_HAVE_ETHERNET_PACKET_RING
+        if (wantPacketRing) {
+          NDN_THROW(ConfigFile::Error("face_system.ether.packet_ring: packet ring I/O is not "
+                                      "supported on this platform"));
+        }
+#endif
+        unicastConfig.ioMode = mcastConfig.ioMode = wantPacketRing ? EthernetIoMode::PACKET_RING
+                                                                   : EthernetIoMode::PCAP;
+      }
       else if (key == "whitelist") {
         mcastConfig.netifPredicate.parseWhitelist(value);
       }
@@ -130,6 +142,9 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     if (m_unicastConfig.idleTimeout != unicastConfig.idleTimeout && !m_channels.empty()) {
       NFD_LOG_WARN("Idle timeout setting applies to new Ethernet channels only");
     }
+    if (m_unicastConfig.ioMode != unicastConfig.ioMode && !m_channels.empty()) {
+      NFD_LOG_WARN("Packet ring setting applies to new Ethernet channels only");
+    }
   }
   else if (m_unicastConfig.isEnabled && !m_channels.empty()) {
     NFD_LOG_WARN("Cannot disable Ethernet channels after initialization");
@@ -147,6 +162,9 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     if (m_mcastConfig.linkType != mcastConfig.linkType && !m_mcastFaces.empty()) {
       NFD_LOG_WARN("Cannot change ad hoc setting on existing faces");
     }
+    if (m_mcastConfig.ioMode != mcastConfig.ioMode && !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("Cannot change packet ring setting on existing faces");
+    }
     if (m_mcastConfig.group != mcastConfig.group) {
       NFD_LOG_INFO("changing multicast group from " << m_mcastConfig.group <<
                    " to " << mcastConfig.group);
@@ -216,13 +234,14 @@ EthernetFactory::doCreateFace(const CreateFaceRequest& req,
 
 shared_ptr<EthernetChannel>
 EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                               time::nanoseconds idleTimeout)
+                               time::nanoseconds idleTimeout,
+                               EthernetIoMode ioMode)
 {
   auto it = m_channels.find(localEndpoint->getName());
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout, ioMode);
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -250,7 +269,8 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   opts.allowReassembly = true;
 
   auto linkService = make_unique<GenericLinkService>(opts);
-  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
+  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType,
+                                                         m_mcastConfig.ioMode);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[key] = face;
@@ -284,7 +304,7 @@ EthernetFactory::applyUnicastConfigToNetif(const shared_ptr<const ndn::net::Netw
     return nullptr;
   }
 
-  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout);
+  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout, m_unicastConfig.ioMode);
   if (m_unicastConfig.wantListen && !channel->isListening()) {
     try {
       channel->listen(this->addFace, nullptr);
@@ -54,7 +54,8 @@ public:
    */
   shared_ptr<EthernetChannel>
   createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                time::nanoseconds idleTimeout);
+                time::nanoseconds idleTimeout,
+                EthernetIoMode ioMode = EthernetIoMode::PCAP);
 
   /**
    * \brief Create a face to communicate on the given Ethernet multicast group.
@@ -107,6 +108,7 @@ private:
     bool isEnabled = false;
     bool wantListen = false;
     time::nanoseconds idleTimeout = 10_min;
+    EthernetIoMode ioMode = EthernetIoMode::PCAP;
   };
   UnicastConfig m_unicastConfig;
 
@@ -115,6 +117,7 @@ private:
     bool isEnabled = false;
     ethernet::Address group = ethernet::getDefaultMulticastAddress();
     ndn::nfd::LinkType linkType = ndn::nfd::LINK_TYPE_MULTI_ACCESS;
+    EthernetIoMode ioMode = EthernetIoMode::PCAP;
     NetworkInterfacePredicate netifPredicate;
   };
   MulticastConfig m_mcastConfig;
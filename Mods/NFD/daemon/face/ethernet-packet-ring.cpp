@@ -0,0 +1,268 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethernet-packet-ring.hpp"
+
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+
+#include "common/privilege-helper.hpp"
+
+#include <boost/endian/conversion.hpp>
+#include <pcap/pcap.h>
+
+#include <cerrno>
+#include <cstring>
+#include <linux/filter.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if !defined(PCAP_NETMASK_UNKNOWN)
+#define PCAP_NETMASK_UNKNOWN  0xffffffff
+#endif
+
+namespace nfd::face {
+
+// offset of the frame within a TX slot, see Documentation/networking/packet_mmap.rst
+constexpr size_t TX_DATA_OFFSET = TPACKET3_HDRLEN - sizeof(sockaddr_ll);
+
+// frame slot size announced for the RX ring; TPACKET_V3 packs frames of variable size
+// into each block, so this value only needs to divide the block size evenly
+constexpr uint32_t RX_NOMINAL_FRAME_SIZE = TPACKET_ALIGNMENT << 7;
+
+static std::string
+errnoString(const char* what)
+{
+  return std::string(what) + ": " + std::strerror(errno);
+}
+
+EthernetPacketRing::EthernetPacketRing(int interfaceIndex, const Options& options)
+  : m_options(options)
+  , m_interfaceIndex(interfaceIndex)
+{
+  if (m_options.rxBlockSize % RX_NOMINAL_FRAME_SIZE != 0 || m_options.rxBlockCount == 0)
+    NDN_THROW(Error("Invalid RX ring geometry"));
+  if (m_options.txFrameSize < TX_DATA_OFFSET + ethernet::HDR_LEN + ethernet::MIN_DATA_LEN ||
+      m_options.txFrameCount == 0)
+    NDN_THROW(Error("Invalid TX ring geometry"));
+
+  // the socket is not bound to any protocol yet, so it does not receive anything
+  // until the rings are in place and activate() binds it to the NDN ethertype
+  PrivilegeHelper::runElevated([this] {
+    m_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+  });
+  if (m_fd < 0)
+    NDN_THROW(Error(errnoString("socket")));
+}
+
+EthernetPacketRing::~EthernetPacketRing() noexcept
+{
+  close();
+}
+
+void
+EthernetPacketRing::activate()
+{
+  int version = TPACKET_V3;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_VERSION)")));
+
+  // skip malformed TX frames instead of stalling the whole TX ring
+  int loss = 1;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_LOSS, &loss, sizeof(loss)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_LOSS)")));
+
+  tpacket_req3 rxReq{};
+  rxReq.tp_block_size = m_options.rxBlockSize;
+  rxReq.tp_block_nr = m_options.rxBlockCount;
+  rxReq.tp_frame_size = RX_NOMINAL_FRAME_SIZE;
+  rxReq.tp_frame_nr = m_options.rxBlockSize / RX_NOMINAL_FRAME_SIZE * m_options.rxBlockCount;
+  rxReq.tp_retire_blk_tov = m_options.retireTimeout;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_RX_RING, &rxReq, sizeof(rxReq)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_RX_RING)")));
+
+  // one frame per block, so that TX slot i is simply at offset i * txFrameSize
+  tpacket_req3 txReq{};
+  txReq.tp_block_size = m_options.txFrameSize;
+  txReq.tp_block_nr = m_options.txFrameCount;
+  txReq.tp_frame_size = m_options.txFrameSize;
+  txReq.tp_frame_nr = m_options.txFrameCount;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_TX_RING, &txReq, sizeof(txReq)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_TX_RING)")));
+
+  size_t rxSize = size_t{m_options.rxBlockSize} * m_options.rxBlockCount;
+  size_t txSize = size_t{m_options.txFrameSize} * m_options.txFrameCount;
+  void* map = ::mmap(nullptr, rxSize + txSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED)
+    NDN_THROW(Error(errnoString("mmap")));
+
+  m_map = static_cast<uint8_t*>(map);
+  m_mapSize = rxSize + txSize;
+  m_rxRing = m_map;
+  m_txRing = m_map + rxSize;
+
+  sockaddr_ll addr{};
+  addr.sll_family = AF_PACKET;
+  addr.sll_protocol = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  addr.sll_ifindex = m_interfaceIndex;
+  if (::bind(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    NDN_THROW(Error(errnoString("bind")));
+}
+
+void
+EthernetPacketRing::close() noexcept
+{
+  if (m_map != nullptr) {
+    ::munmap(m_map, m_mapSize);
+    m_map = m_rxRing = m_txRing = nullptr;
+    m_mapSize = 0;
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+}
+
+int
+EthernetPacketRing::getFd() const
+{
+  int fd = ::dup(m_fd);
+  if (fd < 0)
+    NDN_THROW(Error(errnoString("dup")));
+  return fd;
+}
+
+void
+EthernetPacketRing::setPacketFilter(const char* filter) const
+{
+  // libpcap is used only as a BPF compiler here
+  unique_ptr<pcap_t, decltype(&pcap_close)> dead(
+    pcap_open_dead(DLT_EN10MB, ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE), &pcap_close);
+  if (dead == nullptr)
+    NDN_THROW(Error("pcap_open_dead failed"));
+
+  bpf_program prog;
+  if (pcap_compile(dead.get(), &prog, filter, 1, PCAP_NETMASK_UNKNOWN) < 0)
+    NDN_THROW(Error("pcap_compile: " + std::string(pcap_geterr(dead.get()))));
+
+  sock_fprog fprog{};
+  fprog.len = static_cast<unsigned short>(prog.bf_len);
+  fprog.filter = reinterpret_cast<sock_filter*>(prog.bf_insns);
+  int ret = ::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog));
+  pcap_freecode(&prog);
+  if (ret < 0)
+    NDN_THROW(Error(errnoString("setsockopt(SO_ATTACH_FILTER)")));
+}
+
+size_t
+EthernetPacketRing::receiveBatch(const std::function<void(span<const uint8_t>)>& onFrame)
+{
+  size_t nFrames = 0;
+  for (size_t nBlocks = 0; m_rxRing != nullptr && nBlocks < m_options.rxBlockCount; ++nBlocks) {
+    auto* block = reinterpret_cast<tpacket_block_desc*>(m_rxRing + m_rxBlockIndex * m_options.rxBlockSize);
+    if ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0)
+      break;
+
+    auto* frame = reinterpret_cast<uint8_t*>(block) + block->hdr.bh1.offset_to_first_pkt;
+    for (uint32_t i = 0; i < block->hdr.bh1.num_pkts; ++i) {
+      const auto* hdr = reinterpret_cast<const tpacket3_hdr*>(frame);
+      const auto* sll = reinterpret_cast<const sockaddr_ll*>(frame + TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+      // same as PCAP_D_IN and "not vlan" on the pcap path
+      if (sll->sll_pkttype != PACKET_OUTGOING && (hdr->tp_status & TP_STATUS_VLAN_VALID) == 0) {
+        onFrame({frame + hdr->tp_mac, hdr->tp_snaplen});
+        ++nFrames;
+      }
+      frame += hdr->tp_next_offset;
+    }
+
+    __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+    m_rxBlockIndex = (m_rxBlockIndex + 1) % m_options.rxBlockCount;
+  }
+  return nFrames;
+}
+
+bool
+EthernetPacketRing::enqueue(const ethernet::Address& dst, const ethernet::Address& src,
+                            span<const uint8_t> payload)
+{
+  size_t dataLen = std::max<size_t>(payload.size(), ethernet::MIN_DATA_LEN);
+  if (m_txRing == nullptr || TX_DATA_OFFSET + ethernet::HDR_LEN + dataLen > m_options.txFrameSize)
+    return false;
+
+  auto* slot = m_txRing + m_txFrameIndex * m_options.txFrameSize;
+  auto* hdr = reinterpret_cast<tpacket3_hdr*>(slot);
+  if (__atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE) != TP_STATUS_AVAILABLE) {
+    // ring is full, give the kernel a chance to drain it
+    flush();
+    if (__atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE) != TP_STATUS_AVAILABLE)
+      return false;
+  }
+
+  uint8_t* pos = slot + TX_DATA_OFFSET;
+  pos = std::copy(dst.begin(), dst.end(), pos);
+  pos = std::copy(src.begin(), src.end(), pos);
+  uint16_t ethertype = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  std::memcpy(pos, &ethertype, ethernet::TYPE_LEN);
+  pos += ethernet::TYPE_LEN;
+  pos = std::copy(payload.begin(), payload.end(), pos);
+  std::fill_n(pos, dataLen - payload.size(), 0);
+
+  hdr->tp_len = ethernet::HDR_LEN + dataLen;
+  hdr->tp_next_offset = 0;
+  __atomic_store_n(&hdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+  m_txFrameIndex = (m_txFrameIndex + 1) % m_options.txFrameCount;
+  ++m_nPendingFrames;
+  return true;
+}
+
+bool
+EthernetPacketRing::flush() noexcept
+{
+  if (m_nPendingFrames == 0)
+    return true;
+
+  m_nPendingFrames = 0;
+  return ::send(m_fd, nullptr, 0, MSG_DONTWAIT) >= 0 || errno == EAGAIN || errno == ENOBUFS;
+}
+
+size_t
+EthernetPacketRing::getNDropped()
+{
+  // the kernel resets the counters on every read
+  tpacket_stats_v3 stats{};
+  socklen_t len = sizeof(stats);
+  if (::getsockopt(m_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &len) < 0)
+    NDN_THROW(Error(errnoString("getsockopt(PACKET_STATISTICS)")));
+
+  m_nDropped += stats.tp_drops;
+  return m_nDropped;
+}
+
+} // namespace nfd::face
+
+#endif // NFD_HAVE_ETHERNET_PACKET_RING
@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+#define NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+
+#include "ethernet-protocol.hpp"
+
+#ifndef NFD_HAVE_LIBPCAP
+#error "Cannot include this file when libpcap is not available"
+#endif
+
+#ifdef __linux__
+#define NFD_HAVE_ETHERNET_PACKET_RING 1
+#endif
+
+namespace nfd::face {
+
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+
+/**
+ * @brief Memory-mapped AF_PACKET socket with a TPACKET_V3 RX ring and a TX ring.
+ *
+ * Compared to PcapHelper, which runs libpcap in immediate mode and therefore reads one
+ * frame per system call, the RX ring lets the kernel fill whole blocks of frames that are
+ * then consumed in a batch without any copy, and the TX ring lets the caller build frames
+ * directly in kernel-shared memory and transmit several of them with a single send(2).
+ *
+ * Received blocks are retired by the kernel either when they are full or when
+ * Options::retireTimeout expires, which bounds the latency added by batching.
+ */
+class EthernetPacketRing : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  struct Options
+  {
+    /// size of each RX block, must be a multiple of the page size
+    uint32_t rxBlockSize = 1 << 18;
+    /// number of RX blocks
+    uint32_t rxBlockCount = 16;
+    /// time after which a partially filled RX block is handed to userspace, in milliseconds
+    uint32_t retireTimeout = 1;
+    /// size of each TX frame slot, must be large enough for the largest frame
+    uint32_t txFrameSize = 1 << 14;
+    /// number of TX frame slots
+    uint32_t txFrameCount = 256;
+  };
+
+  /**
+   * @brief Open an AF_PACKET socket bound to the NDN ethertype on the given network interface.
+   * @throw Error on any error
+   */
+  EthernetPacketRing(int interfaceIndex, const Options& options);
+
+  ~EthernetPacketRing() noexcept;
+
+  /**
+   * @brief Set up and map the RX and TX rings, then bind the socket to the interface.
+   * @throw Error on any error
+   */
+  void
+  activate();
+
+  /**
+   * @brief Unmap the rings and close the socket.
+   */
+  void
+  close() noexcept;
+
+  /**
+   * @brief Obtain a file descriptor that becomes readable when an RX block is retired.
+   * @pre activate() has been called.
+   * @return A selectable file descriptor. It is the caller's responsibility to close the fd.
+   * @throw Error on any error
+   */
+  int
+  getFd() const;
+
+  /**
+   * @brief Install a BPF filter on the socket.
+   * @param filter Null-terminated string containing the BPF program source, see pcap-filter(7).
+   * @throw Error on any error
+   */
+  void
+  setPacketFilter(const char* filter) const;
+
+  /**
+   * @brief Invoke @p onFrame on every frame in every block that has been handed to userspace,
+   *        then return those blocks to the kernel.
+   * @warning Each span is valid only during the invocation of @p onFrame.
+   * @return number of frames processed
+   */
+  size_t
+  receiveBatch(const std::function<void(span<const uint8_t>)>& onFrame);
+
+  /**
+   * @brief Build an Ethernet frame directly in the next free TX slot.
+   *
+   * The frame is only queued; it is transmitted by the next call to flush().
+   * Frames shorter than the Ethernet minimum are padded with zeroes.
+   *
+   * @return true if the frame was queued, false if the TX ring is full
+   */
+  bool
+  enqueue(const ethernet::Address& dst, const ethernet::Address& src, span<const uint8_t> payload);
+
+  /**
+   * @brief Ask the kernel to transmit all queued frames.
+   * @return false if the kernel reported an error, which can be obtained from errno
+   */
+  bool
+  flush() noexcept;
+
+  /**
+   * @brief Whether there are frames that have been queued but not yet flushed.
+   */
+  bool
+  hasPendingFrames() const noexcept
+  {
+    return m_nPendingFrames > 0;
+  }
+
+  /**
+   * @brief Get the number of frames dropped by the kernel since the ring was activated.
+   * @throw Error on any error
+   */
+  size_t
+  getNDropped();
+
+private:
+  const Options m_options;
+  const int m_interfaceIndex;
+  int m_fd = -1;
+  uint8_t* m_map = nullptr;
+  size_t m_mapSize = 0;
+
+  uint8_t* m_rxRing = nullptr;
+  size_t m_rxBlockIndex = 0;
+
+  uint8_t* m_txRing = nullptr;
+  size_t m_txFrameIndex = 0;
+  size_t m_nPendingFrames = 0;
+
+  size_t m_nDropped = 0;
+};
+
+#endif // NFD_HAVE_ETHERNET_PACKET_RING
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
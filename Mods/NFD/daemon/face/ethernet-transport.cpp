@@ -31,12 +31,28 @@
 
 #include <boost/endian/conversion.hpp>
 
+#include <cerrno>   // for errno
+#include <cstring>  // for strerror()
+
 namespace nfd::face {
 
 NFD_LOG_INIT(EthernetTransport);
 
+std::ostream&
+operator<<(std::ostream& os, EthernetIoMode mode)
+{
+  switch (mode) {
+    case EthernetIoMode::PCAP:
+      return os << "pcap";
+    case EthernetIoMode::PACKET_RING:
+      return os << "packet-ring";
+  }
+  return os << "none";
+}
+
 EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                                     const ethernet::Address& remoteEndpoint)
+                                     const ethernet::Address& remoteEndpoint,
+                                     EthernetIoMode ioMode)
   : m_socket(getGlobalIoService())
   , m_pcap(localEndpoint.getName())
   , m_srcAddress(localEndpoint.getEthernetAddress())
@@ -48,12 +64,28 @@ EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndp
 #endif
 {
   try {
-    m_pcap.activate(DLT_EN10MB);
-    m_socket.assign(m_pcap.getFd());
+    if (ioMode == EthernetIoMode::PACKET_RING) {
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+      m_ring = make_unique<EthernetPacketRing>(localEndpoint.getIndex(), EthernetPacketRing::Options{});
+      m_ring->activate();
+      m_socket.assign(m_ring->getFd());
+#else
+      NDN_THROW(Error("Packet ring I/O is not supported on this platform"));
+#endif
+    }
+    else {
+      m_pcap.activate(DLT_EN10MB);
+      m_socket.assign(m_pcap.getFd());
+    }
   }
   catch (const PcapHelper::Error& e) {
     NDN_THROW_NESTED(Error(e.what()));
   }
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  catch (const EthernetPacketRing::Error& e) {
+    NDN_THROW_NESTED(Error(e.what()));
+  }
+#endif
 
   // Set initial transport state based upon the state of the underlying NetworkInterface
   handleNetifStateChange(localEndpoint.getState());
@@ -84,6 +116,12 @@ EthernetTransport::doClose()
     m_socket.close(error);
   }
   m_pcap.close();
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  if (m_ring) {
+    m_ring->flush();
+    m_ring->close();
+  }
+#endif
 
   // Ensure that the Transport stays alive at least
   // until all pending handlers are dispatched
@@ -92,6 +130,18 @@ EthernetTransport::doClose()
   });
 }
 
+void
+EthernetTransport::setPacketFilter(const char* filter)
+{
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  if (m_ring) {
+    m_ring->setPacketFilter(filter);
+    return;
+  }
+#endif
+  m_pcap.setPacketFilter(filter);
+}
+
 void
 EthernetTransport::handleNetifStateChange(ndn::net::InterfaceState netifState)
 {
@@ -117,6 +167,20 @@ EthernetTransport::doSend(const Block& packet)
 void
 EthernetTransport::sendPacket(const ndn::Block& block)
 {
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  if (m_ring) {
+    // the frame is built directly in the TX ring, no intermediate buffer is needed
+    if (m_ring->enqueue(m_destAddress, m_srcAddress, block)) {
+      NFD_LOG_FACE_TRACE("Successfully queued: " << block.size() << " bytes");
+      scheduleFlush();
+    }
+    else {
+      NFD_LOG_FACE_DEBUG("TX ring full, dropping frame of " << block.size() << " bytes");
+    }
+    return;
+  }
+#endif
+
   ndn::EncodingBuffer buffer(block);
 
   // pad with zeroes if the payload is too short
@@ -143,6 +207,24 @@ EthernetTransport::sendPacket(const ndn::Block& block)
     NFD_LOG_FACE_TRACE("Successfully sent: " << block.size() << " bytes");
 }
 
+void
+EthernetTransport::scheduleFlush()
+{
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  if (m_isFlushScheduled)
+    return;
+
+  // Sending is only possible while the transport is UP or DOWN, so this handler always
+  // runs before the one posted by doClose(), i.e., while the transport is still alive
+  m_isFlushScheduled = true;
+  getGlobalIoService().post([this] {
+    m_isFlushScheduled = false;
+    if (m_ring && !m_ring->flush())
+      handleError("Send operation failed: "s + std::strerror(errno));
+  });
+#endif
+}
+
 void
 EthernetTransport::asyncRead()
 {
@@ -165,25 +247,34 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
     return;
   }
 
-  auto [pkt, readErr] = m_pcap.readNextPacket();
-  if (pkt.empty()) {
-    NFD_LOG_FACE_DEBUG("Read error: " << readErr);
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  if (m_ring) {
+    size_t nFrames = m_ring->receiveBatch([this] (auto frame) { processFrame(frame); });
+    NFD_LOG_FACE_TRACE("Received a batch of " << nFrames << " frame(s)");
   }
-  else {
-    auto [eh, frameErr] = ethernet::checkFrameHeader(pkt, m_srcAddress,
-                                                     m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
-    if (eh == nullptr) {
-      NFD_LOG_FACE_WARN(frameErr);
+  else
+#endif
+  {
+    auto [pkt, readErr] = m_pcap.readNextPacket();
+    if (pkt.empty()) {
+      NFD_LOG_FACE_DEBUG("Read error: " << readErr);
     }
     else {
-      ethernet::Address sender(eh->ether_shost);
-      pkt = pkt.subspan(ethernet::HDR_LEN);
-      receivePayload(pkt, sender);
+      processFrame(pkt);
     }
   }
 
+  // processing a frame may have caused the transport to fail
+  if (getState() == TransportState::FAILED || getState() == TransportState::CLOSED) {
+    return;
+  }
+
 #ifdef _DEBUG
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  size_t nDropped = m_ring ? m_ring->getNDropped() : m_pcap.getNDropped();
+#else
   size_t nDropped = m_pcap.getNDropped();
+#endif
   if (nDropped - m_nDropped > 0)
     NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
   m_nDropped = nDropped;
@@ -192,6 +283,20 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
   asyncRead();
 }
 
+void
+EthernetTransport::processFrame(span<const uint8_t> frame)
+{
+  auto [eh, frameErr] = ethernet::checkFrameHeader(frame, m_srcAddress,
+                                                   m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
+  if (eh == nullptr) {
+    NFD_LOG_FACE_WARN(frameErr);
+    return;
+  }
+
+  ethernet::Address sender(eh->ether_shost);
+  receivePayload(frame.subspan(ethernet::HDR_LEN), sender);
+}
+
 void
 EthernetTransport::receivePayload(span<const uint8_t> payload, const ethernet::Address& sender)
 {
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 #define NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 
+#include "ethernet-packet-ring.hpp"
 #include "ethernet-protocol.hpp"
 #include "pcap-helper.hpp"
 #include "transport.hpp"
@@ -35,6 +36,17 @@
 
 namespace nfd::face {
 
+/**
+ * @brief Selects how an Ethernet transport exchanges frames with the kernel
+ */
+enum class EthernetIoMode {
+  PCAP,        ///< libpcap in immediate mode, one frame per system call
+  PACKET_RING, ///< memory-mapped TPACKET_V3 RX/TX rings, frames are received and sent in batches
+};
+
+std::ostream&
+operator<<(std::ostream& os, EthernetIoMode mode);
+
 /**
  * @brief Base class for Ethernet-based Transports
  */
@@ -57,11 +69,18 @@ public:
 
 protected:
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                    const ethernet::Address& remoteEndpoint);
+                    const ethernet::Address& remoteEndpoint,
+                    EthernetIoMode ioMode);
 
   void
   doClose() final;
 
+  /**
+   * @brief Installs a BPF filter on the receiving socket, see pcap-filter(7)
+   */
+  void
+  setPacketFilter(const char* filter);
+
   bool
   hasRecentlyReceived() const
   {
@@ -87,18 +106,31 @@ private:
   void
   sendPacket(const ndn::Block& block);
 
+  /**
+   * @brief Flushes the TX ring once the current batch of outgoing frames has been queued
+   */
+  void
+  scheduleFlush();
+
   void
   asyncRead();
 
   void
   handleRead(const boost::system::error_code& error);
 
+  void
+  processFrame(span<const uint8_t> frame);
+
   void
   handleError(const std::string& errorMessage);
 
 protected:
   boost::asio::posix::stream_descriptor m_socket;
   PcapHelper m_pcap;
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+  /// used instead of m_pcap in EthernetIoMode::PACKET_RING
+  unique_ptr<EthernetPacketRing> m_ring;
+#endif
   ethernet::Address m_srcAddress;
   ethernet::Address m_destAddress;
   std::string m_interfaceName;
@@ -107,8 +139,9 @@ private:
   signal::ScopedConnection m_netifStateChangedConn;
   signal::ScopedConnection m_netifMtuChangedConn;
   bool m_hasRecentlyReceived;
+  bool m_isFlushScheduled = false;
 #ifdef _DEBUG
-  /// number of frames dropped by the kernel, as reported by libpcap
+  /// number of frames dropped by the kernel, as reported by libpcap or the RX ring
   size_t m_nDropped;
 #endif
 };
@@ -28,6 +28,7 @@
 
 #include "ethernet-protocol.hpp"
 #include "udp-protocol.hpp"
+#include "common/io-thread.hpp"
 #include "common/logger.hpp"
 
 #include <ndn-cxx/encoding/nfd-constants.hpp>
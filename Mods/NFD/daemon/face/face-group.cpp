@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face-group.hpp"
+#include "face.hpp"
+
+namespace nfd::face {
+
+NFD_LOG_INIT(FaceGroup);
+
+FaceGroup::FaceGroup(size_t ringCapacity)
+  : m_ring(ringCapacity)
+{
+  NFD_LOG_DEBUG("Creating face group with ring capacity " << m_ring.capacity());
+}
+
+FaceGroup::~FaceGroup() = default;
+
+void
+FaceGroup::enqueue(ReceivedPacket&& packet)
+{
+  BOOST_ASSERT(m_ioThread.isCurrentThread());
+
+  if (!m_ring.tryPush(std::move(packet))) {
+    m_nDropped.store(m_nDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    NFD_LOG_DEBUG("Ring is full, dropping packet");
+    return;
+  }
+
+  // the exchange orders the push before the check of the flag, see drain()
+  if (!m_isDrainScheduled.exchange(true)) {
+    scheduleDrain();
+  }
+}
+
+void
+FaceGroup::scheduleDrain()
+{
+  m_ioThread.postToParent([self = weak_from_this()] {
+    if (auto group = self.lock(); group != nullptr) {
+      group->drain();
+    }
+  });
+}
+
+void
+FaceGroup::drain()
+{
+  size_t nPackets = m_ring.consume([] (ReceivedPacket&& packet) {
+    auto face = packet.face.lock();
+    // packets received before the face was closed are not delivered after its removal
+    if (face == nullptr || face->getState() == FaceState::CLOSED) {
+      return;
+    }
+    face->getLinkService()->deliverFromFaceGroup(std::move(packet));
+  }, MAX_BATCH_SIZE);
+
+  if (nPackets == MAX_BATCH_SIZE) {
+    // let other handlers run before the next batch
+    scheduleDrain();
+    return;
+  }
+
+  // The producer pushes then sets the flag, while the consumer clears the flag then checks
+  // the ring. Either the producer sees the cleared flag and schedules a drain, or the
+  // consumer sees the new packet here.
+  m_isDrainScheduled.exchange(false);
+  if (!m_ring.empty() && !m_isDrainScheduled.exchange(true)) {
+    scheduleDrain();
+  }
+}
+
+} // namespace nfd::face
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_FACE_GROUP_HPP
+#define NFD_DAEMON_FACE_FACE_GROUP_HPP
+
+#include "face-common.hpp"
+#include "common/spsc-ring.hpp"
+
+#include <atomic>
+
+namespace nfd::face {
+
+/** \brief A group of faces whose Transports and LinkServices run in a dedicated IoThread.
+ *
+ *  Network-layer packets decoded by the link services of the group are handed to the parent
+ *  thread, where forwarding runs, through a bounded single-producer single-consumer ring.
+ *  The parent thread drains the ring in batches, so that a handler is posted to its
+ *  io_service once per batch rather than once per packet. If the parent thread falls behind
+ *  and the ring fills up, further packets are dropped in the IoThread.
+ */
+class FaceGroup : public std::enable_shared_from_this<FaceGroup>, noncopyable
+{
+public:
+  /** \brief A network-layer packet received by a face of the group.
+   */
+  struct ReceivedPacket
+  {
+    /** \brief Interest dropped by the reliability system for exceeding allowed number of retx.
+     */
+    struct DroppedInterest
+    {
+      shared_ptr<const Interest> interest;
+    };
+
+    weak_ptr<Face> face;
+    std::variant<shared_ptr<const Interest>,
+                 shared_ptr<const Data>,
+                 lp::Nack,
+                 DroppedInterest> packet;
+    EndpointId endpoint;
+  };
+
+  /** \brief Start the IoThread of the group.
+   *  \param ringCapacity minimum number of packets that can be pending in the parent thread
+   */
+  explicit
+  FaceGroup(size_t ringCapacity = DEFAULT_RING_CAPACITY);
+
+  /** \brief Stop the IoThread, after the faces of the group have been destroyed.
+   */
+  ~FaceGroup();
+
+  IoThread&
+  getIoThread() noexcept
+  {
+    return m_ioThread;
+  }
+
+  /** \brief Returns the number of packets dropped because the ring was full.
+   */
+  uint64_t
+  getNDropped() const noexcept
+  {
+    return m_nDropped.load(std::memory_order_relaxed);
+  }
+
+  /** \brief Hand a received packet to the parent thread.
+   *  \pre Invoked in the IoThread.
+   */
+  void
+  enqueue(ReceivedPacket&& packet);
+
+private:
+  /** \brief Dispatch up to MAX_BATCH_SIZE packets in the parent thread.
+   */
+  void
+  drain();
+
+  void
+  scheduleDrain();
+
+public:
+  static constexpr size_t DEFAULT_RING_CAPACITY = 4096;
+  static constexpr size_t MAX_BATCH_SIZE = 64;
+
+private:
+  SpscRing<ReceivedPacket> m_ring;
+  // set by the producer when it posts a drain, cleared by the consumer when the ring is empty
+  std::atomic<bool> m_isDrainScheduled{false};
+  std::atomic<uint64_t> m_nDropped{0};
+
+  // declared last so that the thread is stopped before the ring is destroyed
+  IoThread m_ioThread;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_FACE_GROUP_HPP
@@ -27,7 +27,8 @@
 
 namespace nfd::face {
 
-Face::Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport)
+Face::Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport,
+           shared_ptr<FaceGroup> group)
   : afterReceiveInterest(service->afterReceiveInterest)
   , afterReceiveData(service->afterReceiveData)
   , afterReceiveNack(service->afterReceiveNack)
@@ -36,11 +37,55 @@ Face::Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport)
   , m_service(std::move(service))
   , m_transport(std::move(transport))
   , m_counters(m_service->getCounters(), m_transport->getCounters())
+  , m_group(std::move(group))
 {
+  BOOST_ASSERT(m_group == nullptr || m_group->getIoThread().isCurrentThread());
+
   m_service->setFaceAndTransport(*this, *m_transport);
   m_transport->setFaceAndLinkService(*this, *m_service);
 }
 
+Face::~Face()
+{
+  if (m_group != nullptr) {
+    // Close the transport first, so that the handlers of the socket operations it aborts are
+    // dispatched while it is still alive. The state changes are not signaled, because this
+    // face can no longer be locked.
+    m_group->getIoThread().runAndWait([this] { m_transport->close(); });
+    // then cancel timers and destroy the sockets in the thread that owns them
+    m_group->getIoThread().runAndWait([this] {
+      m_service.reset();
+      m_transport.reset();
+    });
+  }
+}
+
+void
+Face::runInFaceThread(const std::function<void()>& f)
+{
+  if (m_group != nullptr) {
+    m_group->getIoThread().runAndWait(f);
+  }
+  else {
+    f();
+  }
+}
+
+void
+Face::setInterestScheduling(const std::optional<InterestScheduler::Options>& options)
+{
+  if (!options) {
+    m_interestScheduler.reset();
+    return;
+  }
+
+  if (m_interestScheduler == nullptr || m_interestScheduler->getOptions() != *options) {
+    m_interestScheduler = make_unique<InterestScheduler>(*options, [this] (const auto& interest) {
+      transmitInterest(interest);
+    });
+  }
+}
+
 std::ostream&
 operator<<(std::ostream& os, const FaceLogHelper<Face>& flh)
 {
@@ -28,9 +28,13 @@
 
 #include "face-common.hpp"
 #include "face-counters.hpp"
+#include "face-group.hpp"
+#include "interest-scheduler.hpp"
 #include "link-service.hpp"
 #include "transport.hpp"
 
+#include <atomic>
+
 namespace nfd {
 namespace face {
 
@@ -51,11 +55,28 @@ using FaceState = TransportState;
  *  Transport is the lower part, which provides best-effort TLV block deliveries.
  *  LinkService is the upper part, which translates between network-layer packets
  *  and TLV blocks, and may provide additional services such as fragmentation and reassembly.
+ *
+ *  A face may belong to a FaceGroup. In that case, its Transport and LinkService live in the
+ *  IoThread of the group, while the Face itself is used by the parent thread: packets and
+ *  commands given to the Face are posted to the IoThread, received packets are handed over
+ *  through the ring of the group, and the receive and state change signals are emitted in the
+ *  parent thread.
  */
 class Face NFD_FINAL_UNLESS_WITH_TESTS : public std::enable_shared_from_this<Face>, noncopyable
 {
 public:
-  Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport);
+  /** \brief Create a face.
+   *  \param group the FaceGroup whose IoThread runs \p service and \p transport, or nullptr if
+   *               they run in the calling thread; if not nullptr, this constructor must be
+   *               invoked in that IoThread and the face must then be handed to the parent thread
+   */
+  Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport,
+       shared_ptr<FaceGroup> group = nullptr);
+
+  /** \pre If the face belongs to a FaceGroup, it is not destroyed in the group's IoThread
+   *       unless it has never been handed to the parent thread.
+   */
+  ~Face();
 
   LinkService*
   getLinkService() const noexcept
@@ -69,6 +90,32 @@ public:
     return m_transport.get();
   }
 
+  /** \brief Returns the IoThread that runs the face's Transport and LinkService,
+   *         or nullptr if they run in the same thread as the face.
+   */
+  IoThread*
+  getIoThread() const noexcept
+  {
+    return m_group == nullptr ? nullptr : &m_group->getIoThread();
+  }
+
+  /** \brief Returns the FaceGroup to which the face belongs, or nullptr.
+   */
+  FaceGroup*
+  getFaceGroup() const noexcept
+  {
+    return m_group.get();
+  }
+
+  /** \brief Invoke \p f in the thread that runs the face's Transport and LinkService,
+   *         and wait for it to return.
+   *
+   *  This must be used to access the Transport or LinkService in any way that is not safe
+   *  to do concurrently with packet processing, e.g., to change the link service options.
+   */
+  void
+  runInFaceThread(const std::function<void()>& f);
+
   /** \brief Request that the face be closed.
    *
    *  This operation is effective only if face is in the UP or DOWN state; otherwise, it has no effect.
@@ -83,6 +130,8 @@ public:
 
 public: // upper interface connected to forwarding
   /** \brief Send Interest.
+   *
+   *  If an InterestScheduler is set, the Interest may be queued or dropped by it.
    */
   void
   sendInterest(const Interest& interest);
@@ -120,7 +169,7 @@ public: // properties
   FaceId
   getId() const noexcept
   {
-    return m_id;
+    return m_id.load(std::memory_order_relaxed);
   }
 
   /**
@@ -130,7 +179,7 @@ public: // properties
   void
   setId(FaceId id) noexcept
   {
-    m_id = id;
+    m_id.store(id, std::memory_order_relaxed);
   }
 
   /**
@@ -207,6 +256,25 @@ public: // properties
     return m_counters;
   }
 
+  /**
+   * \brief Shape the Interests sent on this face according to \p options,
+   *        or stop shaping them if \p options is nullopt.
+   *
+   * The Interests queued by the previous InterestScheduler, if any, are dropped,
+   * unless the options are unchanged.
+   */
+  void
+  setInterestScheduling(const std::optional<InterestScheduler::Options>& options);
+
+  /**
+   * \brief Returns the InterestScheduler that shapes the Interests sent on this face, or nullptr.
+   */
+  const InterestScheduler*
+  getInterestScheduler() const noexcept
+  {
+    return m_interestScheduler.get();
+  }
+
   /**
    * \brief Get channel on which face was created (unicast) or the associated channel (multicast).
    */
@@ -226,34 +294,77 @@ public: // properties
   }
 
 private:
-  FaceId m_id = INVALID_FACEID;
+  void
+  transmitInterest(const Interest& interest);
+
+private:
+  // FaceId is read by the IoThread for logging
+  std::atomic<FaceId> m_id{INVALID_FACEID};
   unique_ptr<LinkService> m_service;
   unique_ptr<Transport> m_transport;
   FaceCounters m_counters;
   weak_ptr<Channel> m_channel;
+  shared_ptr<FaceGroup> m_group;
+  // declared last so that queued Interests are dropped before the LinkService is destroyed
+  unique_ptr<InterestScheduler> m_interestScheduler;
 };
 
 inline void
 Face::close()
 {
+  if (m_group != nullptr) {
+    m_group->getIoThread().post([transport = m_transport.get()] { transport->close(); });
+    return;
+  }
   m_transport->close();
 }
 
+// Handlers posted to the IoThread may capture raw pointers to the LinkService and Transport,
+// because ~Face destroys them in the IoThread after all previously posted handlers.
+
 inline void
 Face::sendInterest(const Interest& interest)
 {
+  if (m_interestScheduler != nullptr) {
+    m_interestScheduler->enqueue(interest);
+    return;
+  }
+  transmitInterest(interest);
+}
+
+inline void
+Face::transmitInterest(const Interest& interest)
+{
+  if (m_group != nullptr) {
+    m_group->getIoThread().post([service = m_service.get(), interest] {
+      service->sendInterest(interest);
+    });
+    return;
+  }
   m_service->sendInterest(interest);
 }
 
 inline void
 Face::sendData(const Data& data)
 {
+  if (m_group != nullptr) {
+    m_group->getIoThread().post([service = m_service.get(), data] {
+      service->sendData(data);
+    });
+    return;
+  }
   m_service->sendData(data);
 }
 
 inline void
 Face::sendNack(const lp::Nack& nack)
 {
+  if (m_group != nullptr) {
+    m_group->getIoThread().post([service = m_service.get(), nack] {
+      service->sendNack(nack);
+    });
+    return;
+  }
   m_service->sendNack(nack);
 }
 
@@ -284,7 +395,7 @@ Face::getPersistency() const
 inline void
 Face::setPersistency(ndn::nfd::FacePersistency persistency)
 {
-  return m_transport->setPersistency(persistency);
+  runInFaceThread([this, persistency] { m_transport->setPersistency(persistency); });
 }
 
 inline ndn::nfd::LinkType
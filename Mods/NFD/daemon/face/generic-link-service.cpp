@@ -25,6 +25,7 @@
 
 #include "generic-link-service.hpp"
 
+#include <ndn-cxx/interest-view.hpp>
 #include <ndn-cxx/lp/pit-token.hpp>
 #include <ndn-cxx/lp/tags.hpp>
 
@@ -358,17 +359,10 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
   BOOST_ASSERT(netPkt.type() == tlv::Interest);
   BOOST_ASSERT(!firstPkt.has<lp::NackField>());
 
-  // forwarding expects Interest to be created with make_shared
-  auto interest = make_shared<Interest>(netPkt);
-
-  if (firstPkt.has<lp::NextHopFaceIdField>()) {
-    if (m_options.allowLocalFields) {
-      interest->setTag(make_shared<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>()));
-    }
-    else {
-      NFD_LOG_FACE_WARN("received NextHopFaceId, but local fields disabled: DROP");
-      return;
-    }
+  // LpPacket fields that cause the Interest to be dropped are checked before it is decoded
+  if (firstPkt.has<lp::NextHopFaceIdField>() && !m_options.allowLocalFields) {
+    NFD_LOG_FACE_WARN("received NextHopFaceId, but local fields disabled: DROP");
+    return;
   }
 
   if (firstPkt.has<lp::CachePolicyField>()) {
@@ -377,6 +371,28 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
     return;
   }
 
+  if (firstPkt.has<lp::PrefixAnnouncementField>()) {
+    ++nInNetInvalid;
+    NFD_LOG_FACE_WARN("received PrefixAnnouncement with Interest: DROP");
+    return;
+  }
+
+  // an Interest whose HopLimit is zero would be dropped by forwarding anyway,
+  // so it is recognized without materializing the Name and the other elements
+  ndn::InterestView view(netPkt);
+  if (auto hopLimit = view.getHopLimit(); hopLimit && *hopLimit == 0) {
+    this->dropHopLimitZeroInterest();
+    NFD_LOG_FACE_DEBUG("received Interest with HopLimit=0: DROP");
+    return;
+  }
+
+  // forwarding expects Interest to be created with make_shared
+  auto interest = view.toInterest();
+
+  if (firstPkt.has<lp::NextHopFaceIdField>()) {
+    interest->setTag(make_shared<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>()));
+  }
+
   if (firstPkt.has<lp::IncomingFaceIdField>()) {
     NFD_LOG_FACE_WARN("received IncomingFaceId: IGNORE");
   }
@@ -394,12 +410,6 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
     }
   }
 
-  if (firstPkt.has<lp::PrefixAnnouncementField>()) {
-    ++nInNetInvalid;
-    NFD_LOG_FACE_WARN("received PrefixAnnouncement with Interest: DROP");
-    return;
-  }
-
   if (firstPkt.has<lp::PitTokenField>()) {
     interest->setTag(make_shared<lp::PitToken>(firstPkt.get<lp::PitTokenField>()));
   }
@@ -413,9 +423,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
 {
   BOOST_ASSERT(netPkt.type() == tlv::Data);
 
-  // forwarding expects Data to be created with make_shared
-  auto data = make_shared<Data>(netPkt);
-
+  // LpPacket fields that cause the Data to be dropped are checked before it is decoded
   if (firstPkt.has<lp::NackField>()) {
     ++nInNetInvalid;
     NFD_LOG_FACE_WARN("received Nack with Data: DROP");
@@ -428,6 +436,15 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
     return;
   }
 
+  if (firstPkt.has<lp::NonDiscoveryField>()) {
+    ++nInNetInvalid;
+    NFD_LOG_FACE_WARN("received NonDiscovery with Data: DROP");
+    return;
+  }
+
+  // forwarding expects Data to be created with make_shared
+  auto data = make_shared<Data>(netPkt);
+
   if (firstPkt.has<lp::CachePolicyField>()) {
     // CachePolicy is unprivileged and does not require allowLocalFields option.
     // In case of an invalid CachePolicyType, get<lp::CachePolicyField> will throw,
@@ -443,12 +460,6 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
     data->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
   }
 
-  if (firstPkt.has<lp::NonDiscoveryField>()) {
-    ++nInNetInvalid;
-    NFD_LOG_FACE_WARN("received NonDiscovery with Data: DROP");
-    return;
-  }
-
   if (firstPkt.has<lp::PrefixAnnouncementField>()) {
     if (m_options.allowSelfLearning) {
       data->setTag(make_shared<lp::PrefixAnnouncementTag>(firstPkt.get<lp::PrefixAnnouncementField>()));
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "interest-scheduler.hpp"
+#include "common/global.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd::face {
+
+NFD_LOG_INIT(InterestScheduler);
+
+InterestScheduler::InterestScheduler(const Options& options, TransmitCallback transmit)
+  : m_options(options)
+  , m_transmit(std::move(transmit))
+  , m_tokens(options.rate, std::max<uint32_t>(options.burst, 1), time::steady_clock::now())
+{
+  BOOST_ASSERT(m_options.quantum > 0);
+}
+
+void
+InterestScheduler::enqueue(const Interest& interest)
+{
+  if (m_nQueued == 0 && m_tokens.tryConsume(time::steady_clock::now())) {
+    m_transmit(interest);
+    return;
+  }
+
+  auto tag = interest.getTag<lp::IncomingFaceIdTag>();
+  FaceId flowId = tag == nullptr ? INVALID_FACEID : tag->get();
+  Flow& flow = m_flows[flowId];
+  if (flow.queue.size() >= m_options.maxQueueLength) {
+    NFD_LOG_DEBUG("Queue of flow " << flowId << " is full, dropping " << interest.getName());
+    ++m_nDropped;
+    return;
+  }
+
+  if (flow.queue.empty()) {
+    m_activeFlows.push_back(flowId);
+  }
+  flow.queue.push_back(make_shared<Interest>(interest));
+  ++m_nQueued;
+
+  if (!m_timer) {
+    dequeue();
+  }
+}
+
+void
+InterestScheduler::dequeue()
+{
+  m_timer.cancel();
+  auto now = time::steady_clock::now();
+
+  while (!m_activeFlows.empty()) {
+    if (!m_tokens.hasToken(now)) {
+      m_timer = getScheduler().schedule(m_tokens.getTimeUntilToken(now), [this] { dequeue(); });
+      return;
+    }
+
+    FaceId flowId = m_activeFlows.front();
+    Flow& flow = m_flows.at(flowId);
+    if (!m_hasReceivedQuantum) {
+      flow.deficit += m_options.quantum;
+      m_hasReceivedQuantum = true;
+    }
+
+    size_t size = flow.queue.front()->wireEncode().size();
+    if (flow.deficit < size) {
+      // the flow has used its deficit for this round, serve the next flow
+      m_activeFlows.pop_front();
+      m_activeFlows.push_back(flowId);
+      m_hasReceivedQuantum = false;
+      continue;
+    }
+
+    flow.deficit -= size;
+    m_tokens.tryConsume(now);
+    auto interest = std::move(flow.queue.front());
+    flow.queue.pop_front();
+    --m_nQueued;
+
+    if (flow.queue.empty()) {
+      // an idle flow does not keep its deficit
+      m_flows.erase(flowId);
+      m_activeFlows.pop_front();
+      m_hasReceivedQuantum = false;
+    }
+
+    m_transmit(*interest);
+  }
+}
+
+} // namespace nfd::face
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_INTEREST_SCHEDULER_HPP
+#define NFD_DAEMON_FACE_INTEREST_SCHEDULER_HPP
+
+#include "face-common.hpp"
+#include "common/token-bucket.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+namespace nfd::face {
+
+/** \brief Shapes the Interests sent on a face to a maximum rate, and shares that rate among
+ *         the downstream faces of the Interests with deficit round robin.
+ *
+ *  Interests are classified into flows by their IncomingFaceIdTag. Each flow has a bounded
+ *  queue, so that a downstream that sends more than its share only delays and eventually
+ *  drops its own Interests. In each round, a flow may send Interests up to its deficit, which
+ *  grows by a quantum of bytes per round.
+ */
+class InterestScheduler : noncopyable
+{
+public:
+  struct Options
+  {
+    /// Interests sent per second
+    uint32_t rate = 0;
+    /// Interests sent back to back after an idle period
+    uint32_t burst = 1;
+    /// bytes added to the deficit of a flow in each round
+    size_t quantum = 1024;
+    /// maximum number of Interests queued in each flow
+    size_t maxQueueLength = 256;
+
+    friend bool
+    operator==(const Options& a, const Options& b) noexcept
+    {
+      return a.rate == b.rate && a.burst == b.burst &&
+             a.quantum == b.quantum && a.maxQueueLength == b.maxQueueLength;
+    }
+
+    friend bool
+    operator!=(const Options& a, const Options& b) noexcept
+    {
+      return !(a == b);
+    }
+  };
+
+  using TransmitCallback = std::function<void(const Interest&)>;
+
+  /** \param options the options, rate must be positive
+   *  \param transmit invoked for each Interest when it is its turn to be sent
+   */
+  InterestScheduler(const Options& options, TransmitCallback transmit);
+
+  const Options&
+  getOptions() const noexcept
+  {
+    return m_options;
+  }
+
+  /** \brief Send \p interest now if the rate allows it and no Interest is queued,
+   *         otherwise queue it in its flow.
+   */
+  void
+  enqueue(const Interest& interest);
+
+  /** \brief Returns the number of queued Interests.
+   */
+  size_t
+  getQueueLength() const noexcept
+  {
+    return m_nQueued;
+  }
+
+  /** \brief Returns the number of Interests dropped because the queue of their flow was full.
+   */
+  uint64_t
+  getNDropped() const noexcept
+  {
+    return m_nDropped;
+  }
+
+private:
+  /** \brief Send queued Interests while tokens are available, then schedule the next attempt.
+   */
+  void
+  dequeue();
+
+private:
+  struct Flow
+  {
+    std::deque<shared_ptr<const Interest>> queue;
+    size_t deficit = 0;
+  };
+
+  Options m_options;
+  TransmitCallback m_transmit;
+  TokenBucket m_tokens;
+
+  std::unordered_map<FaceId, Flow> m_flows;
+  /// flows with queued Interests, in round robin order; the front flow is being served
+  std::deque<FaceId> m_activeFlows;
+  /// whether the front flow has received its quantum for the current round
+  bool m_hasReceivedQuantum = false;
+  size_t m_nQueued = 0;
+  uint64_t m_nDropped = 0;
+  scheduler::ScopedEventId m_timer;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_INTEREST_SCHEDULER_HPP
@@ -30,6 +30,18 @@ namespace nfd::face {
 
 NFD_LOG_INIT(LinkService);
 
+// The forwarder retains received packets with shared_from_this(), so a packet handed to the
+// parent thread through FaceGroup must be owned by a shared_ptr.
+template<typename Packet>
+static shared_ptr<const Packet>
+getSharedPacket(const Packet& packet)
+{
+  if (auto p = packet.weak_from_this().lock(); p != nullptr) {
+    return p;
+  }
+  return make_shared<Packet>(packet);
+}
+
 LinkService::~LinkService() = default;
 
 void
@@ -42,6 +54,12 @@ LinkService::setFaceAndTransport(Face& face, Transport& transport) noexcept
   m_transport = &transport;
 }
 
+FaceGroup*
+LinkService::getFaceGroup() const noexcept
+{
+  return m_face == nullptr ? nullptr : m_face->getFaceGroup();
+}
+
 void
 LinkService::sendInterest(const Interest& interest)
 {
@@ -82,6 +100,11 @@ LinkService::receiveInterest(const Interest& interest, const EndpointId& endpoin
 
   ++this->nInInterests;
 
+  if (auto group = getFaceGroup(); group != nullptr) {
+    group->enqueue({m_face->weak_from_this(), getSharedPacket(interest), endpoint});
+    return;
+  }
+
   afterReceiveInterest(interest, endpoint);
 }
 
@@ -92,6 +115,11 @@ LinkService::receiveData(const Data& data, const EndpointId& endpoint)
 
   ++this->nInData;
 
+  if (auto group = getFaceGroup(); group != nullptr) {
+    group->enqueue({m_face->weak_from_this(), getSharedPacket(data), endpoint});
+    return;
+  }
+
   afterReceiveData(data, endpoint);
 }
 
@@ -102,16 +130,56 @@ LinkService::receiveNack(const ndn::lp::Nack& nack, const EndpointId& endpoint)
 
   ++this->nInNacks;
 
+  if (auto group = getFaceGroup(); group != nullptr) {
+    group->enqueue({m_face->weak_from_this(), nack, endpoint});
+    return;
+  }
+
   afterReceiveNack(nack, endpoint);
 }
 
+void
+LinkService::dropHopLimitZeroInterest() noexcept
+{
+  ++this->nInInterests;
+  if (m_face != nullptr) {
+    ++m_face->getCounters().nInHopLimitZero;
+  }
+}
+
 void
 LinkService::notifyDroppedInterest(const Interest& interest)
 {
   ++this->nInterestsExceededRetx;
+
+  if (auto group = getFaceGroup(); group != nullptr) {
+    group->enqueue({m_face->weak_from_this(),
+                    FaceGroup::ReceivedPacket::DroppedInterest{getSharedPacket(interest)}, {}});
+    return;
+  }
+
   onDroppedInterest(interest);
 }
 
+void
+LinkService::deliverFromFaceGroup(FaceGroup::ReceivedPacket&& packet)
+{
+  using DroppedInterest = FaceGroup::ReceivedPacket::DroppedInterest;
+
+  if (auto interest = std::get_if<shared_ptr<const Interest>>(&packet.packet)) {
+    afterReceiveInterest(**interest, packet.endpoint);
+  }
+  else if (auto data = std::get_if<shared_ptr<const Data>>(&packet.packet)) {
+    afterReceiveData(**data, packet.endpoint);
+  }
+  else if (auto nack = std::get_if<lp::Nack>(&packet.packet)) {
+    afterReceiveNack(*nack, packet.endpoint);
+  }
+  else {
+    onDroppedInterest(*std::get<DroppedInterest>(packet.packet).interest);
+  }
+}
+
 std::ostream&
 operator<<(std::ostream& os, const FaceLogHelper<LinkService>& flh)
 {
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_LINK_SERVICE_HPP
 
 #include "face-common.hpp"
+#include "face-group.hpp"
 #include "transport.hpp"
 #include "common/counter.hpp"
 
@@ -184,6 +185,12 @@ protected: // upper interface to be invoked in subclass (receive path terminatio
   void
   receiveNack(const lp::Nack& nack, const EndpointId& endpoint);
 
+  /** \brief Accounts for a received Interest that is dropped before reaching forwarding
+   *         because its HopLimit is zero.
+   */
+  void
+  dropHopLimitZeroInterest() noexcept;
+
 protected: // lower interface to be invoked in subclass (send path termination)
   /** \brief Send a lower-layer packet via Transport.
    */
@@ -194,6 +201,21 @@ protected:
   void
   notifyDroppedInterest(const Interest& packet);
 
+private:
+  /** \brief Returns the FaceGroup of the face, in which case received packets must be handed
+   *         to the parent thread through the group's ring.
+   */
+  FaceGroup*
+  getFaceGroup() const noexcept;
+
+  /** \brief Emits the upper layer signal of a packet that has been handed over by FaceGroup.
+   *  \note Invoked in the parent thread.
+   */
+  void
+  deliverFromFaceGroup(FaceGroup::ReceivedPacket&& packet);
+
+  friend class FaceGroup;
+
 private: // upper interface to be overridden in subclass (send path entrypoint)
   /** \brief Performs LinkService specific operations to send an Interest.
    */
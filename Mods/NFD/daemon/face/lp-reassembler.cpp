@@ -27,7 +27,7 @@
 #include "link-service.hpp"
 #include "common/global.hpp"
 
-#include <numeric>
+#include <boost/functional/hash.hpp>
 
 namespace nfd::face {
 
@@ -84,8 +84,7 @@ LpReassembler::receiveFragment(const EndpointId& remoteEndpoint, const lp::Packe
   PartialPacket& pp = m_partialPackets[key];
   if (pp.fragCount == 0) { // new PartialPacket
     pp.fragCount = fragCount;
-    pp.nReceivedFragments = 0;
-    pp.fragments.resize(fragCount);
+    pp.isReceived.resize(fragCount);
   }
   else {
     if (fragCount != pp.fragCount) {
@@ -94,58 +93,176 @@ LpReassembler::receiveFragment(const EndpointId& remoteEndpoint, const lp::Packe
     }
   }
 
-  if (pp.fragments[fragIndex].has<lp::SequenceField>()) {
+  if (pp.isReceived[fragIndex]) {
     NFD_LOG_FACE_TRACE("fragment already received: DROP");
     return {false, {}, {}};
   }
 
-  pp.fragments[fragIndex] = packet;
+  auto [fragBegin, fragEnd] = packet.get<lp::FragmentField>();
+  span<const uint8_t> frag(fragBegin, fragEnd);
+  if (fragIndex == 0) {
+    pp.firstFragment = packet;
+    pp.firstFragSize = frag.size();
+  }
+  else if (fragIndex == fragCount - 1) {
+    pp.lastFragSize = frag.size();
+  }
+  else if (pp.stride == 0) {
+    allocateBuffer(pp, frag.size());
+  }
+
+  if (!tryCopyToBuffer(pp, fragIndex, frag)) {
+    pp.retainedFragments.emplace_back(fragIndex, packet);
+  }
+  pp.isReceived[fragIndex] = true;
   ++pp.nReceivedFragments;
 
   // check complete condition
   if (pp.nReceivedFragments == pp.fragCount) {
-    Block reassembled = doReassembly(key);
-    lp::Packet firstFrag(std::move(pp.fragments[0]));
+    PartialPacket completed = std::move(pp);
     m_partialPackets.erase(key);
-    return {true, reassembled, firstFrag};
+    Block reassembled = doReassembly(completed);
+    return {true, reassembled, std::move(completed.firstFragment)};
   }
 
   // set drop timer
-  pp.dropTimer = getScheduler().schedule(m_options.reassemblyTimeout, [=] { timeoutPartialPacket(key); });
+  scheduleTimeout(key, pp);
 
   return {false, {}, {}};
 }
 
+void
+LpReassembler::allocateBuffer(PartialPacket& pp, size_t stride)
+{
+  pp.stride = stride;
+  if (stride == 0 || pp.fragCount > m_options.maxPreallocatedSize / stride) {
+    return;
+  }
+
+  // the first fragment ends at offset stride, and fragment i starts at offset i*stride
+  pp.buffer = std::make_shared<ndn::Buffer>(pp.fragCount * stride);
+
+  auto& retained = pp.retainedFragments;
+  retained.erase(std::remove_if(retained.begin(), retained.end(), [&] (const auto& indexAndFrag) {
+    auto [fragBegin, fragEnd] = indexAndFrag.second.template get<lp::FragmentField>();
+    return tryCopyToBuffer(pp, indexAndFrag.first, {fragBegin, fragEnd});
+  }), retained.end());
+}
+
+bool
+LpReassembler::tryCopyToBuffer(PartialPacket& pp, size_t fragIndex, span<const uint8_t> frag)
+{
+  if (pp.buffer == nullptr) {
+    return false;
+  }
+
+  size_t offset = fragIndex * pp.stride;
+  if (fragIndex == 0) {
+    if (frag.size() > pp.stride) {
+      return false;
+    }
+    offset = pp.stride - frag.size();
+  }
+  else if (fragIndex == pp.fragCount - 1 ? frag.size() > pp.stride : frag.size() != pp.stride) {
+    return false;
+  }
+
+  std::copy(frag.begin(), frag.end(), pp.buffer->begin() + offset);
+  return true;
+}
+
 Block
-LpReassembler::doReassembly(const Key& key)
+LpReassembler::doReassembly(PartialPacket& pp)
 {
-  PartialPacket& pp = m_partialPackets[key];
+  if (pp.buffer != nullptr && pp.retainedFragments.empty()) {
+    // every fragment is already at its place
+    auto begin = pp.buffer->cbegin() + (pp.stride - pp.firstFragSize);
+    auto end = pp.buffer->cbegin() + (pp.fragCount - 1) * pp.stride + pp.lastFragSize;
+    return Block(std::move(pp.buffer), begin, end);
+  }
 
-  size_t payloadSize = std::accumulate(pp.fragments.begin(), pp.fragments.end(), 0U,
-    [&] (size_t sum, const lp::Packet& pkt) -> size_t {
-      auto [fragBegin, fragEnd] = pkt.get<lp::FragmentField>();
-      return sum + std::distance(fragBegin, fragEnd);
-    });
+  std::vector<span<const uint8_t>> frags(pp.fragCount);
+  if (pp.buffer != nullptr) {
+    const uint8_t* data = pp.buffer->data();
+    frags.front() = {data + pp.stride - pp.firstFragSize, pp.firstFragSize};
+    for (size_t i = 1; i < pp.fragCount - 1; ++i) {
+      frags[i] = {data + i * pp.stride, pp.stride};
+    }
+    frags.back() = {data + (pp.fragCount - 1) * pp.stride, pp.lastFragSize};
+  }
+  for (const auto& [fragIndex, packet] : pp.retainedFragments) {
+    auto [fragBegin, fragEnd] = packet.get<lp::FragmentField>();
+    frags[fragIndex] = {fragBegin, fragEnd};
+  }
 
-  ndn::Buffer fragBuffer(payloadSize);
-  auto it = fragBuffer.begin();
-  for (const lp::Packet& frag : pp.fragments) {
-    auto [fragBegin, fragEnd] = frag.get<lp::FragmentField>();
-    it = std::copy(fragBegin, fragEnd, it);
+  size_t payloadSize = 0;
+  for (const auto& frag : frags) {
+    payloadSize += frag.size();
   }
-  return Block(fragBuffer);
+
+  auto fragBuffer = std::make_shared<ndn::Buffer>(payloadSize);
+  auto it = fragBuffer->begin();
+  for (const auto& frag : frags) {
+    it = std::copy(frag.begin(), frag.end(), it);
+  }
+  return Block(std::move(fragBuffer));
 }
 
 void
-LpReassembler::timeoutPartialPacket(const Key& key)
+LpReassembler::scheduleTimeout(const Key& key, PartialPacket& pp)
 {
-  auto it = m_partialPackets.find(key);
-  if (it == m_partialPackets.end()) {
-    return;
+  pp.expiry = time::steady_clock::now() + m_options.reassemblyTimeout;
+  m_timeouts.emplace_back(pp.expiry, key);
+
+  if (!m_timeoutTimer) {
+    m_timeoutTimer = getScheduler().schedule(m_options.reassemblyTimeout, [this] { processTimeouts(); });
+  }
+}
+
+void
+LpReassembler::processTimeouts()
+{
+  auto now = time::steady_clock::now();
+  while (!m_timeouts.empty() && m_timeouts.front().first <= now) {
+    auto [deadline, key] = std::move(m_timeouts.front());
+    m_timeouts.pop_front();
+
+    auto it = m_partialPackets.find(key);
+    if (it == m_partialPackets.end() || it->second.expiry != deadline) {
+      continue;
+    }
+
+    this->beforeTimeout(std::get<0>(key), it->second.nReceivedFragments);
+    m_partialPackets.erase(it);
   }
 
-  this->beforeTimeout(std::get<0>(key), it->second.nReceivedFragments);
-  m_partialPackets.erase(it);
+  if (!m_timeouts.empty()) {
+    m_timeoutTimer = getScheduler().schedule(m_timeouts.front().first - now, [this] { processTimeouts(); });
+  }
+}
+
+size_t
+LpReassembler::KeyHash::operator()(const Key& key) const noexcept
+{
+  const auto& [endpoint, messageIdentifier] = key;
+  size_t seed = 0;
+  boost::hash_combine(seed, messageIdentifier);
+  boost::hash_combine(seed, endpoint.index());
+
+  if (auto ether = std::get_if<ethernet::Address>(&endpoint); ether != nullptr) {
+    boost::hash_combine(seed, std::hash<ethernet::Address>{}(*ether));
+  }
+  else if (auto udp = std::get_if<udp::Endpoint>(&endpoint); udp != nullptr) {
+    boost::hash_combine(seed, udp->port());
+    if (udp->address().is_v4()) {
+      boost::hash_combine(seed, udp->address().to_v4().to_uint());
+    }
+    else {
+      auto bytes = udp->address().to_v6().to_bytes();
+      boost::hash_range(seed, bytes.begin(), bytes.end());
+    }
+  }
+  return seed;
 }
 
 std::ostream&
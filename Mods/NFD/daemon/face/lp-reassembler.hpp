@@ -30,6 +30,9 @@
 
 #include <ndn-cxx/lp/packet.hpp>
 
+#include <deque>
+#include <unordered_map>
+
 namespace nfd::face {
 
 /**
@@ -52,6 +55,14 @@ public:
     /** \brief Timeout before a partially reassembled packet is dropped.
      */
     time::nanoseconds reassemblyTimeout = 500_ms;
+
+    /** \brief Maximum size of a reassembly buffer allocated before all fragments are received.
+     *
+     *  Once the fragment stride of a partial packet is known, a buffer of the final size is
+     *  allocated, and each fragment is copied to its offset as it arrives. Partial packets
+     *  that would need a larger buffer keep their fragments until they are complete.
+     */
+    size_t maxPreallocatedSize = ndn::MAX_NDN_PACKET_SIZE;
   };
 
   explicit
@@ -98,14 +109,25 @@ public:
 
 private:
   /**
-   * \brief Holds all fragments of a packet until reassembled.
+   * \brief Holds the fragments of a packet until reassembled.
+   *
+   * When the stride of the fragments is known, that is, once a fragment other than the
+   * first and the last one has been received, fragment i is copied to offset i*stride of
+   * a buffer of the final size, except for the first fragment, which ends at offset stride.
+   * Fragments received before that, or that do not fit the stride, are retained as is.
    */
   struct PartialPacket
   {
-    std::vector<lp::Packet> fragments;
-    size_t fragCount; ///< total fragments
-    size_t nReceivedFragments; ///< number of received fragments
-    scheduler::ScopedEventId dropTimer;
+    size_t fragCount = 0; ///< total fragments
+    size_t nReceivedFragments = 0; ///< number of received fragments
+    std::vector<bool> isReceived;
+    lp::Packet firstFragment;
+    shared_ptr<ndn::Buffer> buffer;
+    size_t stride = 0;
+    size_t firstFragSize = 0;
+    size_t lastFragSize = 0;
+    std::vector<std::pair<size_t, lp::Packet>> retainedFragments;
+    time::steady_clock::time_point expiry;
   };
 
   /**
@@ -116,16 +138,41 @@ private:
     lp::Sequence // message identifier (sequence number of the first fragment)
   >;
 
+  struct KeyHash
+  {
+    size_t
+    operator()(const Key& key) const noexcept;
+  };
+
+  bool
+  tryCopyToBuffer(PartialPacket& pp, size_t fragIndex, span<const uint8_t> frag);
+
+  void
+  allocateBuffer(PartialPacket& pp, size_t stride);
+
   Block
-  doReassembly(const Key& key);
+  doReassembly(PartialPacket& pp);
+
+  void
+  scheduleTimeout(const Key& key, PartialPacket& pp);
 
   void
-  timeoutPartialPacket(const Key& key);
+  processTimeouts();
 
 private:
   Options m_options;
   const LinkService* m_linkService;
-  std::map<Key, PartialPacket> m_partialPackets;
+  std::unordered_map<Key, PartialPacket, KeyHash> m_partialPackets;
+
+  /**
+   * \brief Drop deadlines of partial packets, in the order they were set.
+   *
+   * All partial packets share the same timeout, so this queue is sorted, and a single
+   * timer for its front is enough. A deadline is stale, and is skipped, if its partial
+   * packet has since been completed, dropped, or refreshed by another fragment.
+   */
+  std::deque<std::pair<time::steady_clock::time_point, Key>> m_timeouts;
+  scheduler::ScopedEventId m_timeoutTimer;
 };
 
 std::ostream&
@@ -35,7 +35,6 @@ NFD_LOG_INIT(LpReliability);
 LpReliability::LpReliability(const LpReliability::Options& options, GenericLinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
-  , m_firstUnackedFrag(m_unackedFrags.begin())
   , m_lastTxSeqNo(-1) // set to "-1" to start TxSequence numbers at 0
 {
   BOOST_ASSERT(m_linkService != nullptr);
@@ -65,7 +64,6 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
 {
   BOOST_ASSERT(m_options.isEnabled);
 
-  auto unackedFragsIt = m_unackedFrags.begin();
   auto sendTime = time::steady_clock::now();
 
   auto netPkt = make_shared<NetPkt>(std::move(pkt), isInterest);
@@ -79,20 +77,14 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
     lp::Sequence txSeq = assignTxSequence(frag);
 
     // Store LpPacket for future retransmissions
-    unackedFragsIt = m_unackedFrags.try_emplace(unackedFragsIt, txSeq, frag);
+    auto unackedFragsIt = m_unackedFrags.emplace(txSeq, frag);
     unackedFragsIt->second.sendTime = sendTime;
+    unackedFragsIt->second.netPkt = netPkt;
     auto rto = m_rttEst.getEstimatedRto();
     lp::Sequence seq = frag.get<lp::SequenceField>();
     NFD_LOG_FACE_TRACE("transmitting seq=" << seq << ", txseq=" << txSeq << ", rto=" <<
                        time::duration_cast<time::milliseconds>(rto).count() << "ms");
-    unackedFragsIt->second.rtoTimer = getScheduler().schedule(rto, [=] {
-      onLpPacketLost(txSeq, true);
-    });
-    unackedFragsIt->second.netPkt = netPkt;
-
-    if (m_unackedFrags.size() == 1) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
+    startRtoTimer(unackedFragsIt);
 
     // Add to associated NetPkt
     netPkt->unackedFrags.push_back(unackedFragsIt);
@@ -117,9 +109,6 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
     }
     auto& frag = fragIt->second;
 
-    // Cancel the RTO timer for the acknowledged fragment
-    frag.rtoTimer.cancel();
-
     if (frag.retxCount == 0) {
       NFD_LOG_FACE_TRACE("received ack for seq=" << frag.pkt.get<lp::SequenceField>() << ", txseq=" <<
                          ackTxSeq << ", retx=0, rtt=" <<
@@ -137,8 +126,9 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
     // received.
     auto lostLpPackets = findLostLpPackets(fragIt);
 
-    // Remove the fragment from the map of unacknowledged fragments and from its associated network
-    // packet. Potentially increment the start of the window.
+    // Remove the fragment from the window of unacknowledged fragments and from its associated
+    // network packet. Potentially increment the start of the window. Its RTO deadline is left in
+    // the heap and will be skipped.
     onLpPacketAcknowledged(fragIt);
 
     // This set contains TxSequences that have been removed by onLpPacketLost below because they
@@ -170,13 +160,12 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
       // Check for recent received Sequences to remove
       auto now = time::steady_clock::now();
       auto rto = m_rttEst.getEstimatedRto();
-      while (!m_recentRecvSeqsQueue.empty() &&
-             now > m_recentRecvSeqs[m_recentRecvSeqsQueue.front()] + rto) {
-        m_recentRecvSeqs.erase(m_recentRecvSeqsQueue.front());
+      while (!m_recentRecvSeqsQueue.empty() && now > m_recentRecvSeqsQueue.front().second + rto) {
+        m_recentRecvSeqs.erase(m_recentRecvSeqsQueue.front().first);
         m_recentRecvSeqsQueue.pop();
       }
-      m_recentRecvSeqs.try_emplace(pktSequence, now);
-      m_recentRecvSeqsQueue.push(pktSequence);
+      m_recentRecvSeqs.insert(pktSequence);
+      m_recentRecvSeqsQueue.emplace(pktSequence, now);
     }
 
     startIdleAckTimer();
@@ -198,22 +187,18 @@ LpReliability::piggyback(lp::Packet& pkt, ssize_t mtu)
   ssize_t remainingSpace = (mtu == MTU_UNLIMITED ? ndn::MAX_NDN_PACKET_SIZE : mtu) - reservedSpace;
   remainingSpace -= pktSize;
 
-  while (!m_ackQueue.empty()) {
-    lp::Sequence ackTxSeq = m_ackQueue.front();
-    // Ack size = Ack TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) + lp::Sequence (8 octets)
-    const ssize_t ackSize = tlv::sizeOfVarNumber(lp::tlv::Ack) +
-                            tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
-                            sizeof(lp::Sequence);
-
-    if (ackSize > remainingSpace) {
-      break;
-    }
-
-    NFD_LOG_FACE_TRACE("piggybacking ack for remote txseq=" << ackTxSeq);
-
-    pkt.add<lp::AckField>(ackTxSeq);
+  // Ack size = Ack TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) + lp::Sequence (8 octets)
+  constexpr ssize_t ackSize = tlv::sizeOfVarNumber(lp::tlv::Ack) +
+                              tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
+                              sizeof(lp::Sequence);
+  // the number of Acks that fit is computed once, rather than checked before adding each Ack
+  size_t nAcks = remainingSpace > 0 ? std::min<size_t>(m_ackQueue.size(), remainingSpace / ackSize)
+                                    : 0;
+
+  for (size_t i = 0; i < nAcks; ++i) {
+    NFD_LOG_FACE_TRACE("piggybacking ack for remote txseq=" << m_ackQueue.front());
+    pkt.add<lp::AckField>(m_ackQueue.front());
     m_ackQueue.pop();
-    remainingSpace -= ackSize;
   }
 }
 
@@ -222,7 +207,7 @@ LpReliability::assignTxSequence(lp::Packet& frag)
 {
   lp::Sequence txSeq = ++m_lastTxSeqNo;
   frag.set<lp::TxSequenceField>(txSeq);
-  if (!m_unackedFrags.empty() && m_lastTxSeqNo == m_firstUnackedFrag->first) {
+  if (!m_unackedFrags.empty() && m_lastTxSeqNo == m_unackedFrags.begin()->first) {
     NDN_THROW(std::length_error("TxSequence range exceeded"));
   }
   return m_lastTxSeqNo;
@@ -243,20 +228,58 @@ LpReliability::startIdleAckTimer()
   });
 }
 
-std::vector<lp::Sequence>
-LpReliability::findLostLpPackets(LpReliability::UnackedFrags::iterator ackIt)
+void
+LpReliability::startRtoTimer(UnackedFrags::iterator fragIt)
 {
-  std::vector<lp::Sequence> lostLpPackets;
+  auto expiry = time::steady_clock::now() + m_rttEst.getEstimatedRto();
+  m_rtoDeadlines.emplace(expiry, fragIt->first);
 
-  for (auto it = m_firstUnackedFrag; ; ++it) {
-    if (it == m_unackedFrags.end()) {
-      it = m_unackedFrags.begin();
-    }
+  if (!m_rtoTimer || expiry < m_rtoTimerExpiry) {
+    rescheduleRtoTimer();
+  }
+}
 
-    if (it->first == ackIt->first) {
-      break;
+void
+LpReliability::onRtoTimeout()
+{
+  auto now = time::steady_clock::now();
+  while (!m_rtoDeadlines.empty() && m_rtoDeadlines.top().first <= now) {
+    lp::Sequence txSeq = m_rtoDeadlines.top().second;
+    m_rtoDeadlines.pop();
+    // the fragment may have been acknowledged, retransmitted, or dropped in the meantime
+    if (m_unackedFrags.count(txSeq) > 0) {
+      onLpPacketLost(txSeq, true);
     }
+  }
+
+  rescheduleRtoTimer();
+}
+
+void
+LpReliability::rescheduleRtoTimer()
+{
+  // discard the deadlines of fragments that are no longer in flight
+  while (!m_rtoDeadlines.empty() && m_unackedFrags.count(m_rtoDeadlines.top().second) == 0) {
+    m_rtoDeadlines.pop();
+  }
+
+  if (m_rtoDeadlines.empty()) {
+    m_rtoTimer.cancel();
+    return;
+  }
 
+  m_rtoTimerExpiry = m_rtoDeadlines.top().first;
+  m_rtoTimer = getScheduler().schedule(m_rtoTimerExpiry - time::steady_clock::now(),
+                                       [this] { onRtoTimeout(); });
+}
+
+std::vector<lp::Sequence>
+LpReliability::findLostLpPackets(LpReliability::UnackedFrags::iterator ackIt)
+{
+  std::vector<lp::Sequence> lostLpPackets;
+
+  // the window is iterated in TxSequence order, allowing for wraparound
+  for (auto it = m_unackedFrags.begin(); it != ackIt; ++it) {
     auto& unackedFrag = it->second;
     unackedFrag.nGreaterSeqAcks++;
     NFD_LOG_FACE_TRACE("received ack=" << ackIt->first << " before=" << it->first <<
@@ -277,7 +300,6 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
   auto txSeqIt = m_unackedFrags.find(txSeq);
 
   auto& txFrag = txSeqIt->second;
-  txFrag.rtoTimer.cancel();
   auto netPkt = txFrag.netPkt;
   std::vector<lp::Sequence> removedThisTxSeq;
   lp::Sequence seq = txFrag.pkt.get<lp::SequenceField>();
@@ -319,13 +341,11 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
     lp::Sequence newTxSeq = assignTxSequence(txFrag.pkt);
     netPkt->didRetx = true;
 
-    // Move fragment to new TxSequence mapping
-    auto hint = m_firstUnackedFrag != m_unackedFrags.end() && m_firstUnackedFrag->first > newTxSeq
-                ? m_firstUnackedFrag
-                : m_unackedFrags.end();
-    auto newTxFragIt = m_unackedFrags.try_emplace(hint, newTxSeq, txFrag.pkt);
+    // Move fragment to new TxSequence, at the end of the window
+    // (this may grow the window, so txFrag must not be used past this point)
+    auto newTxFragIt = m_unackedFrags.emplace(newTxSeq, txFrag.pkt);
     auto& newTxFrag = newTxFragIt->second;
-    newTxFrag.retxCount = txFrag.retxCount + 1;
+    newTxFrag.retxCount = txSeqIt->second.retxCount + 1;
     newTxFrag.netPkt = netPkt;
 
     // Update associated NetPkt
@@ -341,13 +361,11 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
 
     auto rto = m_rttEst.getEstimatedRto();
     NFD_LOG_FACE_TRACE("retransmitting seq=" << seq << ", txseq=" << newTxSeq << ", retx=" <<
-                       txFrag.retxCount << ", rto=" <<
+                       newTxFrag.retxCount << ", rto=" <<
                        time::duration_cast<time::milliseconds>(rto).count() << "ms");
 
     // Start RTO timer for this sequence
-    newTxFrag.rtoTimer = getScheduler().schedule(rto, [=] {
-      onLpPacketLost(newTxSeq, true);
-    });
+    startRtoTimer(newTxFragIt);
   }
 
   return removedThisTxSeq;
@@ -380,22 +398,7 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
 void
 LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
 {
-  lp::Sequence firstUnackedTxSeq = m_firstUnackedFrag->first;
-  lp::Sequence currentTxSeq = fragIt->first;
-  auto nextFragIt = m_unackedFrags.erase(fragIt);
-
-  if (!m_unackedFrags.empty() && firstUnackedTxSeq == currentTxSeq) {
-    // If "first" fragment in send window (allowing for wraparound), increment window begin
-    if (nextFragIt == m_unackedFrags.end()) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
-    else {
-      m_firstUnackedFrag = nextFragIt;
-    }
-  }
-  else if (m_unackedFrags.empty()) {
-    m_firstUnackedFrag = m_unackedFrags.end();
-  }
+  m_unackedFrags.erase(fragIt);
 }
 
 LpReliability::UnackedFrag::UnackedFrag(lp::Packet pkt)
@@ -406,6 +409,108 @@ LpReliability::UnackedFrag::UnackedFrag(lp::Packet pkt)
 {
 }
 
+LpReliability::UnackedFrags::iterator::reference
+LpReliability::UnackedFrags::iterator::operator*() const
+{
+  BOOST_ASSERT(m_window != nullptr);
+  auto slot = m_window->getSlot(m_txSeq);
+  BOOST_ASSERT(slot != nullptr);
+  return *slot;
+}
+
+LpReliability::UnackedFrags::iterator&
+LpReliability::UnackedFrags::iterator::operator++()
+{
+  BOOST_ASSERT(m_window != nullptr);
+  // skip the empty slots of acknowledged fragments, up to the end of the window
+  for (++m_txSeq; m_txSeq - m_window->m_front < m_window->m_span; ++m_txSeq) {
+    if (m_window->getSlot(m_txSeq) != nullptr) {
+      return *this;
+    }
+  }
+  m_window = nullptr;
+  return *this;
+}
+
+LpReliability::UnackedFrag&
+LpReliability::UnackedFrags::at(lp::Sequence txSeq)
+{
+  auto slot = getSlot(txSeq);
+  if (slot == nullptr) {
+    NDN_THROW(std::out_of_range("TxSequence " + to_string(txSeq) + " is not in the window"));
+  }
+  return slot->second;
+}
+
+LpReliability::UnackedFrags::iterator
+LpReliability::UnackedFrags::emplace(lp::Sequence txSeq, lp::Packet pkt)
+{
+  if (m_size == 0) {
+    m_front = txSeq;
+    m_span = 0;
+  }
+  lp::Sequence offset = txSeq - m_front;
+  BOOST_ASSERT(offset >= m_span);
+
+  if (offset >= m_slots.size()) {
+    grow(offset + 1);
+  }
+  m_slots[txSeq & (m_slots.size() - 1)].emplace(txSeq, UnackedFrag(std::move(pkt)));
+  m_span = offset + 1;
+  ++m_size;
+  return iterator(this, txSeq);
+}
+
+void
+LpReliability::UnackedFrags::erase(iterator it)
+{
+  BOOST_ASSERT(it.m_window == this);
+  lp::Sequence txSeq = it->first;
+  size_t mask = m_slots.size() - 1;
+  m_slots[txSeq & mask].reset();
+  --m_size;
+
+  if (m_size == 0) {
+    m_span = 0;
+    return;
+  }
+
+  if (txSeq == m_front) {
+    // advance the front of the window to the next unacknowledged fragment
+    do {
+      ++m_front;
+      --m_span;
+    } while (!m_slots[m_front & mask]);
+  }
+}
+
+LpReliability::UnackedFrags::value_type*
+LpReliability::UnackedFrags::getSlot(lp::Sequence txSeq) const noexcept
+{
+  if (txSeq - m_front >= m_span) {
+    return nullptr;
+  }
+  auto& slot = m_slots[txSeq & (m_slots.size() - 1)];
+  return slot ? const_cast<value_type*>(&*slot) : nullptr;
+}
+
+void
+LpReliability::UnackedFrags::grow(size_t minCapacity)
+{
+  size_t capacity = std::max<size_t>(m_slots.size(), 64);
+  while (capacity < minCapacity) {
+    capacity *= 2;
+  }
+
+  std::vector<std::optional<value_type>> slots(capacity);
+  for (auto& slot : m_slots) {
+    if (slot) {
+      slots[slot->first & (capacity - 1)].emplace(std::move(*slot));
+    }
+  }
+  m_slots.swap(slots);
+}
+
 LpReliability::NetPkt::NetPkt(lp::Packet&& pkt, bool isInterest)
   : pkt(std::move(pkt))
   , isInterest(isInterest)
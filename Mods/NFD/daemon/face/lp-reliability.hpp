@@ -32,7 +32,9 @@
 #include <ndn-cxx/lp/sequence.hpp>
 #include <ndn-cxx/util/rtt-estimator.hpp>
 
+#include <optional>
 #include <queue>
+#include <unordered_set>
 
 namespace nfd::face {
 
@@ -111,10 +113,178 @@ public:
   piggyback(lp::Packet& pkt, ssize_t mtu);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  class UnackedFrag;
   class NetPkt;
-  using UnackedFrags = std::map<lp::Sequence, UnackedFrag>;
 
+  /**
+   * \brief Contains a sent fragment that has not been acknowledged and associated data.
+   */
+  class UnackedFrag
+  {
+  public:
+    explicit
+    UnackedFrag(lp::Packet pkt);
+
+  public:
+    lp::Packet pkt;
+    time::steady_clock::time_point sendTime;
+    size_t retxCount;
+    size_t nGreaterSeqAcks; //!< number of Acks received for sequences greater than this fragment
+    shared_ptr<NetPkt> netPkt;
+  };
+
+  /**
+   * \brief Sliding window of unacknowledged fragments.
+   *
+   * TxSequence numbers are assigned in increasing order (modulo 2^64), so the fragments in
+   * flight occupy the range [front, front + span) of TxSequences. They are stored in a circular
+   * buffer indexed by TxSequence, in which the slots of acknowledged fragments are left empty
+   * until the front of the window moves past them. The buffer only grows, by doubling, when
+   * the window outgrows it; otherwise slots are reused without any allocation.
+   *
+   * Iteration visits the fragments in TxSequence order starting at the front of the window,
+   * which accounts for wraparound. An iterator refers to a fragment by its TxSequence, so it
+   * remains valid until that fragment is erased, even if the buffer grows in the meantime.
+   */
+  class UnackedFrags
+  {
+  public:
+    using value_type = std::pair<const lp::Sequence, UnackedFrag>;
+
+    class iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = UnackedFrags::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = value_type*;
+      using reference = value_type&;
+
+      iterator() = default;
+
+      reference
+      operator*() const;
+
+      pointer
+      operator->() const
+      {
+        return &**this;
+      }
+
+      iterator&
+      operator++();
+
+      friend bool
+      operator==(const iterator& lhs, const iterator& rhs) noexcept
+      {
+        return lhs.m_window == rhs.m_window &&
+               (lhs.m_window == nullptr || lhs.m_txSeq == rhs.m_txSeq);
+      }
+
+      friend bool
+      operator!=(const iterator& lhs, const iterator& rhs) noexcept
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+      iterator(UnackedFrags* window, lp::Sequence txSeq) noexcept
+        : m_window(window)
+        , m_txSeq(txSeq)
+      {
+      }
+
+    private:
+      UnackedFrags* m_window = nullptr; // nullptr for the past-the-end iterator
+      lp::Sequence m_txSeq = 0;
+
+      friend UnackedFrags;
+    };
+
+    size_t
+    size() const noexcept
+    {
+      return m_size;
+    }
+
+    bool
+    empty() const noexcept
+    {
+      return m_size == 0;
+    }
+
+    size_t
+    count(lp::Sequence txSeq) const noexcept
+    {
+      return getSlot(txSeq) != nullptr;
+    }
+
+    /** \brief Returns an iterator to the fragment at the front of the window.
+     */
+    iterator
+    begin() noexcept
+    {
+      return m_size == 0 ? end() : iterator(this, m_front);
+    }
+
+    iterator
+    end() noexcept
+    {
+      return {};
+    }
+
+    iterator
+    find(lp::Sequence txSeq) noexcept
+    {
+      return getSlot(txSeq) == nullptr ? end() : iterator(this, txSeq);
+    }
+
+    /** \throw std::out_of_range no fragment with TxSequence \p txSeq
+     */
+    UnackedFrag&
+    at(lp::Sequence txSeq);
+
+    /** \brief Append a fragment after the end of the window.
+     *  \pre txSeq is not within the window
+     */
+    iterator
+    emplace(lp::Sequence txSeq, lp::Packet pkt);
+
+    /** \brief Remove a fragment, and advance the front of the window if it was the first one.
+     *  \pre it is dereferenceable
+     */
+    void
+    erase(iterator it);
+
+  private:
+    value_type*
+    getSlot(lp::Sequence txSeq) const noexcept;
+
+    void
+    grow(size_t minCapacity);
+
+  private:
+    std::vector<std::optional<value_type>> m_slots; // size is zero or a power of two
+    lp::Sequence m_front = 0;
+    size_t m_span = 0;
+    size_t m_size = 0;
+  };
+
+  /**
+   * \brief Contains a network-layer packet with unacknowledged fragments.
+   */
+  class NetPkt
+  {
+  public:
+    NetPkt(lp::Packet&& pkt, bool isInterest);
+
+  public:
+    std::vector<UnackedFrags::iterator> unackedFrags;
+    lp::Packet pkt;
+    bool isInterest;
+    bool didRetx;
+  };
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief Assign TxSequence number to a fragment.
    *  \param frag fragment to assign TxSequence to
    *  \return assigned TxSequence number
@@ -132,6 +302,27 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   startIdleAckTimer();
 
+  /** \brief Set the retransmission deadline of a fragment that has just been (re)transmitted.
+   *
+   * Deadlines are kept in a min-heap served by a single per-link timer, which is armed for the
+   * earliest deadline. Entries of fragments that are acknowledged before their deadline are not
+   * removed from the heap; they are skipped when they reach its top.
+   */
+  void
+  startRtoTimer(UnackedFrags::iterator fragIt);
+
+  /** \brief Handle the expiration of the retransmission timer.
+   *
+   * Every fragment whose deadline has passed is considered lost, then the timer is re-armed.
+   */
+  void
+  onRtoTimeout();
+
+  /** \brief Arm the retransmission timer for the earliest deadline of an unacknowledged fragment.
+   */
+  void
+  rescheduleRtoTimer();
+
   /** \brief Find and mark as lost fragments where a configurable number of Acks
    *         (Options::seqNumLossThreshold) have been received for greater TxSequence numbers.
    *  \param ackIt iterator pointing to acknowledged fragment
@@ -146,8 +337,8 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::vector<lp::Sequence>
   onLpPacketLost(lp::Sequence txSeq, bool isTimeout);
 
-  /** \brief Remove the fragment with the given sequence number from the map of unacknowledged
-   *         fragments, as well as its associated network packet (if any).
+  /** \brief Remove the fragment with the given sequence number from the window of
+   *         unacknowledged fragments, as well as its associated network packet (if any).
    *  \param fragIt iterator to acknowledged fragment
    *
    *  If the given TxSequence marks the beginning of the send window, the window will be incremented.
@@ -159,58 +350,25 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief Delete a fragment from UnackedFrags and advance acknowledge window if necessary.
    *  \param fragIt iterator to an UnackedFrag, must be dereferencable
    *  \post fragIt is not in m_unackedFrags
-   *  \post if was equal to m_firstUnackedFrag,
-   *        m_firstUnackedFrag is set to the UnackedFrag after fragIt with consideration of
-   *        TxSequence number wraparound, or set to m_unackedFrags.end() if m_unackedFrags is empty
    */
   void
   deleteUnackedFrag(UnackedFrags::iterator fragIt);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  /**
-   * \brief Contains a sent fragment that has not been acknowledged and associated data.
-   */
-  class UnackedFrag
-  {
-  public:
-    explicit
-    UnackedFrag(lp::Packet pkt);
-
-  public:
-    lp::Packet pkt;
-    scheduler::ScopedEventId rtoTimer;
-    time::steady_clock::time_point sendTime;
-    size_t retxCount;
-    size_t nGreaterSeqAcks; //!< number of Acks received for sequences greater than this fragment
-    shared_ptr<NetPkt> netPkt;
-  };
-
-  /**
-   * \brief Contains a network-layer packet with unacknowledged fragments.
-   */
-  class NetPkt
-  {
-  public:
-    NetPkt(lp::Packet&& pkt, bool isInterest);
-
-  public:
-    std::vector<UnackedFrags::iterator> unackedFrags;
-    lp::Packet pkt;
-    bool isInterest;
-    bool didRetx;
-  };
+  using RtoDeadline = std::pair<time::steady_clock::time_point, lp::Sequence>;
 
   Options m_options;
   GenericLinkService* m_linkService;
   UnackedFrags m_unackedFrags;
-  // An iterator that points to the first unacknowledged fragment in the current window. The window
-  // can wrap around so that the beginning of the window is at a TxSequence greater than other
-  // fragments in the window. When the window is moved past the last item in the iterator, the
-  // first fragment in the map will become the start of the window.
-  UnackedFrags::iterator m_firstUnackedFrag;
+  // deadlines of unacknowledged fragments, earliest first; may contain entries of fragments
+  // that have since been acknowledged or retransmitted under a new TxSequence
+  std::priority_queue<RtoDeadline, std::vector<RtoDeadline>, std::greater<>> m_rtoDeadlines;
+  scheduler::ScopedEventId m_rtoTimer;
+  time::steady_clock::time_point m_rtoTimerExpiry;
   std::queue<lp::Sequence> m_ackQueue;
-  std::map<lp::Sequence, time::steady_clock::time_point> m_recentRecvSeqs;
-  std::queue<lp::Sequence> m_recentRecvSeqsQueue;
+  std::unordered_set<lp::Sequence> m_recentRecvSeqs;
+  // received Sequences with their arrival time, oldest first
+  std::queue<std::pair<lp::Sequence, time::steady_clock::time_point>> m_recentRecvSeqsQueue;
   lp::Sequence m_lastTxSeqNo;
   scheduler::ScopedEventId m_idleAckTimer;
   ndn::util::RttEstimator m_rttEst;
@@ -49,8 +49,9 @@ NFD_LOG_INIT(MulticastEthernetTransport);
 
 MulticastEthernetTransport::MulticastEthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
                                                        const ethernet::Address& mcastAddress,
-                                                       ndn::nfd::LinkType linkType)
-  : EthernetTransport(localEndpoint, mcastAddress)
+                                                       ndn::nfd::LinkType linkType,
+                                                       EthernetIoMode ioMode)
+  : EthernetTransport(localEndpoint, mcastAddress, ioMode)
 #if defined(__linux__)
   , m_interfaceIndex(localEndpoint.getIndex())
 #endif
@@ -72,7 +73,7 @@ MulticastEthernetTransport::MulticastEthernetTransport(const ndn::net::NetworkIn
                 ethernet::ETHERTYPE_NDN,
                 m_destAddress.toString().data(),
                 m_srcAddress.toString().data());
-  m_pcap.setPacketFilter(filter);
+  setPacketFilter(filter);
 
   BOOST_ASSERT(m_destAddress.isMulticast());
   if (!m_destAddress.isBroadcast()) {
@@ -206,6 +206,17 @@ Transport::setState(TransportState newState)
 
   TransportState oldState = m_state;
   m_state = newState;
+
+  if (IoThread* ioThread = m_face == nullptr ? nullptr : m_face->getIoThread();
+      ioThread != nullptr) {
+    ioThread->postToParent([face = m_face->weak_from_this(), oldState, newState] {
+      if (auto f = face.lock()) {
+        f->afterStateChange(oldState, newState);
+      }
+    });
+    return;
+  }
+
   afterStateChange(oldState, newState);
   // warning: don't access any members after this:
   // the Transport may be deallocated in the signal handler if newState is CLOSED
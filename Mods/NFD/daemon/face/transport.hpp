@@ -290,7 +290,7 @@ public: // dynamic properties
   TransportState
   getState() const noexcept
   {
-    return m_state;
+    return m_state.load(std::memory_order_relaxed);
   }
 
   /**
@@ -305,7 +305,7 @@ public: // dynamic properties
   time::steady_clock::time_point
   getExpirationTime() const noexcept
   {
-    return m_expirationTime;
+    return m_expirationTime.load(std::memory_order_relaxed);
   }
 
   /**
@@ -376,7 +376,7 @@ protected: // properties to be set by subclass
   void
   setExpirationTime(const time::steady_clock::time_point& expirationTime) noexcept
   {
-    m_expirationTime = expirationTime;
+    m_expirationTime.store(expirationTime, std::memory_order_relaxed);
   }
 
 protected: // to be overridden by subclass
@@ -427,8 +427,9 @@ private:
   ndn::nfd::LinkType m_linkType = ndn::nfd::LINK_TYPE_NONE;
   ssize_t m_mtu = MTU_INVALID;
   ssize_t m_sendQueueCapacity = QUEUE_UNSUPPORTED;
-  TransportState m_state = TransportState::UP;
-  time::steady_clock::time_point m_expirationTime = time::steady_clock::time_point::max();
+  // state and expiration time are observed by the parent thread of a face bound to an IoThread
+  std::atomic<TransportState> m_state{TransportState::UP};
+  std::atomic<time::steady_clock::time_point> m_expirationTime{time::steady_clock::time_point::max()};
 };
 
 std::ostream&
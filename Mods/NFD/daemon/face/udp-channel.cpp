@@ -31,6 +31,8 @@
 
 #include <boost/asio/ip/v6_only.hpp>
 
+#include <sys/socket.h> // for SO_REUSEPORT
+
 namespace nfd::face {
 
 NFD_LOG_INIT(UdpChannel);
@@ -40,15 +42,43 @@ namespace ip = boost::asio::ip;
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        time::nanoseconds idleTimeout,
                        bool wantCongestionMarking,
-                       size_t defaultMtu)
+                       size_t defaultMtu,
+                       std::vector<shared_ptr<FaceGroup>> faceGroups)
   : m_localEndpoint(localEndpoint)
-  , m_socket(getGlobalIoService())
+  , m_faceGroups(std::move(faceGroups))
   , m_idleFaceTimeout(idleTimeout)
   , m_wantCongestionMarking(wantCongestionMarking)
 {
   setUri(FaceUri(m_localEndpoint));
   setDefaultMtu(defaultMtu);
-  NFD_LOG_CHAN_INFO("Creating channel");
+  NFD_LOG_CHAN_INFO("Creating channel with " << m_faceGroups.size() << " I/O threads");
+}
+
+UdpChannel::~UdpChannel()
+{
+  if (m_faceGroups.empty()) {
+    return;
+  }
+
+  // close the listening sockets in their threads, then wait until the aborted receive
+  // handlers and any other handlers that refer to this channel have run
+  for (const auto& listener : m_listeners) {
+    listener->ioThread->runAndWait([&listener] {
+      boost::system::error_code error;
+      listener->socket.close(error);
+    });
+  }
+  for (const auto& group : m_faceGroups) {
+    group->getIoThread().runAndWait([] {});
+  }
+  m_listeners.clear();
+}
+
+size_t
+UdpChannel::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_channelFaces.size();
 }
 
 void
@@ -57,9 +87,57 @@ UdpChannel::connect(const udp::Endpoint& remoteEndpoint,
                     const FaceCreatedCallback& onFaceCreated,
                     const FaceCreationFailedCallback& onConnectFailed)
 {
+  if (!m_faceGroups.empty()) {
+    shared_ptr<Face> face;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_channelFaces.find(remoteEndpoint);
+      if (it != m_channelFaces.end()) {
+        face = it->second;
+      }
+    }
+    if (face != nullptr) {
+      NFD_LOG_CHAN_TRACE("Reusing existing face for " << remoteEndpoint);
+      onFaceCreated(face);
+      return;
+    }
+
+    // the face must be constructed in the IoThread that will run it
+    FaceGroup* group = m_faceGroups[m_nextFaceGroup++ % m_faceGroups.size()].get();
+    IoThread* ioThread = &group->getIoThread();
+    ioThread->post([=, self = weak_from_this()] {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      try {
+        auto [isCreated, face] = createFace(remoteEndpoint, params, group);
+        // posted while holding the lock, see handleNewPeer
+        ioThread->postToParent([=, face = std::move(face), isCreated = isCreated] {
+          if (self.expired())
+            return;
+          if (isCreated)
+            registerFace(face, remoteEndpoint);
+          onFaceCreated(face);
+        });
+      }
+      catch (const boost::system::system_error& e) {
+        NFD_LOG_CHAN_DEBUG("Face creation for " << remoteEndpoint << " failed: " << e.what());
+        ioThread->postToParent([self, onConnectFailed, what = std::string(e.what())] {
+          if (!self.expired() && onConnectFailed)
+            onConnectFailed(504, "Face creation failed: " + what);
+        });
+      }
+    });
+    return;
+  }
+
   shared_ptr<Face> face;
   try {
-    face = createFace(remoteEndpoint, params).second;
+    bool isCreated = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      std::tie(isCreated, face) = createFace(remoteEndpoint, params, nullptr);
+    }
+    if (isCreated)
+      registerFace(face, remoteEndpoint);
   }
   catch (const boost::system::system_error& e) {
     NFD_LOG_CHAN_DEBUG("Face creation for " << remoteEndpoint << " failed: " << e.what());
@@ -82,29 +160,85 @@ UdpChannel::listen(const FaceCreatedCallback& onFaceCreated,
     return;
   }
 
-  m_socket.open(m_localEndpoint.protocol());
-  m_socket.set_option(ip::udp::socket::reuse_address(true));
-  if (m_localEndpoint.address().is_v6()) {
-    m_socket.set_option(ip::v6_only(true));
+  if (m_faceGroups.empty()) {
+    m_listeners.push_back(make_unique<Listener>(nullptr, getGlobalIoService()));
+  }
+  else {
+    for (const auto& group : m_faceGroups) {
+      auto& io = group->getIoThread().getIoService();
+      m_listeners.push_back(make_unique<Listener>(group.get(), io));
+    }
   }
-  m_socket.bind(m_localEndpoint);
 
-  waitForNewPeer(onFaceCreated, onFaceCreationFailed);
+  try {
+    for (const auto& listener : m_listeners) {
+      openListener(*listener);
+    }
+  }
+  catch (const boost::system::system_error&) {
+    for (const auto& listener : m_listeners) {
+      boost::system::error_code error;
+      listener->socket.close(error);
+    }
+    m_listeners.clear();
+    throw;
+  }
+
+  for (const auto& listener : m_listeners) {
+    if (listener->ioThread == nullptr) {
+      waitForNewPeer(*listener, onFaceCreated, onFaceCreationFailed);
+    }
+    else {
+      listener->ioThread->post([=, &listener = *listener] {
+        waitForNewPeer(listener, onFaceCreated, onFaceCreationFailed);
+      });
+    }
+  }
   NFD_LOG_CHAN_DEBUG("Started listening");
 }
 
 void
-UdpChannel::waitForNewPeer(const FaceCreatedCallback& onFaceCreated,
+UdpChannel::openListener(Listener& listener)
+{
+  auto& socket = listener.socket;
+  socket.open(m_localEndpoint.protocol());
+  socket.set_option(ip::udp::socket::reuse_address(true));
+  if (listener.ioThread != nullptr) {
+    // Let the kernel spread new peers across the listening sockets. The per-face sockets are
+    // connected and bound with SO_REUSEADDR only, so that they always take precedence.
+#ifdef SO_REUSEPORT
+    const int value = 1;
+    if (::setsockopt(socket.native_handle(), SOL_SOCKET, SO_REUSEPORT, &value, sizeof(value)) < 0) {
+      NDN_THROW(boost::system::system_error(errno, boost::system::system_category(),
+                                            "setsockopt(SO_REUSEPORT)"));
+    }
+#else
+    NDN_THROW(boost::system::system_error(boost::asio::error::operation_not_supported,
+                                          "SO_REUSEPORT"));
+#endif
+  }
+  if (m_localEndpoint.address().is_v6()) {
+    socket.set_option(ip::v6_only(true));
+  }
+  socket.bind(m_localEndpoint);
+}
+
+void
+UdpChannel::waitForNewPeer(Listener& listener,
+                           const FaceCreatedCallback& onFaceCreated,
                            const FaceCreationFailedCallback& onReceiveFailed)
 {
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_remoteEndpoint,
-                              [=] (auto&&... args) {
-                                this->handleNewPeer(std::forward<decltype(args)>(args)..., onFaceCreated, onReceiveFailed);
-                              });
+  listener.socket.async_receive_from(boost::asio::buffer(listener.receiveBuffer),
+                                     listener.remoteEndpoint,
+                                     [=, &listener] (auto&&... args) {
+                                       this->handleNewPeer(listener, std::forward<decltype(args)>(args)...,
+                                                           onFaceCreated, onReceiveFailed);
+                                     });
 }
 
 void
-UdpChannel::handleNewPeer(const boost::system::error_code& error,
+UdpChannel::handleNewPeer(Listener& listener,
+                          const boost::system::error_code& error,
                           size_t nBytesReceived,
                           const FaceCreatedCallback& onFaceCreated,
                           const FaceCreationFailedCallback& onReceiveFailed)
@@ -112,44 +246,91 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
   if (error) {
     if (error != boost::asio::error::operation_aborted) {
       NFD_LOG_CHAN_DEBUG("Receive failed: " << error.message());
-      if (onReceiveFailed)
-        onReceiveFailed(500, "Receive failed: " + error.message());
+      runInChannelThread(listener.ioThread, [=] {
+        if (onReceiveFailed)
+          onReceiveFailed(500, "Receive failed: " + error.message());
+      });
     }
     return;
   }
 
-  NFD_LOG_CHAN_TRACE("New peer " << m_remoteEndpoint);
+  const udp::Endpoint remoteEndpoint = listener.remoteEndpoint;
+  NFD_LOG_CHAN_TRACE("New peer " << remoteEndpoint);
 
-  bool isCreated = false;
-  shared_ptr<Face> face;
-  try {
-    FaceParams params;
-    params.persistency = ndn::nfd::FACE_PERSISTENCY_ON_DEMAND;
-    params.mtu = getDefaultMtu();
-    std::tie(isCreated, face) = createFace(m_remoteEndpoint, params);
-  }
-  catch (const boost::system::system_error& e) {
-    NFD_LOG_CHAN_DEBUG("Face creation for " << m_remoteEndpoint << " failed: " << e.what());
-    if (onReceiveFailed)
-      onReceiveFailed(504, "Face creation failed: "s + e.what());
-    return;
+  auto datagram = ndn::make_span(listener.receiveBuffer).first(nBytesReceived);
+  UnicastUdpTransport* transport = nullptr;
+  shared_ptr<Face> newFace; // only set if the listener runs in the channel's thread
+  {
+    // While the lock is held, m_channelFaces keeps the face alive. A face in a FaceGroup
+    // must be released by the channel's thread, so an IoThread may only refer to it while
+    // holding the lock, and afterwards through its transport if the face runs in that thread.
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    bool isCreated = false;
+    shared_ptr<Face> face;
+    try {
+      FaceParams params;
+      params.persistency = ndn::nfd::FACE_PERSISTENCY_ON_DEMAND;
+      params.mtu = getDefaultMtu();
+      std::tie(isCreated, face) = createFace(remoteEndpoint, params, listener.group);
+    }
+    catch (const boost::system::system_error& e) {
+      lock.unlock();
+      NFD_LOG_CHAN_DEBUG("Face creation for " << remoteEndpoint << " failed: " << e.what());
+      runInChannelThread(listener.ioThread, [onReceiveFailed, what = std::string(e.what())] {
+        if (onReceiveFailed)
+          onReceiveFailed(504, "Face creation failed: " + what);
+      });
+      waitForNewPeer(listener, onFaceCreated, onReceiveFailed);
+      return;
+    }
+
+    if (!isCreated) {
+      NFD_LOG_CHAN_DEBUG("Received datagram for existing face");
+    }
+    else if (listener.ioThread == nullptr) {
+      newFace = face;
+    }
+    else {
+      listener.ioThread->postToParent([this, self = weak_from_this(), face, remoteEndpoint,
+                                       onFaceCreated] {
+        if (self.expired())
+          return;
+        registerFace(face, remoteEndpoint);
+        onFaceCreated(face);
+      });
+    }
+
+    if (face->getFaceGroup() == listener.group) {
+      transport = static_cast<UnicastUdpTransport*>(face->getTransport());
+    }
+    else {
+      // the face was created by connect() in another FaceGroup
+      auto buffer = std::make_shared<ndn::Buffer>(datagram.begin(), datagram.end());
+      auto faceTransport = static_cast<UnicastUdpTransport*>(face->getTransport());
+      face->getIoThread()->post([transport = faceTransport, buffer = std::move(buffer)] {
+        transport->receiveDatagram(*buffer, {});
+      });
+    }
   }
 
-  if (isCreated)
-    onFaceCreated(face);
-  else
-    NFD_LOG_CHAN_DEBUG("Received datagram for existing face");
+  if (newFace != nullptr) {
+    registerFace(newFace, remoteEndpoint);
+    onFaceCreated(newFace);
+  }
 
   // dispatch the datagram to the face for processing
-  auto* transport = static_cast<UnicastUdpTransport*>(face->getTransport());
-  transport->receiveDatagram(ndn::make_span(m_receiveBuffer).first(nBytesReceived), error);
+  if (transport != nullptr) {
+    transport->receiveDatagram(datagram, error);
+  }
 
-  waitForNewPeer(onFaceCreated, onReceiveFailed);
+  waitForNewPeer(listener, onFaceCreated, onReceiveFailed);
 }
 
 std::pair<bool, shared_ptr<Face>>
 UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
-                       const FaceParams& params)
+                       const FaceParams& params,
+                       FaceGroup* group)
 {
   auto it = m_channelFaces.find(remoteEndpoint);
   if (it != m_channelFaces.end()) {
@@ -186,16 +367,40 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
 
   options.overrideMtu = params.mtu.value_or(getDefaultMtu());
 
+  shared_ptr<FaceGroup> faceGroup;
+  if (group != nullptr) {
+    auto g = std::find_if(m_faceGroups.begin(), m_faceGroups.end(),
+                          [group] (const auto& g) { return g.get() == group; });
+    BOOST_ASSERT(g != m_faceGroups.end());
+    faceGroup = *g;
+  }
+
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<UnicastUdpTransport>(std::move(socket), params.persistency,
                                                     m_idleFaceTimeout);
-  auto face = make_shared<Face>(std::move(linkService), std::move(transport));
+  auto face = make_shared<Face>(std::move(linkService), std::move(transport), std::move(faceGroup));
   face->setChannel(weak_from_this());
 
   m_channelFaces[remoteEndpoint] = face;
-  connectFaceClosedSignal(*face, [this, remoteEndpoint] { m_channelFaces.erase(remoteEndpoint); });
-
   return {true, face};
 }
 
+void
+UdpChannel::registerFace(const shared_ptr<Face>& face, const udp::Endpoint& remoteEndpoint)
+{
+  connectFaceClosedSignal(*face, [this, remoteEndpoint] {
+    shared_ptr<Face> closedFace;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_channelFaces.find(remoteEndpoint);
+      if (it != m_channelFaces.end()) {
+        closedFace = std::move(it->second);
+        m_channelFaces.erase(it);
+      }
+    }
+    // closedFace is released outside the lock, because destroying a face in a FaceGroup
+    // waits for the group's IoThread, which may be waiting for the lock
+  });
+}
+
 } // namespace nfd::face
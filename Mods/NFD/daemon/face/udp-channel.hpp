@@ -27,14 +27,23 @@
 #define NFD_DAEMON_FACE_UDP_CHANNEL_HPP
 
 #include "channel.hpp"
+#include "face-group.hpp"
 #include "udp-protocol.hpp"
 
 #include <array>
+#include <mutex>
 
 namespace nfd::face {
 
 /**
  * \brief Class implementing UDP-based channel to create faces
+ *
+ * The channel either runs in the calling thread, or spreads its work over a set of FaceGroups.
+ * In the latter case, the channel opens one SO_REUSEPORT listening socket per group, the
+ * kernel hashes new remote endpoints across those sockets, and each face joins the group of
+ * the socket that received its first datagram. Faces created by connect() are assigned to
+ * the groups in round-robin order. In either case, callbacks are invoked in the thread that
+ * created the channel.
  */
 class UdpChannel final : public Channel
 {
@@ -45,22 +54,34 @@ public:
    * To enable creation of faces upon incoming connections,
    * one needs to explicitly call UdpChannel::listen method.
    * The created socket is bound to \p localEndpoint.
+   *
+   * \param faceGroups the FaceGroups whose IoThreads receive datagrams and run the faces;
+   *                   if empty, everything runs in the calling thread
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              time::nanoseconds idleTimeout,
              bool wantCongestionMarking,
-             size_t defaultMtu);
+             size_t defaultMtu,
+             std::vector<shared_ptr<FaceGroup>> faceGroups = {});
+
+  ~UdpChannel() final;
 
   bool
   isListening() const final
   {
-    return m_socket.is_open();
+    return !m_listeners.empty();
   }
 
   size_t
-  size() const final
+  size() const final;
+
+  /**
+   * \brief Returns the FaceGroups used by this channel
+   */
+  const std::vector<shared_ptr<FaceGroup>>&
+  getFaceGroups() const noexcept
   {
-    return m_channelFaces.size();
+    return m_faceGroups;
   }
 
   /**
@@ -88,8 +109,31 @@ public:
          const FaceCreationFailedCallback& onFaceCreationFailed);
 
 private:
+  /**
+   * \brief A socket used to "accept" new peers, and the FaceGroup in which it is used
+   */
+  struct Listener
+  {
+    Listener(FaceGroup* group, boost::asio::io_service& io)
+      : group(group)
+      , ioThread(group == nullptr ? nullptr : &group->getIoThread())
+      , socket(io)
+    {
+    }
+
+    FaceGroup* group; ///< nullptr if the listener runs in the channel's thread
+    IoThread* ioThread; ///< the IoThread of group, or nullptr
+    boost::asio::ip::udp::socket socket;
+    udp::Endpoint remoteEndpoint; ///< The latest peer that started communicating with us
+    std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> receiveBuffer;
+  };
+
+  void
+  openListener(Listener& listener);
+
   void
-  waitForNewPeer(const FaceCreatedCallback& onFaceCreated,
+  waitForNewPeer(Listener& listener,
+                 const FaceCreatedCallback& onFaceCreated,
                  const FaceCreationFailedCallback& onReceiveFailed);
 
   /**
@@ -97,20 +141,50 @@ private:
    *        endpoint not associated with any UDP face yet
    */
   void
-  handleNewPeer(const boost::system::error_code& error,
+  handleNewPeer(Listener& listener,
+                const boost::system::error_code& error,
                 size_t nBytesReceived,
                 const FaceCreatedCallback& onFaceCreated,
                 const FaceCreationFailedCallback& onReceiveFailed);
 
+  /**
+   * \brief Find or create the face toward \p remoteEndpoint
+   * \pre m_mutex is held
+   * \pre if \p group is not nullptr, this is invoked in the IoThread of \p group
+   */
   std::pair<bool, shared_ptr<Face>>
   createFace(const udp::Endpoint& remoteEndpoint,
-             const FaceParams& params);
+             const FaceParams& params,
+             FaceGroup* group);
+
+  /**
+   * \brief Prepare a newly created face for use by the channel's thread
+   */
+  void
+  registerFace(const shared_ptr<Face>& face, const udp::Endpoint& remoteEndpoint);
+
+  /**
+   * \brief Invoke \p f in the channel's thread, posting it from \p ioThread if necessary
+   */
+  template<typename F>
+  static void
+  runInChannelThread(IoThread* ioThread, F&& f)
+  {
+    if (ioThread != nullptr) {
+      ioThread->postToParent(std::forward<F>(f));
+    }
+    else {
+      f();
+    }
+  }
 
 private:
   const udp::Endpoint m_localEndpoint;
-  udp::Endpoint m_remoteEndpoint; ///< The latest peer that started communicating with us
-  boost::asio::ip::udp::socket m_socket; ///< Socket used to "accept" new peers
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  const std::vector<shared_ptr<FaceGroup>> m_faceGroups;
+  size_t m_nextFaceGroup = 0;
+  std::vector<unique_ptr<Listener>> m_listeners;
+  /// Guards m_channelFaces, which is accessed by the listeners in the IoThreads of the groups
+  mutable std::mutex m_mutex;
   std::map<udp::Endpoint, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
   bool m_wantCongestionMarking;
@@ -32,6 +32,8 @@
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm/copy.hpp>
 
+#include <sys/socket.h> // for SO_REUSEPORT
+
 namespace nfd::face {
 
 namespace ip = boost::asio::ip;
@@ -67,6 +69,7 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   enable_v6 yes
   //   idle_timeout 600
   //   unicast_mtu 8800
+  //   io_threads 0
   //   mcast yes
   //   mcast_group 224.0.23.170
   //   mcast_port 56363
@@ -90,6 +93,7 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   bool enableV6 = false;
   uint32_t idleTimeout = 600;
   size_t unicastMtu = ndn::MAX_NDN_PACKET_SIZE;
+  size_t nIoThreads = 0;
   MulticastConfig mcastConfig;
 
   if (configSection) {
@@ -120,6 +124,15 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
         ConfigFile::checkRange(unicastMtu, static_cast<size_t>(MIN_MTU), ndn::MAX_NDN_PACKET_SIZE,
                                "unicast_mtu", "face_system.udp");
       }
+      else if (key == "io_threads") {
+        nIoThreads = ConfigFile::parseNumber<size_t>(pair, "face_system.udp");
+        ConfigFile::checkRange(nIoThreads, size_t{0}, size_t{64}, "io_threads", "face_system.udp");
+#ifndef SO_REUSEPORT
+        if (nIoThreads > 0) {
+          NDN_THROW(ConfigFile::Error("face_system.udp.io_threads is not supported on this platform"));
+        }
+#endif
+      }
       else if (key == "keep_alive_interval") {
         // ignored
       }
@@ -186,6 +199,16 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
 
   m_defaultUnicastMtu = unicastMtu;
 
+  if (m_channels.empty()) {
+    m_faceGroups.clear();
+    for (size_t i = 0; i < nIoThreads; ++i) {
+      m_faceGroups.push_back(make_shared<FaceGroup>());
+    }
+  }
+  else if (m_faceGroups.size() != nIoThreads) {
+    NFD_LOG_WARN("Cannot change the number of I/O threads of existing UDP channels");
+  }
+
   if (enableV4) {
     udp::Endpoint endpoint(ip::udp::v4(), port);
     shared_ptr<UdpChannel> v4Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
@@ -312,7 +335,8 @@ UdpFactory::createChannel(const udp::Endpoint& localEndpoint,
   }
 
   auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout,
-                                              m_wantCongestionMarking, m_defaultUnicastMtu);
+                                              m_wantCongestionMarking, m_defaultUnicastMtu,
+                                              m_faceGroups);
   m_channels[localEndpoint] = channel;
   return channel;
 }
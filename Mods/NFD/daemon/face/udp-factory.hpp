@@ -121,6 +121,7 @@ private:
 private:
   bool m_wantCongestionMarking = false;
   size_t m_defaultUnicastMtu = ndn::MAX_NDN_PACKET_SIZE;
+  std::vector<shared_ptr<FaceGroup>> m_faceGroups; ///< shared by all unicast channels
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
 
   struct MulticastConfig
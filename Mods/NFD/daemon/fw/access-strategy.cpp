@@ -59,6 +59,11 @@ void
 AccessStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                                      const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (interest.isReflexiveInterestFromProducer()) {
+    this->sendReflexiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
   switch (auto res = m_retxSuppression.decidePerPitEntry(*pitEntry); res) {
   case RetxSuppressionResult::NEW:
     return afterReceiveNewInterest(interest, ingress, pitEntry);
@@ -51,26 +51,39 @@ FaceInfo::cancelTimeout(const Name& prefix)
 FaceInfo*
 NamespaceInfo::getFaceInfo(FaceId faceId)
 {
-  auto it = m_fiMap.find(faceId);
-  return it != m_fiMap.end() ? &it->second : nullptr;
+  auto it = std::lower_bound(m_faceIds.begin(), m_faceIds.end(), faceId);
+  if (it == m_faceIds.end() || *it != faceId) {
+    return nullptr;
+  }
+  return m_faceInfos[it - m_faceIds.begin()].get();
 }
 
 FaceInfo&
 NamespaceInfo::getOrCreateFaceInfo(FaceId faceId)
 {
-  auto [it, isNew] = m_fiMap.try_emplace(faceId, m_rttEstimatorOpts);
-  auto& faceInfo = it->second;
-  if (isNew) {
-    extendFaceInfoLifetime(faceInfo, faceId);
+  auto it = std::lower_bound(m_faceIds.begin(), m_faceIds.end(), faceId);
+  auto index = it - m_faceIds.begin();
+  if (it != m_faceIds.end() && *it == faceId) {
+    return *m_faceInfos[index];
   }
+
+  m_faceIds.insert(it, faceId);
+  auto& faceInfo = *m_faceInfos.insert(m_faceInfos.begin() + index,
+                                       make_unique<FaceInfo>(m_rttEstimatorOpts))->get();
+  extendFaceInfoLifetime(faceInfo, faceId);
   return faceInfo;
 }
 
 void
 NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, FaceId faceId)
 {
-  info.m_measurementExpiration = getScheduler().schedule(AsfMeasurements::MEASUREMENTS_LIFETIME,
-                                                         [=] { m_fiMap.erase(faceId); });
+  info.m_measurementExpiration = getScheduler().schedule(AsfMeasurements::MEASUREMENTS_LIFETIME, [=] {
+    auto it = std::lower_bound(m_faceIds.begin(), m_faceIds.end(), faceId);
+    if (it != m_faceIds.end() && *it == faceId) {
+      m_faceInfos.erase(m_faceInfos.begin() + (it - m_faceIds.begin()));
+      m_faceIds.erase(it);
+    }
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -134,6 +147,20 @@ AsfMeasurements::getOrCreateNamespaceInfo(const fib::Entry& fibEntry, const Name
   return *info;
 }
 
+NamespaceInfo*
+AsfMeasurements::getOrCreateNamespaceInfo(const Name& prefix)
+{
+  auto* me = m_measurements.get(prefix);
+  if (me == nullptr) {
+    return nullptr;
+  }
+
+  // Set or update entry lifetime
+  extendLifetime(*me);
+
+  return me->insertStrategyInfo<NamespaceInfo>(m_rttEstimatorOpts).first;
+}
+
 void
 AsfMeasurements::extendLifetime(measurements::Entry& me)
 {
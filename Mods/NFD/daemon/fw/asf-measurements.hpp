@@ -31,8 +31,6 @@
 
 #include <ndn-cxx/util/rtt-estimator.hpp>
 
-#include <unordered_map>
-
 namespace nfd::fw::asf {
 
 /** \brief Strategy information for each face in a namespace
@@ -63,15 +61,29 @@ public:
   {
     m_lastRtt = rtt;
     m_rttEstimator.addMeasurement(rtt);
+    m_rankingValue = getSrtt();
   }
 
   void
   recordTimeout(const Name& interestName)
   {
     m_lastRtt = RTT_TIMEOUT;
+    m_rankingValue = RANKING_VALUE_TIMEOUT;
     cancelTimeout(interestName);
   }
 
+  /** \brief Returns the value by which the face is ranked for forwarding, lower is better.
+   *
+   *  This is the SRTT if the last Interest was answered. Faces without measurements rank
+   *  after all faces with an SRTT, and faces whose last Interest timed out rank last.
+   *  The value is updated when an RTT or a timeout is recorded.
+   */
+  time::nanoseconds
+  getRankingValue() const
+  {
+    return m_rankingValue;
+  }
+
   bool
   hasTimeout() const
   {
@@ -106,9 +118,13 @@ public:
   static constexpr time::nanoseconds RTT_NO_MEASUREMENT = -1_ns;
   static constexpr time::nanoseconds RTT_TIMEOUT = -2_ns;
 
+  static constexpr time::nanoseconds RANKING_VALUE_NO_MEASUREMENT = time::nanoseconds::max() / 2;
+  static constexpr time::nanoseconds RANKING_VALUE_TIMEOUT = time::nanoseconds::max();
+
 private:
   ndn::util::RttEstimator m_rttEstimator;
   time::nanoseconds m_lastRtt = RTT_NO_MEASUREMENT;
+  time::nanoseconds m_rankingValue = RANKING_VALUE_NO_MEASUREMENT;
   Name m_lastInterestName;
   size_t m_nTimeouts = 0;
 
@@ -174,7 +190,10 @@ public:
   }
 
 private:
-  std::unordered_map<FaceId, FaceInfo> m_fiMap;
+  // FaceInfo of each face, in increasing order of FaceId; the FaceIds are kept in a
+  // separate array so that a lookup only touches contiguous memory
+  std::vector<FaceId> m_faceIds;
+  std::vector<unique_ptr<FaceInfo>> m_faceInfos;
   shared_ptr<const ndn::util::RttEstimator::Options> m_rttEstimatorOpts;
   bool m_isProbingDue = false;
   bool m_isFirstProbeScheduled = false;
@@ -203,6 +222,12 @@ public:
   NamespaceInfo&
   getOrCreateNamespaceInfo(const fib::Entry& fibEntry, const Name& prefix);
 
+  /** \brief Find or create the NamespaceInfo of exactly \p prefix, regardless of the FIB.
+   *  \return nullptr if \p prefix is not under the strategy's namespace
+   */
+  NamespaceInfo*
+  getOrCreateNamespaceInfo(const Name& prefix);
+
 private:
   void
   extendLifetime(measurements::Entry& me);
@@ -61,9 +61,10 @@ Face*
 ProbingModule::getFaceToProbe(const Face& inFace, const Interest& interest,
                               const fib::Entry& fibEntry, const Face& faceUsed)
 {
-  FaceInfoFacePairSet rankedFaces;
+  m_rankedFaces.clear();
+  NamespaceInfo* namespaceInfo = nullptr;
 
-  // Put eligible faces into rankedFaces. If a face does not have an RTT measurement,
+  // Put eligible faces into m_rankedFaces. If a face does not have an RTT measurement,
   // immediately pick the face for probing
   for (const auto& hop : fibEntry.getNextHops()) {
     Face& hopFace = hop.getFace();
@@ -75,22 +76,26 @@ ProbingModule::getFaceToProbe(const Face& inFace, const Interest& interest,
       continue;
     }
 
-    FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest.getName(), hopFace.getId());
+    if (namespaceInfo == nullptr) {
+      namespaceInfo = &m_measurements.getOrCreateNamespaceInfo(fibEntry, interest.getName());
+    }
+    FaceInfo* info = namespaceInfo->getFaceInfo(hopFace.getId());
     // If no RTT has been recorded, probe this face
     if (info == nullptr || info->getLastRtt() == FaceInfo::RTT_NO_MEASUREMENT) {
       return &hopFace;
     }
 
-    // Add FaceInfo to container sorted by RTT
-    rankedFaces.insert({info, &hopFace});
+    m_rankedFaces.emplace_back(info, &hopFace);
   }
 
-  if (rankedFaces.empty()) {
+  if (m_rankedFaces.empty()) {
     // No Face to probe
     return nullptr;
   }
 
-  return chooseFace(rankedFaces);
+  // Sort by RTT, keeping equally ranked faces in nexthop order
+  std::stable_sort(m_rankedFaces.begin(), m_rankedFaces.end(), FaceInfoCompare{});
+  return chooseFace(m_rankedFaces);
 }
 
 bool
@@ -123,7 +128,7 @@ ProbingModule::afterForwardingProbe(const fib::Entry& fibEntry, const Name& inte
 }
 
 Face*
-ProbingModule::chooseFace(const FaceInfoFacePairSet& rankedFaces)
+ProbingModule::chooseFace(const std::vector<FaceInfoFacePair>& rankedFaces)
 {
   static std::uniform_real_distribution<> randDist;
   double randomNumber = randDist(ndn::random::getRandomNumberEngine());
@@ -78,10 +78,11 @@ private:
     }
   };
 
-  using FaceInfoFacePairSet = std::set<FaceInfoFacePair, FaceInfoCompare>;
-
+  /** \brief Chooses a face at random, with a probability that decreases with its rank.
+   *  \param rankedFaces faces sorted by FaceInfoCompare
+   */
   static Face*
-  chooseFace(const FaceInfoFacePairSet& rankedFaces);
+  chooseFace(const std::vector<FaceInfoFacePair>& rankedFaces);
 
   static double
   getProbingProbability(uint64_t rank, uint64_t rankSum, uint64_t nFaces);
@@ -93,6 +94,8 @@ public:
 private:
   time::milliseconds m_probingInterval;
   AsfMeasurements& m_measurements;
+  // reused by getFaceToProbe(), so that ranking does not allocate in the common case
+  std::vector<FaceInfoFacePair> m_rankedFaces;
 };
 
 } // namespace nfd::fw::asf
@@ -68,6 +68,11 @@ void
 AsfStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                                   const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (interest.isReflexiveInterestFromProducer()) {
+    forwardReflexiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
   const auto& fibEntry = this->lookupFib(*pitEntry);
 
   // Check if the interest is new and, if so, skip the retx suppression check
@@ -196,6 +201,39 @@ AsfStrategy::forwardInterest(const Interest& interest, Face& outFace, const fib:
   return outRecord;
 }
 
+void
+AsfStrategy::forwardReflexiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                                      const shared_ptr<pit::Entry>& pitEntry)
+{
+  Face* outFace = this->sendReflexiveInterest(interest, ingress, pitEntry);
+  if (outFace == nullptr) {
+    return;
+  }
+
+  const auto& interestName = interest.getName();
+  size_t prefixLen = 0;
+  while (prefixLen < interestName.size() && !interestName[prefixLen].isReflexive()) {
+    ++prefixLen;
+  }
+
+  Name prefix = interestName.getPrefix(prefixLen);
+  auto* namespaceInfo = m_measurements.getOrCreateNamespaceInfo(prefix);
+  if (namespaceInfo == nullptr) {
+    NFD_LOG_TRACE(prefix << " is outside the strategy's namespace");
+    return;
+  }
+
+  auto faceId = outFace->getId();
+  FaceInfo& faceInfo = namespaceInfo->getOrCreateFaceInfo(faceId);
+  namespaceInfo->extendFaceInfoLifetime(faceInfo, faceId);
+
+  if (!faceInfo.isTimeoutScheduled()) {
+    faceInfo.scheduleTimeout(interestName, [this, name = interestName, faceId] {
+      onTimeoutOrNack(name, faceId, false);
+    });
+  }
+}
+
 void
 AsfStrategy::sendProbe(const Interest& interest, const FaceEndpoint& ingress, const Face& faceToUse,
                        const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry)
@@ -216,50 +254,17 @@ AsfStrategy::sendProbe(const Interest& interest, const FaceEndpoint& ingress, co
   m_probing.afterForwardingProbe(fibEntry, interest.getName());
 }
 
-struct FaceStats
-{
-  Face* face;
-  time::nanoseconds rtt;
-  time::nanoseconds srtt;
-  uint64_t cost;
-};
-
-struct FaceStatsCompare
-{
-  bool
-  operator()(const FaceStats& lhs, const FaceStats& rhs) const
-  {
-    time::nanoseconds lhsValue = getValueForSorting(lhs);
-    time::nanoseconds rhsValue = getValueForSorting(rhs);
-
-    // Sort by RTT and then by cost
-    return std::tie(lhsValue, lhs.cost) < std::tie(rhsValue, rhs.cost);
-  }
-
-private:
-  static time::nanoseconds
-  getValueForSorting(const FaceStats& stats)
-  {
-    // These values allow faces with no measurements to be ranked better than timeouts
-    // srtt < RTT_NO_MEASUREMENT < RTT_TIMEOUT
-    if (stats.rtt == FaceInfo::RTT_TIMEOUT) {
-      return time::nanoseconds::max();
-    }
-    else if (stats.rtt == FaceInfo::RTT_NO_MEASUREMENT) {
-      return time::nanoseconds::max() / 2;
-    }
-    else {
-      return stats.srtt;
-    }
-  }
-};
-
 Face*
 AsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFace,
                                       const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry,
                                       bool isInterestNew)
 {
-  std::set<FaceStats, FaceStatsCompare> rankedFaces;
+  // Rank by the ranking value of the face, and then by cost. The first of several
+  // equally ranked nexthops is chosen.
+  Face* bestFace = nullptr;
+  time::nanoseconds bestValue{};
+  uint64_t bestCost = 0;
+  NamespaceInfo* namespaceInfo = nullptr;
 
   auto now = time::steady_clock::now();
   for (const auto& nh : fibEntry.getNextHops()) {
@@ -267,18 +272,21 @@ AsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFa
       continue;
     }
 
-    const FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest.getName(), nh.getFace().getId());
-    if (info == nullptr) {
-      rankedFaces.insert({&nh.getFace(), FaceInfo::RTT_NO_MEASUREMENT,
-                          FaceInfo::RTT_NO_MEASUREMENT, nh.getCost()});
+    if (namespaceInfo == nullptr) {
+      namespaceInfo = &m_measurements.getOrCreateNamespaceInfo(fibEntry, interest.getName());
     }
-    else {
-      rankedFaces.insert({&nh.getFace(), info->getLastRtt(), info->getSrtt(), nh.getCost()});
+    const FaceInfo* info = namespaceInfo->getFaceInfo(nh.getFace().getId());
+    auto value = info == nullptr ? FaceInfo::RANKING_VALUE_NO_MEASUREMENT : info->getRankingValue();
+    uint64_t cost = nh.getCost();
+
+    if (bestFace == nullptr || std::tie(value, cost) < std::tie(bestValue, bestCost)) {
+      bestFace = &nh.getFace();
+      bestValue = value;
+      bestCost = cost;
     }
   }
 
-  auto it = rankedFaces.begin();
-  return it != rankedFaces.end() ? it->face : nullptr;
+  return bestFace;
 }
 
 void
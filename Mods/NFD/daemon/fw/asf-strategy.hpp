@@ -69,6 +69,16 @@ private:
   forwardInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
                   const shared_ptr<pit::Entry>& pitEntry);
 
+  /** \brief Send a reflexive Interest back toward the consumer, and measure the round trip.
+   *
+   *  The reflexive Data is matched by the PIT entry of the reflexive Interest, so the
+   *  measurements are kept under the name components that precede the reflexive component.
+   *  beforeSatisfyInterest() then records the round trip as an RTT sample of the consumer face.
+   */
+  void
+  forwardReflexiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                           const shared_ptr<pit::Entry>& pitEntry);
+
   void
   sendProbe(const Interest& interest, const FaceEndpoint& ingress, const Face& faceToUse,
             const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry);
@@ -84,10 +94,8 @@ private:
   void
   sendNoRouteNack(Face& face, const shared_ptr<pit::Entry>& pitEntry);
 
-private:
-  AsfMeasurements m_measurements;
-
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  AsfMeasurements m_measurements;
   std::unique_ptr<RetxSuppressionExponential> m_retxSuppression;
   ProbingModule m_probing;
   size_t m_nMaxTimeouts = 3;
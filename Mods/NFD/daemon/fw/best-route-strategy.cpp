@@ -63,32 +63,11 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
 {
   NFD_LOG_DEBUG("At afterReceiveInterest interst= "<<interest<<", pitentry name: "<<pitEntry->getName() << ", pit-token = "<<readInterestPitToken(interest));
   
-  if (interest.isReflexiveInterestFromProducer()) //reflexive interest from producer?
-  {
-    NFD_LOG_DEBUG("Reflexvie interest from producer detected! "<<interest);
-    const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
-    const fib::NextHopList& nexthops = fibEntry.getNextHops();
-    NFD_LOG_DEBUG("For RF's original Interest Nexthops empty?"<<nexthops.empty());
-
-    auto it = pitEntry->getInRecords().begin();
-    if (it == pitEntry->getInRecords().end()) {
-      NFD_LOG_INTEREST_FROM(interest, ingress, "new no-nexthop");
-      lp::NackHeader nackHeader;
-      nackHeader.setReason(lp::NackReason::NO_ROUTE);
-      this->sendNack(nackHeader, ingress.face, pitEntry);
-      this->rejectPendingInterest(pitEntry);
-      return;
-    }
-
-    Face& outFace = it->getFace();
-    NFD_LOG_DEBUG("Reflexive interest find original ingress, sending...!");
-    NFD_LOG_INTEREST_FROM(interest, ingress, "new to=" << outFace.getId());
-    this->sendInterest(interest, outFace, pitEntry); 
-    // outFace.sendInterest(interest);
+  if (interest.isReflexiveInterestFromProducer()) {
+    this->sendReflexiveInterest(interest, ingress, pitEntry);
     return;
   }
 
-
   auto suppression = m_retxSuppression->decidePerPitEntry(*pitEntry);
   if (suppression == RetxSuppressionResult::SUPPRESS) {
     NFD_LOG_INTEREST_FROM(interest, ingress, "suppressed");
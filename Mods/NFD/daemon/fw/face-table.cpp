@@ -125,4 +125,11 @@ FaceTable::end() const
   return this->getForwardRange().end();
 }
 
+FaceTable::const_iterator
+FaceTable::lowerBound(FaceId id) const
+{
+  // wrap the map iterator in the same adaptors as getForwardRange()
+  return const_iterator(const_iterator::base_type(m_faces.lower_bound(id)));
+}
+
 } // namespace nfd
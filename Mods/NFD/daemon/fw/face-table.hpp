@@ -75,6 +75,14 @@ public: // enumeration
   const_iterator
   end() const;
 
+  /** \brief Returns an iterator to the first face whose FaceId is not less than \p id.
+   *
+   *  Faces are enumerated in increasing order of FaceId, hence a FaceId can serve as a cursor
+   *  that remains valid when faces are added or removed.
+   */
+  const_iterator
+  lowerBound(FaceId id) const;
+
 public: // signals
   /** \brief Fires immediately after a face is added.
    */
@@ -58,6 +58,7 @@ Forwarder::Forwarder(FaceTable& faceTable)
   , m_strategyChoice(*this)
 {
   m_faceTable.afterAdd.connect([this] (const Face& face) {
+    applyEgressScheduling(const_cast<Face&>(face));
     face.afterReceiveInterest.connect(
       [this, &face] (const Interest& interest, const EndpointId& endpointId) {
         this->onIncomingInterest(interest, FaceEndpoint(const_cast<Face&>(face), endpointId));
@@ -78,6 +79,7 @@ Forwarder::Forwarder(FaceTable& faceTable)
 
   m_faceTable.beforeRemove.connect([this] (const Face& face) {
     cleanupOnFaceRemoval(m_nameTree, m_fib, m_pit, face);
+    m_admission.removeFace(face.getId());
   });
 
   m_fib.afterNewNextHop.connect([this] (const Name& prefix, const fib::NextHop& nextHop) {
@@ -124,6 +126,20 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
     return;
   }
 
+  // admission control, before the Interest creates any PIT state
+  if (m_admission.isEnabled() && !m_admission.admit(interest, ingress.face.getId())) {
+    NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName()
+                  << " nonce=" << nonce << " rate-limited");
+    // Nack with reason=Congestion on point-to-point faces, drop otherwise
+    if (ingress.face.getLinkType() == ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
+      lp::Nack nack(interest);
+      nack.setReason(lp::NackReason::CONGESTION);
+      ingress.face.sendNack(nack);
+      ++m_counters.nOutNacks;
+    }
+    return;
+  }
+
   // detect duplicate Nonce with Dead Nonce List
   bool hasDuplicateNonceInDnl = m_deadNonceList.has(interest.getName(), nonce);
   if (hasDuplicateNonceInDnl) {
@@ -868,6 +884,68 @@ Forwarder::setConfigFile(ConfigFile& configFile)
   });
 }
 
+static void
+parseAdmissionConfig(const ConfigSection& section, fw::InterestAdmission::Config& admission,
+                     std::optional<face::InterestScheduler::Options>& egress)
+{
+  const std::string sectionName = CFG_FORWARDER + ".admission";
+  face::InterestScheduler::Options egressOptions;
+
+  for (const auto& pair : section) {
+    const std::string& key = pair.first;
+    if (key == "face_rate") {
+      admission.faceRate = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+    }
+    else if (key == "face_burst") {
+      admission.faceBurst = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+    }
+    else if (key == "prefix") {
+      fw::InterestAdmission::PrefixLimit limit;
+      auto prefixUri = pair.second.get_value<std::string>();
+      try {
+        limit.prefix = Name(prefixUri);
+      }
+      catch (const Name::Error&) {
+        NDN_THROW_NESTED(ConfigFile::Error("Invalid prefix '" + prefixUri +
+                                           "' in section '" + sectionName + "'"));
+      }
+      const std::string prefixSectionName = sectionName + ".prefix";
+      for (const auto& option : pair.second) {
+        if (option.first == "rate") {
+          limit.rate = ConfigFile::parseNumber<uint32_t>(option, prefixSectionName);
+        }
+        else if (option.first == "burst") {
+          limit.burst = ConfigFile::parseNumber<uint32_t>(option, prefixSectionName);
+        }
+        else {
+          NDN_THROW(ConfigFile::Error("Unrecognized option " + prefixSectionName + "." + option.first));
+        }
+      }
+      if (limit.rate == 0) {
+        NDN_THROW(ConfigFile::Error("Missing or zero rate for prefix " + limit.prefix.toUri() +
+                                    " in section '" + sectionName + "'"));
+      }
+      admission.prefixLimits.push_back(std::move(limit));
+    }
+    else if (key == "egress_rate") {
+      egressOptions.rate = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+    }
+    else if (key == "egress_burst") {
+      egressOptions.burst = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+    }
+    else if (key == "egress_queue_length") {
+      egressOptions.maxQueueLength = ConfigFile::parseNumber<size_t>(pair, sectionName);
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + sectionName + "." + key));
+    }
+  }
+
+  if (egressOptions.rate > 0) {
+    egress = egressOptions;
+  }
+}
+
 void
 Forwarder::processConfig(const ConfigSection& configSection, bool isDryRun, const std::string&)
 {
@@ -878,6 +956,9 @@ Forwarder::processConfig(const ConfigSection& configSection, bool isDryRun, cons
     if (key == "default_hop_limit") {
       config.defaultHopLimit = ConfigFile::parseNumber<uint8_t>(pair, CFG_FORWARDER);
     }
+    else if (key == "admission") {
+      parseAdmissionConfig(pair.second, config.admission, config.egressScheduling);
+    }
     else {
       NDN_THROW(ConfigFile::Error("Unrecognized option " + CFG_FORWARDER + "." + key));
     }
@@ -885,6 +966,18 @@ Forwarder::processConfig(const ConfigSection& configSection, bool isDryRun, cons
 
   if (!isDryRun) {
     m_config = config;
+    m_admission.setConfig(m_config.admission);
+    for (Face& face : m_faceTable) {
+      applyEgressScheduling(face);
+    }
+  }
+}
+
+void
+Forwarder::applyEgressScheduling(Face& face) const
+{
+  if (face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL) {
+    face.setInterestScheduling(m_config.egressScheduling);
   }
 }
 
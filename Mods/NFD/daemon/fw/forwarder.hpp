@@ -28,6 +28,7 @@
 
 #include "face-table.hpp"
 #include "forwarder-counters.hpp"
+#include "interest-admission.hpp"
 #include "unsolicited-data-policy.hpp"
 #include "common/config-file.hpp"
 #include "face/face-endpoint.hpp"
@@ -68,6 +69,12 @@ public:
     return m_counters;
   }
 
+  const FaceTable&
+  getFaceTable() const noexcept
+  {
+    return m_faceTable;
+  }
+
   fw::UnsolicitedDataPolicy&
   getUnsolicitedDataPolicy() const noexcept
   {
@@ -129,6 +136,12 @@ public:
     return m_networkRegionTable;
   }
 
+  const fw::InterestAdmission&
+  getInterestAdmission() const noexcept
+  {
+    return m_admission;
+  }
+
   /** \brief Register handler for forwarder section of NFD configuration file.
    */
   void
@@ -229,6 +242,11 @@ private:
   processConfig(const ConfigSection& configSection, bool isDryRun,
                 const std::string& filename);
 
+  /** \brief Apply the egress Interest scheduling options to \p face if it is non-local.
+   */
+  void
+  applyEgressScheduling(Face& face) const;
+
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /**
    * \brief Configuration options from the `forwarder` section.
@@ -238,6 +256,12 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     /// Initial value of HopLimit that should be added to Interests that don't have one.
     /// A value of zero disables the feature.
     uint8_t defaultHopLimit = 0;
+
+    /// Rate limits of the admission stage of the incoming Interest pipeline.
+    fw::InterestAdmission::Config admission;
+
+    /// Shaping of the Interests sent on non-local faces, or nullopt to send them immediately.
+    std::optional<face::InterestScheduler::Options> egressScheduling;
   };
   Config m_config;
 
@@ -255,6 +279,7 @@ private:
   StrategyChoice     m_strategyChoice;
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
+  fw::InterestAdmission m_admission;
 
   nfd::pit::pit_assist        m_pit_assist;
 
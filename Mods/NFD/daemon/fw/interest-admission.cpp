@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "interest-admission.hpp"
+
+namespace nfd::fw {
+
+void
+InterestAdmission::setConfig(const Config& config)
+{
+  m_config = config;
+  m_faces.clear();
+  m_prefixes.clear();
+  m_matched.clear();
+
+  auto now = time::steady_clock::now();
+  for (const auto& limit : m_config.prefixLimits) {
+    BOOST_ASSERT(limit.rate > 0);
+    m_prefixes.emplace_back(limit.prefix,
+                            BucketState{TokenBucket(limit.rate, std::max<uint32_t>(limit.burst, 1), now)});
+  }
+}
+
+bool
+InterestAdmission::admit(const Interest& interest, FaceId ingress, time::steady_clock::time_point now)
+{
+  m_matched.clear();
+
+  if (m_config.faceRate > 0) {
+    auto it = m_faces.find(ingress);
+    if (it == m_faces.end()) {
+      TokenBucket bucket(m_config.faceRate, std::max<uint32_t>(m_config.faceBurst, 1), now);
+      it = m_faces.emplace(ingress, BucketState{bucket}).first;
+    }
+    m_matched.push_back(&it->second);
+  }
+
+  for (auto& [prefix, state] : m_prefixes) {
+    if (prefix.isPrefixOf(interest.getName())) {
+      m_matched.push_back(&state);
+    }
+  }
+
+  bool isAdmitted = std::all_of(m_matched.begin(), m_matched.end(),
+                                [now] (BucketState* state) { return state->bucket.hasToken(now); });
+  for (auto* state : m_matched) {
+    if (isAdmitted) {
+      state->bucket.tryConsume(now);
+      ++state->nAdmitted;
+    }
+    else {
+      ++state->nRejected;
+    }
+  }
+  return isAdmitted;
+}
+
+} // namespace nfd::fw
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_INTEREST_ADMISSION_HPP
+#define NFD_DAEMON_FW_INTEREST_ADMISSION_HPP
+
+#include "common/token-bucket.hpp"
+#include "face/face-common.hpp"
+
+#include <unordered_map>
+
+namespace nfd::fw {
+
+/** \brief Admission stage of the incoming Interest pipeline.
+ *
+ *  Incoming Interests are rate limited with token buckets, one per ingress face and one per
+ *  configured name prefix. An Interest is admitted only if the bucket of its ingress face and
+ *  the buckets of all configured prefixes of its name each have a token. The tokens are then
+ *  taken from all of these buckets, so that a nested prefix is also bounded by the limits of
+ *  its enclosing prefixes. A rejected Interest takes no token.
+ */
+class InterestAdmission : noncopyable
+{
+public:
+  /** \brief Rate limit of Interests under a name prefix.
+   */
+  struct PrefixLimit
+  {
+    Name prefix;
+    /// Interests admitted per second
+    uint32_t rate = 0;
+    /// Interests admitted back to back after an idle period
+    uint32_t burst = 0;
+  };
+
+  struct Config
+  {
+    /// Interests admitted per second from each face, zero disables the per-face limit
+    uint32_t faceRate = 0;
+    /// Interests admitted back to back from each face after an idle period
+    uint32_t faceBurst = 0;
+    std::vector<PrefixLimit> prefixLimits;
+  };
+
+  /** \brief State of the token bucket of a face or of a prefix.
+   */
+  struct BucketState
+  {
+    TokenBucket bucket;
+    uint64_t nAdmitted = 0;
+    uint64_t nRejected = 0;
+  };
+
+  const Config&
+  getConfig() const noexcept
+  {
+    return m_config;
+  }
+
+  /** \brief Replace the configuration, and reset all token buckets and counters.
+   */
+  void
+  setConfig(const Config& config);
+
+  /** \brief Returns whether any rate limit is configured.
+   */
+  bool
+  isEnabled() const noexcept
+  {
+    return m_config.faceRate > 0 || !m_prefixes.empty();
+  }
+
+  /** \brief Decide whether an Interest received on \p ingress is admitted.
+   */
+  bool
+  admit(const Interest& interest, FaceId ingress,
+        time::steady_clock::time_point now = time::steady_clock::now());
+
+  /** \brief Forget the bucket of a face that is being removed.
+   */
+  void
+  removeFace(FaceId faceId)
+  {
+    m_faces.erase(faceId);
+  }
+
+  /** \brief Returns the bucket of each face from which an Interest was received.
+   */
+  const std::unordered_map<FaceId, BucketState>&
+  getFaceStates() const noexcept
+  {
+    return m_faces;
+  }
+
+  /** \brief Returns the bucket of each configured prefix, in the order of the configuration.
+   */
+  const std::vector<std::pair<Name, BucketState>>&
+  getPrefixStates() const noexcept
+  {
+    return m_prefixes;
+  }
+
+private:
+  Config m_config;
+  std::unordered_map<FaceId, BucketState> m_faces;
+  std::vector<std::pair<Name, BucketState>> m_prefixes;
+  std::vector<BucketState*> m_matched; // reused across admit() calls
+};
+
+} // namespace nfd::fw
+
+#endif // NFD_DAEMON_FW_INTEREST_ADMISSION_HPP
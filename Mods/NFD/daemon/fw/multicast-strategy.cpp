@@ -61,6 +61,11 @@ void
 MulticastStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                                         const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (interest.isReflexiveInterestFromProducer()) {
+    this->sendReflexiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
   const fib::NextHopList& nexthops = fibEntry.getNextHops();
 
@@ -59,6 +59,11 @@ void
 RandomStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                                      const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (interest.isReflexiveInterestFromProducer()) {
+    this->sendReflexiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
   fib::NextHopList nhs;
 
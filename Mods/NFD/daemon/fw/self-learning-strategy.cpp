@@ -36,6 +36,8 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <algorithm>
+
 namespace nfd::fw {
 
 NFD_LOG_INIT(SelfLearningStrategy);
@@ -55,6 +57,29 @@ SelfLearningStrategy::SelfLearningStrategy(Forwarder& forwarder, const Name& nam
       "SelfLearningStrategy does not support version " + to_string(*parsed.version)));
   }
   this->setInstanceName(makeInstanceName(name, getStrategyName()));
+
+  auto byFaceId = [] (const Face* a, const Face* b) { return a->getId() < b->getId(); };
+  for (Face& face : this->getFaceTable()) {
+    if (face.getScope() != ndn::nfd::FACE_SCOPE_LOCAL) {
+      m_broadcastFaces.push_back(&face);
+    }
+  }
+  std::sort(m_broadcastFaces.begin(), m_broadcastFaces.end(), byFaceId);
+
+  m_afterAddFaceConn = afterAddFace.connect([this, byFaceId] (const Face& face) {
+    if (face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+      return;
+    }
+    Face* added = this->getFace(face.getId());
+    m_broadcastFaces.insert(std::upper_bound(m_broadcastFaces.begin(), m_broadcastFaces.end(),
+                                             added, byFaceId), added);
+  });
+  m_beforeRemoveFaceConn = beforeRemoveFace.connect([this] (const Face& face) {
+    auto it = std::find(m_broadcastFaces.begin(), m_broadcastFaces.end(), &face);
+    if (it != m_broadcastFaces.end()) {
+      m_broadcastFaces.erase(it);
+    }
+  });
 }
 
 const Name&
@@ -68,6 +93,11 @@ void
 SelfLearningStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                                            const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (interest.isReflexiveInterestFromProducer()) {
+    this->sendReflexiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
   const fib::NextHopList& nexthops = fibEntry.getNextHops();
 
@@ -146,10 +176,14 @@ void
 SelfLearningStrategy::broadcastInterest(const Interest& interest, const Face& inFace,
                                         const shared_ptr<pit::Entry>& pitEntry)
 {
-  for (auto& outFace : this->getFaceTable() | boost::adaptors::reversed) {
-    if ((outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) ||
-        wouldViolateScope(inFace, interest, outFace) ||
-        outFace.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+  // every candidate is non-local, so the scope of the Interest either permits all of them or none
+  if (m_broadcastFaces.empty() || wouldViolateScope(inFace, interest, *m_broadcastFaces.front())) {
+    return;
+  }
+
+  for (Face* outFacePtr : m_broadcastFaces | boost::adaptors::reversed) {
+    Face& outFace = *outFacePtr;
+    if (outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
       continue;
     }
 
@@ -188,26 +222,8 @@ SelfLearningStrategy::asyncProcessData(const shared_ptr<pit::Entry>& pitEntry, c
   // (the PIT entry's expiry timer was set to 0 before dispatching)
   this->setExpiryTimer(pitEntry, 1_s);
 
-  runOnRibIoService([this, pitEntryWeak = weak_ptr<pit::Entry>{pitEntry}, inFaceId = inFace.getId(), data] {
-    rib::Service::get().getRibManager().slFindAnn(data.getName(),
-      [this, pitEntryWeak, inFaceId, data] (std::optional<ndn::PrefixAnnouncement> paOpt) {
-        if (paOpt) {
-          runOnMainIoService([this, pitEntryWeak, inFaceId, data, pa = std::move(*paOpt)] {
-            auto pitEntry = pitEntryWeak.lock();
-            auto inFace = this->getFace(inFaceId);
-            if (pitEntry && inFace) {
-              NFD_LOG_DEBUG("Found PrefixAnnouncement=" << pa.getAnnouncedName());
-              data.setTag(make_shared<lp::PrefixAnnouncementTag>(lp::PrefixAnnouncementHeader(pa)));
-              this->sendDataToAll(data, pitEntry, *inFace);
-              this->setExpiryTimer(pitEntry, 0_ms);
-            }
-            else {
-              NFD_LOG_DEBUG("PIT entry or face no longer exists");
-            }
-          });
-        }
-    });
-  });
+  m_pendingData.push_back({pitEntry, inFace.getId(), data});
+  scheduleRibRequests();
 }
 
 bool
@@ -235,23 +251,98 @@ void
 SelfLearningStrategy::addRoute(const shared_ptr<pit::Entry>& pitEntry, const Face& inFace,
                                const Data& data, const ndn::PrefixAnnouncement& pa)
 {
-  runOnRibIoService([pitEntryWeak = weak_ptr<pit::Entry>{pitEntry}, inFaceId = inFace.getId(), data, pa] {
-    rib::Service::get().getRibManager().slAnnounce(pa, inFaceId, ROUTE_RENEW_LIFETIME,
-      [] (RibManager::SlAnnounceResult res) {
-        NFD_LOG_DEBUG("Add route via PrefixAnnouncement with result=" << res);
-      });
-  });
+  enqueueRouteUpdate({RouteUpdateKind::ANNOUNCE, pa.getAnnouncedName(), inFace.getId(),
+                      ROUTE_RENEW_LIFETIME, pa});
 }
 
 void
 SelfLearningStrategy::renewRoute(const Name& name, FaceId inFaceId, time::milliseconds maxLifetime)
 {
   // renew route with PA or ignore PA (if route has no PA)
-  runOnRibIoService([name, inFaceId, maxLifetime] {
-    rib::Service::get().getRibManager().slRenew(name, inFaceId, maxLifetime,
-      [] (RibManager::SlAnnounceResult res) {
-        NFD_LOG_DEBUG("Renew route with result=" << res);
+  enqueueRouteUpdate({RouteUpdateKind::RENEW, name, inFaceId, maxLifetime, std::nullopt});
+}
+
+void
+SelfLearningStrategy::enqueueRouteUpdate(RouteUpdate update)
+{
+  auto [it, isNew] = m_routeUpdateIndex.try_emplace({update.kind, update.name, update.faceId},
+                                                    m_routeUpdates.size());
+  if (isNew) {
+    m_routeUpdates.push_back(std::move(update));
+  }
+  else {
+    // a later Data or Nack supersedes the pending update
+    m_routeUpdates[it->second] = std::move(update);
+  }
+  scheduleRibRequests();
+}
+
+void
+SelfLearningStrategy::scheduleRibRequests()
+{
+  if (m_hasScheduledRibRequests) {
+    return;
+  }
+  m_hasScheduledRibRequests = true;
+  runOnMainIoService([this] { submitRibRequests(); });
+}
+
+void
+SelfLearningStrategy::submitRibRequests()
+{
+  m_hasScheduledRibRequests = false;
+  m_routeUpdateIndex.clear();
+  if (m_routeUpdates.empty() && m_pendingData.empty()) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("Submit route-updates=" << m_routeUpdates.size() <<
+                " prefixann-lookups=" << m_pendingData.size());
+  runOnRibIoService([this, updates = std::exchange(m_routeUpdates, {}),
+                     pending = std::exchange(m_pendingData, {})] () mutable {
+    auto& ribManager = rib::Service::get().getRibManager();
+    for (const auto& update : updates) {
+      if (update.kind == RouteUpdateKind::ANNOUNCE) {
+        ribManager.slAnnounce(*update.pa, update.faceId, update.maxLifetime,
+          [] (RibManager::SlAnnounceResult res) {
+            NFD_LOG_DEBUG("Add route via PrefixAnnouncement with result=" << res);
+          });
+      }
+      else {
+        ribManager.slRenew(update.name, update.faceId, update.maxLifetime,
+          [] (RibManager::SlAnnounceResult res) {
+            NFD_LOG_DEBUG("Renew route with result=" << res);
+          });
+      }
+    }
+
+    std::vector<std::pair<PendingData, ndn::PrefixAnnouncement>> found;
+    for (auto& item : pending) {
+      ribManager.slFindAnn(item.data.getName(), [&] (std::optional<ndn::PrefixAnnouncement> paOpt) {
+        if (paOpt) {
+          found.emplace_back(std::move(item), std::move(*paOpt));
+        }
       });
+    }
+    if (found.empty()) {
+      return;
+    }
+
+    runOnMainIoService([this, found = std::move(found)] {
+      for (const auto& [item, pa] : found) {
+        auto pitEntry = item.pitEntry.lock();
+        auto inFace = this->getFace(item.inFaceId);
+        if (pitEntry && inFace) {
+          NFD_LOG_DEBUG("Found PrefixAnnouncement=" << pa.getAnnouncedName());
+          item.data.setTag(make_shared<lp::PrefixAnnouncementTag>(lp::PrefixAnnouncementHeader(pa)));
+          this->sendDataToAll(item.data, pitEntry, *inFace);
+          this->setExpiryTimer(pitEntry, 0_ms);
+        }
+        else {
+          NFD_LOG_DEBUG("PIT entry or face no longer exists");
+        }
+      }
+    });
   });
 }
 
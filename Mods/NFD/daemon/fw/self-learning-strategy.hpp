@@ -136,6 +136,60 @@ private: // operations
    */
   void
   renewRoute(const Name& name, FaceId inFaceId, time::milliseconds maxLifetime);
+
+private: // requests to the RIB thread
+  enum class RouteUpdateKind {
+    ANNOUNCE,
+    RENEW,
+  };
+
+  /** \brief A pending call to RibManager::slAnnounce or RibManager::slRenew.
+   */
+  struct RouteUpdate
+  {
+    RouteUpdateKind kind;
+    Name name;
+    FaceId faceId;
+    time::milliseconds maxLifetime;
+    std::optional<ndn::PrefixAnnouncement> pa; ///< only for ANNOUNCE
+  };
+
+  /** \brief A Data that waits for a Prefix Announcement found on the RIB thread.
+   */
+  struct PendingData
+  {
+    weak_ptr<pit::Entry> pitEntry;
+    FaceId inFaceId;
+    Data data;
+  };
+
+  /** \brief Add a route update to the batch, replacing a pending update of the same kind
+   *         for the same name and face.
+   */
+  void
+  enqueueRouteUpdate(RouteUpdate update);
+
+  /** \brief Arrange for the pending requests to be submitted in a later turn of the main thread.
+   *
+   *  All route updates and Prefix Announcement lookups requested before then are submitted
+   *  to the RIB thread in a single closure.
+   */
+  void
+  scheduleRibRequests();
+
+  void
+  submitRibRequests();
+
+private:
+  // non-local faces in increasing order of FaceId, the candidate egress faces of broadcastInterest
+  std::vector<Face*> m_broadcastFaces;
+  signal::ScopedConnection m_afterAddFaceConn;
+  signal::ScopedConnection m_beforeRemoveFaceConn;
+
+  std::vector<RouteUpdate> m_routeUpdates;
+  std::map<std::tuple<RouteUpdateKind, Name, FaceId>, size_t> m_routeUpdateIndex;
+  std::vector<PendingData> m_pendingData;
+  bool m_hasScheduledRibRequests = false;
 };
 
 } // namespace nfd::fw
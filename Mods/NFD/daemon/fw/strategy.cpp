@@ -303,6 +303,32 @@ Strategy::sendNacks(const lp::NackHeader& header, const shared_ptr<pit::Entry>&
   // warning: don't loop on pitEntry->getInRecords(), because in-record is deleted when sending Nack
 }
 
+Face*
+Strategy::sendReflexiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                                const shared_ptr<pit::Entry>& pitEntry)
+{
+  BOOST_ASSERT(interest.isReflexiveInterestFromProducer());
+
+  auto inRecord = pitEntry->in_begin();
+  if (inRecord == pitEntry->in_end()) {
+    NFD_LOG_DEBUG("sendReflexiveInterest pitEntry=" << pitEntry->getName()
+                  << " in=" << ingress << " interest=" << interest.getName() << " no-in-record");
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(nackHeader, ingress.face, pitEntry);
+    this->rejectPendingInterest(pitEntry);
+    return nullptr;
+  }
+
+  Face& egress = inRecord->getFace();
+  NFD_LOG_DEBUG("sendReflexiveInterest pitEntry=" << pitEntry->getName()
+                << " in=" << ingress << " out=" << egress.getId() << " interest=" << interest.getName());
+  if (this->sendInterest(interest, egress, pitEntry) == nullptr) {
+    return nullptr;
+  }
+  return &egress;
+}
+
 const fib::Entry&
 Strategy::lookupFib(const pit::Entry& pitEntry) const
 {
@@ -346,6 +346,23 @@ protected: // actions
   sendNacks(const lp::NackHeader& header, const shared_ptr<pit::Entry>& pitEntry,
             std::initializer_list<const Face*> exceptFaces = {});
 
+  /**
+   * \brief Send a reflexive Interest from a producer toward the consumer of the original Interest.
+   *
+   * A reflexive Interest is not forwarded according to the FIB. It is sent to the face of the
+   * first in-record of the original Interest's PIT entry. If that PIT entry has no in-record,
+   * a Nack with reason NoRoute is sent to \p ingress and the PIT entry is rejected.
+   *
+   * \param interest the reflexive Interest, see Interest::isReflexiveInterestFromProducer()
+   * \param ingress face on which the reflexive Interest was received from the producer
+   * \param pitEntry the PIT entry of the original Interest
+   * \return face to which the reflexive Interest was sent, or nullptr if it was not sent
+   * \note This is not an action, but a helper that invokes the sendInterest() action.
+   */
+  Face*
+  sendReflexiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                        const shared_ptr<pit::Entry>& pitEntry);
+
   /**
    * \brief Schedule the PIT entry to be erased after \p duration.
    */
@@ -118,7 +118,7 @@ public:
     std::mutex m;
     std::condition_variable cv;
 
-    std::thread ribThread([configFile = m_configFile, &retval, &ribIo, mainIo, &cv, &m] {
+    std::thread ribThread([this, configFile = m_configFile, &retval, &ribIo, mainIo, &cv, &m] {
       {
         std::lock_guard<std::mutex> lock(m);
         ribIo = &getGlobalIoService();
@@ -131,6 +131,13 @@ public:
         ndn::KeyChain ribKeyChain;
         // must be created inside a separate thread
         rib::Service ribService(configFile, ribKeyChain);
+        // FIB updates bypass the management protocol: they are applied directly by the
+        // FibManager in the main thread, and the responses are returned to the RIB thread
+        ribService.getFibUpdater().setInProcessFib([this] (auto batch, auto done) {
+          m_nfd.applyFibBatch(std::move(batch), [done = std::move(done)] (auto responses) {
+            runOnRibIoService([done, responses = std::move(responses)] { done(responses); });
+          });
+        });
         getGlobalIoService().run(); // ribIo is not thread-safe to use here
       }
       catch (const std::exception& e) {
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "admission-status.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/encoding/tlv-nfd.hpp>
+
+namespace nfd {
+
+AdmissionStatus::AdmissionStatus(const Block& wire)
+{
+  wireDecode(wire);
+}
+
+Block
+AdmissionStatus::wireEncode() const
+{
+  BOOST_ASSERT(prefix.has_value() != faceId.has_value());
+
+  Block wire(ADMISSION_STATUS_TYPE);
+  if (prefix) {
+    wire.push_back(prefix->wireEncode());
+  }
+  else {
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(ndn::tlv::nfd::FaceId, *faceId));
+  }
+  if (bucket) {
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(RATE_TYPE, bucket->rate));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(BURST_TYPE, bucket->burst));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(TOKENS_TYPE, bucket->tokens));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(N_ADMITTED_TYPE, bucket->nAdmitted));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(N_REJECTED_TYPE, bucket->nRejected));
+  }
+  if (egress) {
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(N_QUEUED_TYPE, egress->nQueued));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(N_EGRESS_DROPPED_TYPE, egress->nDropped));
+  }
+  wire.encode();
+  return wire;
+}
+
+void
+AdmissionStatus::wireDecode(const Block& wire)
+{
+  if (wire.type() != ADMISSION_STATUS_TYPE) {
+    NDN_THROW(Error("AdmissionStatus", wire.type()));
+  }
+
+  AdmissionStatus status;
+  wire.parse();
+  auto val = wire.elements_begin();
+  auto end = wire.elements_end();
+
+  if (val != end && val->type() == ndn::tlv::Name) {
+    status.prefix.emplace(*val);
+    ++val;
+  }
+  else if (val != end && val->type() == ndn::tlv::nfd::FaceId) {
+    status.faceId = ndn::readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("Missing required Name or FaceId field"));
+  }
+
+  auto readField = [&] (uint32_t type, const char* name) {
+    if (val == end || val->type() != type) {
+      NDN_THROW(Error("Missing required "s + name + " field"));
+    }
+    return ndn::readNonNegativeInteger(*val++);
+  };
+
+  if (val != end && val->type() == RATE_TYPE) {
+    Bucket bucket;
+    bucket.rate = readField(RATE_TYPE, "Rate");
+    bucket.burst = readField(BURST_TYPE, "Burst");
+    bucket.tokens = readField(TOKENS_TYPE, "Tokens");
+    bucket.nAdmitted = readField(N_ADMITTED_TYPE, "NAdmitted");
+    bucket.nRejected = readField(N_REJECTED_TYPE, "NRejected");
+    status.bucket = bucket;
+  }
+
+  if (val != end && val->type() == N_QUEUED_TYPE) {
+    Egress egress;
+    egress.nQueued = readField(N_QUEUED_TYPE, "NQueued");
+    egress.nDropped = readField(N_EGRESS_DROPPED_TYPE, "NEgressDropped");
+    status.egress = egress;
+  }
+
+  if (val != end) {
+    NDN_THROW(Error("Unrecognized element of type " + to_string(val->type())));
+  }
+
+  *this = std::move(status);
+}
+
+} // namespace nfd
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_ADMISSION_STATUS_HPP
+#define NFD_DAEMON_MGMT_ADMISSION_STATUS_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+/**
+ * @brief An entry of the status/admission dataset, which reports the token bucket of a
+ *        face or of a prefix in the Interest admission stage, and the egress Interest
+ *        scheduler of a face.
+ *
+ * @code
+ * AdmissionStatus   = ADMISSION-STATUS-TYPE TLV-LENGTH
+ *                       (Name / FaceId)
+ *                       [Rate Burst Tokens NAdmitted NRejected]
+ *                       [NQueued NEgressDropped]
+ * @endcode
+ *
+ * All fields other than Name are NonNegativeInteger.
+ */
+class AdmissionStatus
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  struct Bucket
+  {
+    uint64_t rate = 0;
+    uint64_t burst = 0;
+    uint64_t tokens = 0;
+    uint64_t nAdmitted = 0;
+    uint64_t nRejected = 0;
+  };
+
+  struct Egress
+  {
+    uint64_t nQueued = 0;
+    uint64_t nDropped = 0;
+  };
+
+  /// TLV-TYPE numbers, only meaningful within the status/admission dataset
+  static constexpr uint32_t ADMISSION_STATUS_TYPE = 0xF2;
+  static constexpr uint32_t RATE_TYPE = 0xF3;
+  static constexpr uint32_t BURST_TYPE = 0xF4;
+  static constexpr uint32_t TOKENS_TYPE = 0xF5;
+  static constexpr uint32_t N_ADMITTED_TYPE = 0xF6;
+  static constexpr uint32_t N_REJECTED_TYPE = 0xF7;
+  static constexpr uint32_t N_QUEUED_TYPE = 0xF8;
+  static constexpr uint32_t N_EGRESS_DROPPED_TYPE = 0xF9;
+
+  AdmissionStatus() = default;
+
+  explicit
+  AdmissionStatus(const Block& wire);
+
+  Block
+  wireEncode() const;
+
+  /**
+   * @throw Error the block is not a valid AdmissionStatus
+   */
+  void
+  wireDecode(const Block& wire);
+
+public:
+  /// the prefix of the bucket, exclusive with faceId
+  std::optional<Name> prefix;
+  /// the face of the bucket and of the egress scheduler, exclusive with prefix
+  std::optional<uint64_t> faceId;
+  std::optional<Bucket> bucket;
+  std::optional<Egress> egress;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_ADMISSION_STATUS_HPP
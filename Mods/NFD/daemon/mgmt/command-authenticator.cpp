@@ -25,16 +25,20 @@
 
 #include "command-authenticator.hpp"
 #include "common/logger.hpp"
+#include "fw/scope-prefix.hpp"
 
 #include <ndn-cxx/tag.hpp>
 #include <ndn-cxx/security/certificate-fetcher-offline.hpp>
 #include <ndn-cxx/security/certificate-request.hpp>
+#include <ndn-cxx/security/signing-info.hpp>
 #include <ndn-cxx/security/validation-policy.hpp>
 #include <ndn-cxx/security/validation-policy-accept-all.hpp>
 #include <ndn-cxx/security/validation-policy-command-interest.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
 #include <ndn-cxx/util/io.hpp>
 
 #include <boost/filesystem.hpp>
+#include <fstream>
 
 namespace security = ndn::security;
 
@@ -64,6 +68,42 @@ getSignerFromTag(const Interest& interest)
   }
 }
 
+/**
+ * \brief Obtain KeyLocator name and timestamp of a command Interest, if well-formed.
+ */
+static std::optional<std::pair<Name, time::system_clock::time_point>>
+parseCommandSignature(const Interest& interest)
+{
+  try {
+    std::optional<ndn::SignatureInfo> sigInfo = interest.getSignatureInfo();
+    time::system_clock::time_point timestamp;
+    if (sigInfo && interest.getSignatureValue().isValid()) {
+      if (!sigInfo->getTime()) {
+        return std::nullopt;
+      }
+      timestamp = *sigInfo->getTime();
+    }
+    else {
+      const Name& name = interest.getName();
+      if (name.size() < ndn::command_interest::MIN_SIZE ||
+          !name.at(ndn::command_interest::POS_TIMESTAMP).isNumber()) {
+        return std::nullopt;
+      }
+      sigInfo.emplace(name.at(ndn::command_interest::POS_SIG_INFO).blockFromValue());
+      timestamp = time::fromUnixTimestamp(
+                    time::milliseconds(name.at(ndn::command_interest::POS_TIMESTAMP).toNumber()));
+    }
+
+    if (!sigInfo->hasKeyLocator() || sigInfo->getKeyLocator().getType() != tlv::Name) {
+      return std::nullopt;
+    }
+    return std::pair(sigInfo->getKeyLocator().getName(), timestamp);
+  }
+  catch (const tlv::Error&) {
+    return std::nullopt;
+  }
+}
+
 /**
  * \brief A validation policy that only permits Interests signed by a trust anchor.
  */
@@ -128,6 +168,7 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
         make_unique<security::ValidationPolicyCommandInterest>(make_unique<CommandAuthenticatorValidationPolicy>()),
         make_unique<security::CertificateFetcherOffline>());
     }
+    m_verifiedKeys.clear();
   }
 
   if (section.empty()) {
@@ -140,18 +181,47 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
       NDN_THROW(ConfigFile::Error("'" + sectionName + "' section is not permitted under 'authorizations'"));
     }
 
+    auto hmackey = authSection.get_optional<std::string>("hmackey");
     std::string certfile;
     try {
       certfile = authSection.get<std::string>("certfile");
+      if (hmackey) {
+        NDN_THROW(ConfigFile::Error("'certfile' and 'hmackey' cannot both appear under authorize[" +
+                                    to_string(authSectionIndex) + "]"));
+      }
     }
     catch (const boost::property_tree::ptree_error&) {
-      NDN_THROW(ConfigFile::Error("'certfile' is missing under authorize[" +
-                                  to_string(authSectionIndex) + "]"));
+      if (!hmackey) {
+        NDN_THROW(ConfigFile::Error("'certfile' is missing under authorize[" +
+                                    to_string(authSectionIndex) + "]"));
+      }
     }
 
     bool isAny = false;
     shared_ptr<security::Certificate> cert;
-    if (certfile == "any") {
+    shared_ptr<security::transform::PrivateKey> hmacKey;
+    Name hmacKeyName;
+    if (hmackey) {
+      using namespace boost::filesystem;
+      path keyfilePath = absolute(*hmackey, path(filename).parent_path());
+      shared_ptr<ndn::Buffer> keyBits;
+      try {
+        std::ifstream keyfile(keyfilePath.string());
+        keyBits = ndn::io::loadBuffer(keyfile, ndn::io::BASE64);
+      }
+      catch (const ndn::io::Error&) {
+      }
+      if (keyBits == nullptr || keyBits->empty()) {
+        NDN_THROW(ConfigFile::Error("cannot load hmackey " + keyfilePath.string() +
+                                    " for authorize[" + to_string(authSectionIndex) + "]"));
+      }
+      hmacKey = make_shared<security::transform::PrivateKey>();
+      hmacKey->loadRaw(ndn::KeyType::HMAC, *keyBits);
+      // same naming as ndn::security::SigningInfo::setSigningHmacKey
+      hmacKeyName = security::SigningInfo::getHmacIdentity();
+      hmacKeyName.append(name::Component(hmacKey->getKeyDigest(ndn::DigestAlgorithm::SHA256)));
+    }
+    else if (certfile == "any") {
       isAny = true;
       NFD_LOG_WARN("'certfile any' is intended for demo purposes only and "
                    "SHOULD NOT be used in production environments");
@@ -176,7 +246,7 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
     }
 
     if (privSection->empty()) {
-      NFD_LOG_WARN("No privileges granted to certificate " << certfile);
+      NFD_LOG_WARN("No privileges granted to " << (hmackey ? "hmackey " + *hmackey : "certificate " + certfile));
     }
     for (const auto& kv : *privSection) {
       const std::string& module = kv.first;
@@ -190,7 +260,13 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
         continue;
       }
 
-      if (isAny) {
+      if (hmacKey) {
+        auto& verifiedKey = m_verifiedKeys[module][hmacKeyName];
+        verifiedKey.key = hmacKey;
+        verifiedKey.expiry = time::steady_clock::time_point::max();
+        NFD_LOG_INFO("authorize module=" << module << " signer=" << hmacKeyName << " hmackey=" << *hmackey);
+      }
+      else if (isAny) {
         found->second = make_shared<security::Validator>(make_unique<security::ValidationPolicyAcceptAll>(),
                                                          make_unique<security::CertificateFetcherOffline>());
         NFD_LOG_INFO("authorize module=" << module << " signer=any");
@@ -216,12 +292,25 @@ CommandAuthenticator::makeAuthorization(const std::string& module, const std::st
                                               const ndn::mgmt::ControlParameters*,
                                               const ndn::mgmt::AcceptContinuation& accept,
                                               const ndn::mgmt::RejectContinuation& reject) {
+    auto cachedSigner = self->authorizeFromCache(module, interest);
+    if (cachedSigner) {
+      NFD_LOG_DEBUG("accept " << interest.getName() << " signer=" << *cachedSigner << " cached");
+      accept(*cachedSigner);
+      return;
+    }
+
     auto validator = self->m_validators.at(module);
 
-    auto successCb = [accept, validator] (const Interest& interest1) {
+    auto successCb = [module, self, accept, reject, validator] (const Interest& interest1) {
       auto signer1 = getSignerFromTag(interest1);
       BOOST_ASSERT(signer1 || // signer must be available unless 'certfile any'
                    dynamic_cast<security::ValidationPolicyAcceptAll*>(&validator->getPolicy()) != nullptr);
+      if (signer1 && !self->recordValidatedCommand(module, interest1, interest1.getTag<SignerTag>()->get())) {
+        // the Validator has not seen the commands accepted from the verified-key cache
+        NFD_LOG_DEBUG("reject " << interest1.getName() << " signer=" << *signer1 << " reason=Replayed timestamp");
+        reject(ndn::mgmt::RejectReply::STATUS403);
+        return;
+      }
       std::string signer = signer1.value_or("*");
       NFD_LOG_DEBUG("accept " << interest1.getName() << " signer=" << signer);
       accept(signer);
@@ -251,4 +340,81 @@ CommandAuthenticator::makeAuthorization(const std::string& module, const std::st
   };
 }
 
+std::optional<std::string>
+CommandAuthenticator::authorizeFromCache(const std::string& module, const Interest& interest)
+{
+  auto moduleKeys = m_verifiedKeys.find(module);
+  if (moduleKeys == m_verifiedKeys.end() || moduleKeys->second.empty()) {
+    return std::nullopt;
+  }
+
+  auto parsed = parseCommandSignature(interest);
+  if (!parsed) {
+    return std::nullopt;
+  }
+  const auto& [klName, timestamp] = *parsed;
+
+  auto it = moduleKeys->second.find(klName);
+  if (it == moduleKeys->second.end() || it->second.expiry <= time::steady_clock::now()) {
+    return std::nullopt;
+  }
+  VerifiedKey& verifiedKey = it->second;
+
+  auto now = time::system_clock::now();
+  if (timestamp < now - TIMESTAMP_GRACE_PERIOD || timestamp > now + TIMESTAMP_GRACE_PERIOD ||
+      timestamp <= verifiedKey.lastTimestamp) {
+    return std::nullopt;
+  }
+
+  bool isVerified = std::visit([&interest] (const auto& key) {
+    using T = std::decay_t<decltype(key)>;
+    if constexpr (std::is_same_v<T, std::monostate>) {
+      return false;
+    }
+    else if constexpr (std::is_same_v<T, shared_ptr<security::transform::PrivateKey>>) {
+      // HMAC keys are shared with local applications only
+      return scope_prefix::LOCALHOST.isPrefixOf(interest.getName()) &&
+             security::verifySignature(interest, *key);
+    }
+    else {
+      return security::verifySignature(interest, *key);
+    }
+  }, verifiedKey.key);
+  if (!isVerified) {
+    return std::nullopt;
+  }
+
+  verifiedKey.lastTimestamp = timestamp;
+  return klName.toUri();
+}
+
+bool
+CommandAuthenticator::recordValidatedCommand(const std::string& module, const Interest& interest,
+                                             const Name& signer)
+{
+  auto parsed = parseCommandSignature(interest);
+  if (!parsed) {
+    return true;
+  }
+
+  VerifiedKey& verifiedKey = m_verifiedKeys[module][signer];
+  if (parsed->second <= verifiedKey.lastTimestamp) {
+    return false;
+  }
+  verifiedKey.lastTimestamp = parsed->second;
+
+  auto now = time::steady_clock::now();
+  if (verifiedKey.expiry <= now) {
+    const auto& validator = m_validators.at(module);
+    auto cert = validator->findTrustedCert(security::CertificateRequest(signer).interest);
+    if (cert != nullptr) {
+      auto publicKey = make_shared<security::transform::PublicKey>();
+      publicKey->loadPkcs8(cert->getPublicKey());
+      verifiedKey.key = std::move(publicKey);
+      verifiedKey.expiry = now + VERIFIED_KEY_LIFETIME;
+    }
+  }
+  return true;
+}
+
 } // namespace nfd
@@ -29,14 +29,23 @@
 #include "common/config-file.hpp"
 
 #include <ndn-cxx/mgmt/dispatcher.hpp>
+#include <ndn-cxx/security/transform/private-key.hpp>
+#include <ndn-cxx/security/transform/public-key.hpp>
 #include <ndn-cxx/security/validator.hpp>
 
 #include <unordered_map>
+#include <variant>
 
 namespace nfd {
 
 /**
  * \brief Provides ControlCommand authorization according to NFD's configuration file.
+ *
+ * After a command has passed full validation, the public key of its signer is cached per
+ * module, keyed by KeyLocator name, for VERIFIED_KEY_LIFETIME. Later commands from the same
+ * signer are checked against the cached key and the last accepted timestamp of that key,
+ * without going through the Validator. HMAC keys listed in the configuration are always
+ * in the cache, and are accepted only for commands under `/localhost`.
  */
 class CommandAuthenticator : public std::enable_shared_from_this<CommandAuthenticator>, noncopyable
 {
@@ -55,9 +64,42 @@ public:
   ndn::mgmt::Authorization
   makeAuthorization(const std::string& module, const std::string& verb);
 
+public:
+  /// How long a public key stays in the verified-key cache after a full validation.
+  static constexpr time::nanoseconds VERIFIED_KEY_LIFETIME = 5_min;
+  /// Maximum difference between the timestamp of a command and the current time.
+  static constexpr time::nanoseconds TIMESTAMP_GRACE_PERIOD = 2_min;
+
 private:
   CommandAuthenticator();
 
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief A key that has verified a command of a module.
+   */
+  struct VerifiedKey
+  {
+    /// public key from a trust anchor, or HMAC key from the configuration; empty if not cached
+    std::variant<std::monostate,
+                 shared_ptr<ndn::security::transform::PublicKey>,
+                 shared_ptr<ndn::security::transform::PrivateKey>> key;
+    time::steady_clock::time_point expiry;
+    /// timestamp of the last command accepted with this key
+    time::system_clock::time_point lastTimestamp;
+  };
+
+  /** \brief Authorizes a command of \p module with the verified-key cache.
+   *  \return signer name if the command is accepted, or nullopt if it needs full validation
+   */
+  std::optional<std::string>
+  authorizeFromCache(const std::string& module, const Interest& interest);
+
+  /** \brief Records a command of \p module that has passed full validation.
+   *  \return false if the timestamp of the command is not newer than one already accepted
+   */
+  bool
+  recordValidatedCommand(const std::string& module, const Interest& interest, const Name& signer);
+
+private:
   /** \brief Process `authorizations` section.
    *  \throw ConfigFile::Error on parse error
    */
@@ -67,6 +109,8 @@ private:
 private:
   // module => validator
   std::unordered_map<std::string, shared_ptr<ndn::security::Validator>> m_validators;
+  // module => KeyLocator name => key
+  std::unordered_map<std::string, std::unordered_map<Name, VerifiedKey>> m_verifiedKeys;
 };
 
 } // namespace nfd
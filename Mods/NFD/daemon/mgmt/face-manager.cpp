@@ -254,7 +254,7 @@ updateLinkServiceOptions(Face& face, const ControlParameters& parameters)
     options.overrideMtu = std::min<uint64_t>(std::numeric_limits<ssize_t>::max(), parameters.getMtu());
   }
 
-  linkService->setOptions(options);
+  face.runInFaceThread([&] { linkService->setOptions(options); });
 }
 
 void
@@ -398,17 +398,6 @@ makeFaceStatus(const Face& face, const time::steady_clock::time_point& now)
   return status;
 }
 
-void
-FaceManager::listFaces(ndn::mgmt::StatusDatasetContext& context)
-{
-  auto now = time::steady_clock::now();
-  for (const auto& face : m_faceTable) {
-    ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-    context.append(status.wireEncode());
-  }
-  context.end();
-}
-
 void
 FaceManager::listChannels(ndn::mgmt::StatusDatasetContext& context)
 {
@@ -478,14 +467,38 @@ FaceManager::queryFaces(const Interest& interest,
     return context.reject(ControlResponse(400, "Malformed filter"));
   }
 
-  auto now = time::steady_clock::now();
-  for (const auto& face : m_faceTable) {
-    if (matchFilter(faceFilter, face)) {
-      ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-      context.append(status.wireEncode());
+  streamFaces(context, faceFilter);
+}
+
+void
+FaceManager::listFaces(ndn::mgmt::StatusDatasetContext& context)
+{
+  // an empty filter matches every face
+  streamFaces(context, ndn::nfd::FaceQueryFilter());
+}
+
+void
+FaceManager::streamFaces(ndn::mgmt::StatusDatasetContext& context,
+                         const ndn::nfd::FaceQueryFilter& filter)
+{
+  // the FaceId of the next face is a cursor that survives the addition and removal of faces
+  streamStatusDataset(context, [this, filter, nextId = FaceId(0)]
+                               (auto& context, size_t budget) mutable {
+    auto now = time::steady_clock::now();
+    size_t length = 0;
+    for (auto it = m_faceTable.lowerBound(nextId); it != m_faceTable.end(); ++it) {
+      if (length >= budget) {
+        nextId = it->getId();
+        return false;
+      }
+      if (matchFilter(filter, *it)) {
+        Block block = makeFaceStatus(*it, now).wireEncode();
+        context.append(block);
+        length += block.size();
+      }
     }
-  }
-  context.end();
+    return true;
+  });
 }
 
 void
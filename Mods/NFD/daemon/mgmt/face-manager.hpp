@@ -30,6 +30,8 @@
 #include "face/face.hpp"
 #include "face/face-system.hpp"
 
+#include <ndn-cxx/mgmt/nfd/face-query-filter.hpp>
+
 namespace nfd {
 
 /**
@@ -72,6 +74,12 @@ private: // StatusDataset
   void
   queryFaces(const Interest& interest, ndn::mgmt::StatusDatasetContext& context);
 
+  /**
+   * @brief Appends the status of the faces that match @p filter, in increasing order of FaceId.
+   */
+  void
+  streamFaces(ndn::mgmt::StatusDatasetContext& context, const ndn::nfd::FaceQueryFilter& filter);
+
 private: // NotificationStream
   void
   notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind);
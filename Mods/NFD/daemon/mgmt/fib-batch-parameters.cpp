@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-batch-parameters.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/encoding/tlv-nfd.hpp>
+
+namespace nfd {
+
+FibBatchParameters::FibBatchParameters(const Block& wire)
+{
+  wireDecode(wire);
+}
+
+FibBatchParameters&
+FibBatchParameters::addNextHop(const Name& prefix, uint64_t faceId, uint64_t cost)
+{
+  m_operations.push_back({Action::ADD_NEXTHOP,
+                          ndn::nfd::ControlParameters().setName(prefix).setFaceId(faceId).setCost(cost)});
+  return *this;
+}
+
+FibBatchParameters&
+FibBatchParameters::removeNextHop(const Name& prefix, uint64_t faceId)
+{
+  m_operations.push_back({Action::REMOVE_NEXTHOP,
+                          ndn::nfd::ControlParameters().setName(prefix).setFaceId(faceId)});
+  return *this;
+}
+
+Block
+FibBatchParameters::wireEncode() const
+{
+  Block wire(ndn::tlv::nfd::ControlParameters);
+  for (const auto& op : m_operations) {
+    wire.push_back(ndn::makeNestedBlock(op.action == Action::ADD_NEXTHOP ? ADD_NEXTHOP_TYPE :
+                                                                           REMOVE_NEXTHOP_TYPE,
+                                        op.parameters));
+  }
+  wire.encode();
+  return wire;
+}
+
+void
+FibBatchParameters::wireDecode(const Block& wire)
+{
+  if (wire.type() != ndn::tlv::nfd::ControlParameters) {
+    NDN_THROW(Error("ControlParameters", wire.type()));
+  }
+
+  std::vector<Operation> operations;
+  wire.parse();
+  for (const auto& element : wire.elements()) {
+    Action action;
+    switch (element.type()) {
+      case ADD_NEXTHOP_TYPE:
+        action = Action::ADD_NEXTHOP;
+        break;
+      case REMOVE_NEXTHOP_TYPE:
+        action = Action::REMOVE_NEXTHOP;
+        break;
+      default:
+        NDN_THROW(Error("Unrecognized element of type " + to_string(element.type())));
+    }
+
+    element.parse();
+    if (element.elements_size() != 1) {
+      NDN_THROW(Error("Operation must contain exactly one ControlParameters"));
+    }
+    ndn::nfd::ControlParameters parameters(element.elements().front());
+    if (!parameters.hasName() || !parameters.hasFaceId()) {
+      NDN_THROW(Error("Operation must have Name and FaceId"));
+    }
+    operations.push_back({action, std::move(parameters)});
+  }
+
+  m_operations = std::move(operations);
+}
+
+} // namespace nfd
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_FIB_BATCH_PARAMETERS_HPP
+#define NFD_DAEMON_MGMT_FIB_BATCH_PARAMETERS_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/mgmt/control-parameters.hpp>
+#include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+
+namespace nfd {
+
+/**
+ * @brief Parameters of the fib/batch command, a sequence of add-nexthop and remove-nexthop
+ *        operations.
+ *
+ * @code
+ * FibBatchParameters = CONTROL-PARAMETERS-TYPE TLV-LENGTH
+ *                        *(AddNextHop / RemoveNextHop)
+ * AddNextHop         = ADD-NEXTHOP-TYPE TLV-LENGTH ControlParameters ; Name, FaceId, [Cost]
+ * RemoveNextHop      = REMOVE-NEXTHOP-TYPE TLV-LENGTH ControlParameters ; Name, FaceId
+ * @endcode
+ */
+class FibBatchParameters final : public ndn::mgmt::ControlParameters
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  enum class Action {
+    ADD_NEXTHOP,
+    REMOVE_NEXTHOP,
+  };
+
+  struct Operation
+  {
+    Action action;
+    ndn::nfd::ControlParameters parameters;
+  };
+
+  /// TLV-TYPE numbers of the operations, only meaningful within FibBatchParameters
+  static constexpr uint32_t ADD_NEXTHOP_TYPE = 0xF0;
+  static constexpr uint32_t REMOVE_NEXTHOP_TYPE = 0xF1;
+
+  FibBatchParameters() = default;
+
+  explicit
+  FibBatchParameters(const Block& wire);
+
+  FibBatchParameters&
+  addNextHop(const Name& prefix, uint64_t faceId, uint64_t cost);
+
+  FibBatchParameters&
+  removeNextHop(const Name& prefix, uint64_t faceId);
+
+  const std::vector<Operation>&
+  getOperations() const noexcept
+  {
+    return m_operations;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_operations.size();
+  }
+
+  Block
+  wireEncode() const final;
+
+  /**
+   * @throw Error the block is not valid FibBatchParameters, or an operation lacks Name or FaceId
+   */
+  void
+  wireDecode(const Block& wire) final;
+
+private:
+  std::vector<Operation> m_operations;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_FIB_BATCH_PARAMETERS_HPP
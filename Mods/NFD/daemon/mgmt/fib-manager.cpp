@@ -31,6 +31,7 @@
 
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/mgmt/nfd/fib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/fib-event-notification.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
 
@@ -48,8 +49,27 @@ FibManager::FibManager(Fib& fib, const FaceTable& faceTable,
     [this] (auto&&, auto&&, auto&&... args) { addNextHop(std::forward<decltype(args)>(args)...); });
   registerCommandHandler<ndn::nfd::FibRemoveNextHopCommand>("remove-nexthop",
     [this] (auto&&, auto&&, auto&&... args) { removeNextHop(std::forward<decltype(args)>(args)...); });
+  registerCommandHandler<FibBatchParameters>("batch",
+    [] (const ndn::mgmt::ControlParameters& params) {
+      return static_cast<const FibBatchParameters&>(params).size() > 0;
+    },
+    [this] (const Name&, const Interest& interest, const ndn::mgmt::ControlParameters& params,
+            const ndn::mgmt::CommandContinuation& done) {
+      applyBatchCommand(interest, static_cast<const FibBatchParameters&>(params), done);
+    });
   registerStatusDatasetHandler("list",
-    [this] (auto&&, auto&&, auto&&... args) { listEntries(std::forward<decltype(args)>(args)...); });
+    [this] (auto&&... args) { listEntries(std::forward<decltype(args)>(args)...); });
+
+  m_postNotification = registerNotificationStream("events");
+  m_nextHopAddConn = m_fib.afterNewNextHop.connect([this] (const Name& prefix, const auto& nexthop) {
+    notifyFibEvent(ndn::nfd::ROUTE_EVENT_ADDED, prefix, nexthop);
+  });
+  m_nextHopUpdateConn = m_fib.afterUpdateNextHop.connect([this] (const Name& prefix, const auto& nexthop) {
+    notifyFibEvent(ndn::nfd::ROUTE_EVENT_UPDATED, prefix, nexthop);
+  });
+  m_nextHopRemoveConn = m_fib.beforeRemoveNextHop.connect([this] (const Name& prefix, const auto& nexthop) {
+    notifyFibEvent(ndn::nfd::ROUTE_EVENT_REMOVED, prefix, nexthop);
+  });
 }
 
 void
@@ -57,6 +77,73 @@ FibManager::addNextHop(const Interest& interest, ControlParameters parameters,
                        const ndn::mgmt::CommandContinuation& done)
 {
   setFaceForSelfRegistration(interest, parameters);
+  done(doAddNextHop(parameters));
+}
+
+void
+FibManager::removeNextHop(const Interest& interest, ControlParameters parameters,
+                          const ndn::mgmt::CommandContinuation& done)
+{
+  setFaceForSelfRegistration(interest, parameters);
+  done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
+  doRemoveNextHop(parameters);
+}
+
+void
+FibManager::applyBatchCommand(const Interest& interest, const FibBatchParameters& batch,
+                              const ndn::mgmt::CommandContinuation& done)
+{
+  FibBatchParameters resolved;
+  for (const auto& op : batch.getOperations()) {
+    ControlParameters parameters = op.parameters;
+    setFaceForSelfRegistration(interest, parameters);
+    if (op.action == FibBatchParameters::Action::ADD_NEXTHOP) {
+      resolved.addNextHop(parameters.getName(), parameters.getFaceId(), parameters.getCost());
+    }
+    else {
+      resolved.removeNextHop(parameters.getName(), parameters.getFaceId());
+    }
+  }
+
+  // the FIB is only modified if every operation can be applied
+  const auto& ops = resolved.getOperations();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ops[i].action != FibBatchParameters::Action::ADD_NEXTHOP) {
+      continue;
+    }
+    auto error = checkAddNextHop(ops[i].parameters);
+    if (error) {
+      NFD_LOG_DEBUG("fib/batch(" << ops.size() << "): FAIL at operation " << i);
+      return done(ControlResponse(error->getCode(),
+                                  "Operation " + to_string(i) + ": " + error->getText()));
+    }
+  }
+
+  applyBatch(resolved);
+  NFD_LOG_TRACE("fib/batch(" << ops.size() << "): OK");
+  done(ControlResponse(200, "Success").setBody(resolved.wireEncode()));
+}
+
+std::vector<ControlResponse>
+FibManager::applyBatch(const FibBatchParameters& batch)
+{
+  std::vector<ControlResponse> responses;
+  responses.reserve(batch.size());
+  for (const auto& op : batch.getOperations()) {
+    if (op.action == FibBatchParameters::Action::ADD_NEXTHOP) {
+      responses.push_back(doAddNextHop(op.parameters));
+    }
+    else {
+      doRemoveNextHop(op.parameters);
+      responses.push_back(ControlResponse(200, "Success").setBody(op.parameters.wireEncode()));
+    }
+  }
+  return responses;
+}
+
+std::optional<ControlResponse>
+FibManager::checkAddNextHop(const ControlParameters& parameters) const
+{
   const Name& prefix = parameters.getName();
   FaceId faceId = parameters.getFaceId();
   uint64_t cost = parameters.getCost();
@@ -64,41 +151,51 @@ FibManager::addNextHop(const Interest& interest, ControlParameters parameters,
   if (prefix.size() > Fib::getMaxDepth()) {
     NFD_LOG_DEBUG("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost <<
                   "): FAIL prefix-too-long");
-    return done(ControlResponse(414, "FIB entry prefix cannot exceed " +
-                                to_string(Fib::getMaxDepth()) + " components"));
+    return ControlResponse(414, "FIB entry prefix cannot exceed " +
+                           to_string(Fib::getMaxDepth()) + " components");
   }
 
-  Face* face = m_faceTable.get(faceId);
-  if (face == nullptr) {
+  if (m_faceTable.get(faceId) == nullptr) {
     NFD_LOG_DEBUG("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost <<
                   "): FAIL unknown-faceid");
-    return done(ControlResponse(410, "Face not found"));
+    return ControlResponse(410, "Face not found");
+  }
+
+  return std::nullopt;
+}
+
+ControlResponse
+FibManager::doAddNextHop(const ControlParameters& parameters)
+{
+  auto error = checkAddNextHop(parameters);
+  if (error) {
+    return *error;
   }
 
+  const Name& prefix = parameters.getName();
+  FaceId faceId = parameters.getFaceId();
+  uint64_t cost = parameters.getCost();
+
   fib::Entry* entry = m_fib.insert(prefix).first;
-  m_fib.addOrUpdateNextHop(*entry, *face, cost);
+  m_fib.addOrUpdateNextHop(*entry, *m_faceTable.get(faceId), cost);
 
   NFD_LOG_TRACE("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost << "): OK");
-  return done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
+  return ControlResponse(200, "Success").setBody(parameters.wireEncode());
 }
 
 void
-FibManager::removeNextHop(const Interest& interest, ControlParameters parameters,
-                          const ndn::mgmt::CommandContinuation& done)
+FibManager::doRemoveNextHop(const ControlParameters& parameters)
 {
-  setFaceForSelfRegistration(interest, parameters);
   const Name& prefix = parameters.getName();
   FaceId faceId = parameters.getFaceId();
 
-  done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
-
   Face* face = m_faceTable.get(faceId);
   if (face == nullptr) {
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK no-face");
     return;
   }
 
-  fib::Entry* entry = m_fib.findExactMatch(parameters.getName());
+  fib::Entry* entry = m_fib.findExactMatch(prefix);
   if (entry == nullptr) {
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK no-entry");
     return;
@@ -119,21 +216,53 @@ FibManager::removeNextHop(const Interest& interest, ControlParameters parameters
 }
 
 void
-FibManager::listEntries(ndn::mgmt::StatusDatasetContext& context)
+FibManager::listEntries(const Name& topPrefix, const Interest& interest,
+                        ndn::mgmt::StatusDatasetContext& context)
 {
-  for (const auto& entry : m_fib) {
-    const auto& nexthops = entry.getNextHops() |
-                           boost::adaptors::transformed([] (const fib::NextHop& nh) {
-                             return ndn::nfd::NextHopRecord()
-                                 .setFaceId(nh.getFace().getId())
-                                 .setCost(nh.getCost());
-                           });
-    context.append(ndn::nfd::FibEntry()
-                   .setPrefix(entry.getPrefix())
-                   .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
-                   .wireEncode());
+  Name filter;
+  size_t filterPos = topPrefix.size() + 2; // after "fib/list"
+  if (interest.getName().size() > filterPos) {
+    try {
+      filter.wireDecode(interest.getName()[filterPos].blockFromValue());
+    }
+    catch (const tlv::Error& e) {
+      NFD_LOG_DEBUG("Malformed prefix filter: " << e.what());
+      return context.reject(ControlResponse(400, "Malformed filter"));
+    }
   }
-  context.end();
+
+  // The name tree has no stable iteration order, so the cursor is an index into the list of
+  // prefixes taken when the request is received. Copying the names is much cheaper than
+  // encoding the entries.
+  std::vector<Name> prefixes;
+  prefixes.reserve(filter.empty() ? m_fib.size() : 0);
+  for (const auto& entry : m_fib.partialEnumerate(filter)) {
+    prefixes.push_back(entry.getPrefix());
+  }
+
+  streamStatusDataset(context, [this, prefixes = std::move(prefixes), pos = size_t(0)]
+                               (auto& context, size_t budget) mutable {
+    for (size_t length = 0; pos < prefixes.size() && length < budget; ++pos) {
+      const fib::Entry* entry = m_fib.findExactMatch(prefixes[pos]);
+      if (entry == nullptr) {
+        continue; // erased after the request was received
+      }
+
+      const auto& nexthops = entry->getNextHops() |
+                             boost::adaptors::transformed([] (const fib::NextHop& nh) {
+                               return ndn::nfd::NextHopRecord()
+                                   .setFaceId(nh.getFace().getId())
+                                   .setCost(nh.getCost());
+                             });
+      Block block = ndn::nfd::FibEntry()
+                    .setPrefix(entry->getPrefix())
+                    .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
+                    .wireEncode();
+      context.append(block);
+      length += block.size();
+    }
+    return pos == prefixes.size();
+  });
 }
 
 void
@@ -150,4 +279,19 @@ FibManager::setFaceForSelfRegistration(const Interest& request, ControlParameter
   }
 }
 
+void
+FibManager::notifyFibEvent(ndn::nfd::RouteEventKind kind, const Name& prefix,
+                           const fib::NextHop& nexthop)
+{
+  ndn::nfd::FibEventNotification notification;
+  notification.setKind(kind)
+              .setSequence(m_nextEventSequence++)
+              .setName(prefix)
+              .setNextHop(ndn::nfd::NextHopRecord()
+                          .setFaceId(nexthop.getFace().getId())
+                          .setCost(nexthop.getCost()));
+
+  m_postNotification(notification.wireEncode());
+}
+
 } // namespace nfd
@@ -27,11 +27,15 @@
 #define NFD_DAEMON_MGMT_FIB_MANAGER_HPP
 
 #include "manager-base.hpp"
+#include "fib-batch-parameters.hpp"
+
+#include <ndn-cxx/encoding/nfd-constants.hpp>
 
 namespace nfd {
 
 namespace fib {
 class Fib;
+class NextHop;
 } // namespace fib
 
 class FaceTable;
@@ -46,6 +50,17 @@ public:
   FibManager(fib::Fib& fib, const FaceTable& faceTable,
              Dispatcher& dispatcher, CommandAuthenticator& authenticator);
 
+  /**
+   * @brief Applies the operations of a batch on behalf of an in-process component.
+   *
+   * Unlike the fib/batch command, operations are applied independently of each other:
+   * a failed operation does not prevent the others from being applied.
+   *
+   * @return a response for each operation, in the same order as the operations
+   */
+  std::vector<ControlResponse>
+  applyBatch(const FibBatchParameters& batch);
+
 private:
   void
   addNextHop(const Interest& interest, ControlParameters parameters,
@@ -55,16 +70,56 @@ private:
   removeNextHop(const Interest& interest, ControlParameters parameters,
                 const ndn::mgmt::CommandContinuation& done);
 
+  /**
+   * @brief Handles fib/batch, which applies either all operations or none of them.
+   */
   void
-  listEntries(ndn::mgmt::StatusDatasetContext& context);
+  applyBatchCommand(const Interest& interest, const FibBatchParameters& batch,
+                    const ndn::mgmt::CommandContinuation& done);
+
+  /**
+   * @brief Handles fib/list, optionally followed by a name component that holds a Name TLV,
+   *        in which case only the entries under that name are listed.
+   */
+  void
+  listEntries(const Name& topPrefix, const Interest& interest,
+              ndn::mgmt::StatusDatasetContext& context);
 
 private:
   void
   setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters);
 
+  /**
+   * @brief Checks whether a nexthop can be added, without modifying the FIB.
+   * @return an error response, or nullopt if the nexthop can be added
+   */
+  std::optional<ControlResponse>
+  checkAddNextHop(const ControlParameters& parameters) const;
+
+  ControlResponse
+  doAddNextHop(const ControlParameters& parameters);
+
+  void
+  doRemoveNextHop(const ControlParameters& parameters);
+
+private: // NotificationStream
+  /**
+   * @brief Posts a change of a nexthop to the fib/events notification stream.
+   *
+   * Each notification carries a sequence number of its own, which increases by one with every
+   * event, so that a subscriber can tell whether it has missed any event.
+   */
+  void
+  notifyFibEvent(ndn::nfd::RouteEventKind kind, const Name& prefix, const fib::NextHop& nexthop);
+
 private:
   fib::Fib& m_fib;
   const FaceTable& m_faceTable;
+  ndn::mgmt::PostNotification m_postNotification;
+  uint64_t m_nextEventSequence = 0;
+  signal::ScopedConnection m_nextHopAddConn;
+  signal::ScopedConnection m_nextHopUpdateConn;
+  signal::ScopedConnection m_nextHopRemoveConn;
 };
 
 } // namespace nfd
@@ -24,6 +24,7 @@
  */
 
 #include "forwarder-status-manager.hpp"
+#include "admission-status.hpp"
 #include "fw/forwarder.hpp"
 #include "core/version.hpp"
 
@@ -36,6 +37,8 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
     [this] (auto&&, auto&&, auto&& ctx) { listGeneralStatus(std::forward<decltype(ctx)>(ctx)); });
+  m_dispatcher.addStatusDataset("status/admission", ndn::mgmt::makeAcceptAllAuthorization(),
+    [this] (auto&&, auto&&, auto&& ctx) { listAdmissionStatus(std::forward<decltype(ctx)>(ctx)); });
 }
 
 ndn::nfd::ForwarderStatus
@@ -78,4 +81,43 @@ ForwarderStatusManager::listGeneralStatus(ndn::mgmt::StatusDatasetContext& conte
   context.end();
 }
 
+void
+ForwarderStatusManager::listAdmissionStatus(ndn::mgmt::StatusDatasetContext& context)
+{
+  const auto& admission = m_forwarder.getInterestAdmission();
+  auto now = time::steady_clock::now();
+
+  auto makeBucket = [now] (const fw::InterestAdmission::BucketState& state) {
+    TokenBucket bucket = state.bucket;
+    return AdmissionStatus::Bucket{static_cast<uint64_t>(bucket.getRate()),
+                                   static_cast<uint64_t>(bucket.getBurst()),
+                                   static_cast<uint64_t>(bucket.getTokens(now)),
+                                   state.nAdmitted, state.nRejected};
+  };
+
+  for (const auto& [prefix, state] : admission.getPrefixStates()) {
+    AdmissionStatus status;
+    status.prefix = prefix;
+    status.bucket = makeBucket(state);
+    context.append(status.wireEncode());
+  }
+
+  for (const Face& face : m_forwarder.getFaceTable()) {
+    AdmissionStatus status;
+    status.faceId = face.getId();
+    auto it = admission.getFaceStates().find(face.getId());
+    if (it != admission.getFaceStates().end()) {
+      status.bucket = makeBucket(it->second);
+    }
+    if (const auto* scheduler = face.getInterestScheduler(); scheduler != nullptr) {
+      status.egress = AdmissionStatus::Egress{scheduler->getQueueLength(), scheduler->getNDropped()};
+    }
+    if (status.bucket || status.egress) {
+      context.append(status.wireEncode());
+    }
+  }
+
+  context.end();
+}
+
 } // namespace nfd
@@ -53,6 +53,13 @@ private:
   void
   listGeneralStatus(ndn::mgmt::StatusDatasetContext& context);
 
+  /**
+   * \brief Provides the admission status dataset, one AdmissionStatus per token bucket of the
+   *        Interest admission stage and per face that shapes its outgoing Interests.
+   */
+  void
+  listAdmissionStatus(ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder& m_forwarder;
   Dispatcher& m_dispatcher;
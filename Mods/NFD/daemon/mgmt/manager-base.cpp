@@ -24,6 +24,7 @@
  */
 
 #include "manager-base.hpp"
+#include "common/global.hpp"
 
 namespace nfd {
 
@@ -53,9 +54,9 @@ ManagerBase::registerStatusDatasetHandler(const std::string& verb,
 }
 
 ndn::mgmt::PostNotification
-ManagerBase::registerNotificationStream(const std::string& verb)
+ManagerBase::registerNotificationStream(const std::string& verb, const Name& topPrefix)
 {
-  return m_dispatcher.addNotificationStream(makeRelPrefix(verb));
+  return m_dispatcher.addNotificationStream(makeRelPrefix(verb), topPrefix);
 }
 
 std::string
@@ -75,6 +76,41 @@ ManagerBase::extractSigner(const Interest& interest)
   }
 }
 
+void
+ManagerBase::streamStatusDataset(ndn::mgmt::StatusDatasetContext& context,
+                                 DatasetSliceProducer produceSlice)
+{
+  if (produceSlice(context, DATASET_SLICE_LENGTH)) {
+    context.end();
+    return;
+  }
+
+  auto stream = make_shared<DatasetStream>(DatasetStream{context.shared_from_this(),
+                                                         std::move(produceSlice)});
+  m_datasetStreams.insert(stream);
+  scheduleDatasetSlice(stream);
+}
+
+void
+ManagerBase::scheduleDatasetSlice(weak_ptr<DatasetStream> weakStream)
+{
+  getGlobalIoService().post([this, weakStream = std::move(weakStream)] {
+    // the stream is gone if the manager has been destroyed in the meantime
+    auto stream = weakStream.lock();
+    if (stream == nullptr) {
+      return;
+    }
+
+    if (stream->produceSlice(*stream->context, DATASET_SLICE_LENGTH)) {
+      stream->context->end();
+      m_datasetStreams.erase(stream);
+    }
+    else {
+      scheduleDatasetSlice(stream);
+    }
+  });
+}
+
 ndn::mgmt::Authorization
 ManagerBase::makeAuthorization(const std::string& verb)
 {
@@ -83,12 +83,31 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PROTECTED: // registrations to the dispatcher
   registerCommandHandler(const std::string& verb,
                          const ControlCommandHandler& handler);
 
+  /**
+   * @brief Registers a command whose parameters are of type @p Parameters rather than
+   *        ndn::nfd::ControlParameters.
+   * @tparam Parameters subclass of ndn::mgmt::ControlParameters constructible from a Block
+   */
+  template<typename Parameters>
+  void
+  registerCommandHandler(const std::string& verb,
+                         ndn::mgmt::ValidateParameters validate,
+                         ndn::mgmt::ControlCommandHandler handler)
+  {
+    m_dispatcher.addControlCommand<Parameters>(makeRelPrefix(verb), makeAuthorization(verb),
+                                               std::move(validate), std::move(handler));
+  }
+
   void
   registerStatusDatasetHandler(const std::string& verb,
                                const ndn::mgmt::StatusDatasetHandler& handler);
 
+  /**
+   * @brief Registers a notification stream.
+   * @param topPrefix if not empty, notifications are published only under this top-level prefix
+   */
   ndn::mgmt::PostNotification
-  registerNotificationStream(const std::string& verb);
+  registerNotificationStream(const std::string& verb, const Name& topPrefix = {});
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PROTECTED: // helpers
   /**
@@ -100,6 +119,29 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PROTECTED: // helpers
   static std::string
   extractSigner(const Interest& interest);
 
+  /**
+   * @brief Appends entries of a status dataset, starting from a cursor kept by the function.
+   *
+   * The function appends entries to @p context until about @p budget octets have been
+   * appended or no entry is left, and returns whether all entries have been appended.
+   */
+  using DatasetSliceProducer = std::function<bool(ndn::mgmt::StatusDatasetContext& context,
+                                                  size_t budget)>;
+
+  /**
+   * @brief Produces a status dataset in slices of about one segment.
+   *
+   * The first slice is produced immediately, and each of the following slices in a later turn
+   * of the io_service, so that forwarding is not paused while a large table is encoded.
+   * The table may be modified between slices, hence @p produceSlice must keep a cursor that
+   * remains valid, such as the key of the next entry, rather than an iterator.
+   */
+  void
+  streamStatusDataset(ndn::mgmt::StatusDatasetContext& context, DatasetSliceProducer produceSlice);
+
+public:
+  static constexpr size_t DATASET_SLICE_LENGTH = 8000;
+
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /**
    * @brief Returns an authorization function for a specific management module and verb.
@@ -139,10 +181,22 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     return PartialName(m_module).append(verb);
   }
 
+private:
+  struct DatasetStream
+  {
+    shared_ptr<ndn::mgmt::StatusDatasetContext> context;
+    DatasetSliceProducer produceSlice;
+  };
+
+  void
+  scheduleDatasetSlice(weak_ptr<DatasetStream> stream);
+
 private:
   std::string m_module;
   Dispatcher& m_dispatcher;
   CommandAuthenticator* m_authenticator = nullptr;
+  // status datasets whose production is in progress
+  std::set<shared_ptr<DatasetStream>> m_datasetStreams;
 };
 
 template<typename Command>
@@ -32,6 +32,7 @@
 
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/rib-event-notification.hpp>
 #include <ndn-cxx/mgmt/nfd/status-dataset.hpp>
 #include <ndn-cxx/security/certificate-fetcher-direct-fetch.hpp>
 
@@ -65,6 +66,17 @@ RibManager::RibManager(rib::Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
     [this] (auto&&, auto&&, auto&&... args) { unregisterEntry(std::forward<decltype(args)>(args)...); });
   registerStatusDatasetHandler("list",
     [this] (auto&&, auto&&, auto&&... args) { listEntries(std::forward<decltype(args)>(args)...); });
+
+  m_postNotification = registerNotificationStream("events", LOCALHOST_TOP_PREFIX);
+  m_routeAddConn = m_rib.afterAddRoute.connect([this] (const auto& routeRef) {
+    notifyRibEvent(ndn::nfd::ROUTE_EVENT_ADDED, routeRef);
+  });
+  m_routeUpdateConn = m_rib.afterUpdateRoute.connect([this] (const auto& routeRef) {
+    notifyRibEvent(ndn::nfd::ROUTE_EVENT_UPDATED, routeRef);
+  });
+  m_routeRemoveConn = m_rib.beforeRemoveRoute.connect([this] (const auto& routeRef) {
+    notifyRibEvent(ndn::nfd::ROUTE_EVENT_REMOVED, routeRef);
+  });
 }
 
 void
@@ -284,6 +296,29 @@ RibManager::listEntries(ndn::mgmt::StatusDatasetContext& context)
   context.end();
 }
 
+void
+RibManager::notifyRibEvent(ndn::nfd::RouteEventKind kind, const rib::RibRouteRef& routeRef)
+{
+  const Route& route = *routeRef.route;
+  ndn::nfd::Route record;
+  record.setFaceId(route.faceId)
+        .setOrigin(route.origin)
+        .setCost(route.cost)
+        .setFlags(route.flags);
+  if (route.expires) {
+    record.setExpirationPeriod(time::duration_cast<time::milliseconds>(
+                                 *route.expires - time::steady_clock::now()));
+  }
+
+  ndn::nfd::RibEventNotification notification;
+  notification.setKind(kind)
+              .setSequence(m_nextEventSequence++)
+              .setName(routeRef.entry->getName())
+              .setRoute(record);
+
+  m_postNotification(notification.wireEncode());
+}
+
 void
 RibManager::setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters)
 {
@@ -40,6 +40,7 @@ namespace nfd {
 
 namespace rib {
 class Rib;
+struct RibRouteRef;
 class RibUpdate;
 } // namespace rib
 
@@ -237,6 +238,14 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   onNotification(const ndn::nfd::FaceEventNotification& notification);
 
+private: // NotificationStream
+  /** \brief Post a change of a route to the rib/events notification stream.
+   *
+   *  The stream is published under /localhost/nfd only, even if localhop is enabled.
+   */
+  void
+  notifyRibEvent(ndn::nfd::RouteEventKind kind, const rib::RibRouteRef& routeRef);
+
 public:
   static inline const Name LOCALHOP_TOP_PREFIX{"/localhop/nfd"};
 
@@ -253,6 +262,12 @@ private:
   bool m_isLocalhopEnabled;
 
   scheduler::ScopedEventId m_activeFaceFetchEvent;
+
+  ndn::mgmt::PostNotification m_postNotification;
+  uint64_t m_nextEventSequence = 0;
+  signal::ScopedConnection m_routeAddConn;
+  signal::ScopedConnection m_routeUpdateConn;
+  signal::ScopedConnection m_routeRemoveConn;
 };
 
 std::ostream&
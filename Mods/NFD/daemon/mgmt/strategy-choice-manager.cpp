@@ -86,13 +86,30 @@ StrategyChoiceManager::unsetStrategy(ControlParameters parameters,
 void
 StrategyChoiceManager::listChoices(ndn::mgmt::StatusDatasetContext& context)
 {
+  // the cursor is an index into the prefixes that have a strategy when the request is received
+  std::vector<Name> prefixes;
+  prefixes.reserve(m_table.size());
   for (const auto& i : m_table) {
-    ndn::nfd::StrategyChoice entry;
-    entry.setName(i.getPrefix())
-         .setStrategy(i.getStrategyInstanceName());
-    context.append(entry.wireEncode());
+    prefixes.push_back(i.getPrefix());
   }
-  context.end();
+
+  streamStatusDataset(context, [this, prefixes = std::move(prefixes), pos = size_t(0)]
+                               (auto& context, size_t budget) mutable {
+    for (size_t length = 0; pos < prefixes.size() && length < budget; ++pos) {
+      auto [hasEntry, strategy] = m_table.get(prefixes[pos]);
+      if (!hasEntry) {
+        continue; // unset after the request was received
+      }
+
+      ndn::nfd::StrategyChoice entry;
+      entry.setName(prefixes[pos])
+           .setStrategy(strategy);
+      Block block = entry.wireEncode();
+      context.append(block);
+      length += block.size();
+    }
+    return pos == prefixes.size();
+  });
 }
 
 } // namespace nfd
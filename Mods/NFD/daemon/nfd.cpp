@@ -201,6 +201,15 @@ Nfd::reloadConfigFile()
   }
 }
 
+void
+Nfd::applyFibBatch(FibBatchParameters batch,
+                   std::function<void(std::vector<ndn::nfd::ControlResponse>)> done)
+{
+  runOnMainIoService([this, batch = std::move(batch), done = std::move(done)] {
+    done(m_fibManager->applyBatch(batch));
+  });
+}
+
 void
 Nfd::reloadConfigFileFaceSection()
 {
@@ -27,9 +27,11 @@
 #define NFD_DAEMON_NFD_HPP
 
 #include "common/config-file.hpp"
+#include "mgmt/fib-batch-parameters.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/mgmt/dispatcher.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/net/network-monitor.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
 
@@ -93,6 +95,16 @@ public:
   void
   reloadConfigFile();
 
+  /**
+   * \brief Apply a batch of FIB operations requested by a component in another thread.
+   *
+   * The operations are applied in the main thread, then \p done is invoked in the main
+   * thread with one response per operation.
+   */
+  void
+  applyFibBatch(FibBatchParameters batch,
+                std::function<void(std::vector<ndn::nfd::ControlResponse>)> done);
+
 private:
   explicit
   Nfd(ndn::KeyChain& keyChain);
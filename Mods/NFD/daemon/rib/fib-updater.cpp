@@ -57,6 +57,8 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
   // Erase previously calculated FIB updates
   m_updatesForBatchFaceId.clear();
   m_updatesForNonBatchFaceId.clear();
+  m_updateIndex.clear();
+  BOOST_ASSERT(m_nUpdatesInFlight == 0);
 
   computeUpdates(batch);
 
@@ -82,6 +84,9 @@ FibUpdater::computeUpdates(const RibUpdateBatch& batch)
 
         // Do not apply updates with the same face ID as the destroyed face
         // since they will be rejected by the FIB
+        for (const FibUpdate& fibUpdate : m_updatesForBatchFaceId) {
+          m_updateIndex.erase({fibUpdate.name, fibUpdate.faceId});
+        }
         m_updatesForBatchFaceId.clear();
         break;
     }
@@ -123,19 +128,9 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
   }
   else {
     // New name in RIB
-    // Find prefix's parent
-    shared_ptr<RibEntry> parent = m_rib.findParent(prefix);
-
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(prefix);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
+    // The entries below the new name without another entry in between
+    // will be the children of the new entry
+    Rib::RibEntryList children = m_rib.findChildren(prefix);
 
     createFibUpdatesForNewRibEntry(prefix, route, children);
   }
@@ -188,16 +183,76 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
 {
   NFD_LOG_DEBUG("Applying " << updates.size() << " FIB update(s)");
 
-  for (const FibUpdate& update : updates) {
-    NFD_LOG_DEBUG("Sending " << update);
+  m_nextUpdate = updates.begin();
+  m_updatesEnd = updates.end();
+  m_nRemainingUpdates = updates.size();
+
+  if (m_inProcessFib) {
+    sendUpdatesInProcess(onSuccess, onFailure);
+  }
+  else {
+    fillWindow(onSuccess, onFailure);
+  }
+}
+
+void
+FibUpdater::sendUpdatesInProcess(const FibUpdateSuccessCallback& onSuccess,
+                                 const FibUpdateFailureCallback& onFailure)
+{
+  std::vector<FibUpdate> updates(m_nextUpdate, m_updatesEnd);
+  m_nextUpdate = m_updatesEnd;
+  m_nUpdatesInFlight += updates.size();
 
+  FibBatchParameters batch;
+  for (const auto& update : updates) {
     if (update.action == FibUpdate::ADD_NEXTHOP) {
-      sendAddNextHopUpdate(update, onSuccess, onFailure);
+      batch.addNextHop(update.name, update.faceId, update.cost);
     }
     else if (update.action == FibUpdate::REMOVE_NEXTHOP) {
-      sendRemoveNextHopUpdate(update, onSuccess, onFailure);
+      batch.removeNextHop(update.name, update.faceId);
     }
   }
+
+  m_inProcessFib(std::move(batch),
+    [=, updates = std::move(updates)] (const std::vector<ndn::nfd::ControlResponse>& responses) {
+      BOOST_ASSERT(responses.size() == updates.size());
+      for (size_t i = 0; i < updates.size(); ++i) {
+        if (responses[i].getCode() == 200) {
+          onUpdateSuccess(updates[i], onSuccess, onFailure);
+        }
+        else {
+          // the in-process channel cannot time out, so errors are not retried
+          onUpdateError(updates[i], onSuccess, onFailure, responses[i], MAX_NUM_TIMEOUTS);
+        }
+      }
+    });
+}
+
+void
+FibUpdater::fillWindow(const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure)
+{
+  while (m_nUpdatesInFlight < MAX_UPDATES_IN_FLIGHT && m_nextUpdate != m_updatesEnd) {
+    const FibUpdate& update = *m_nextUpdate++;
+    ++m_nUpdatesInFlight;
+    sendUpdate(update, onSuccess, onFailure);
+  }
+}
+
+void
+FibUpdater::sendUpdate(const FibUpdate& update,
+                       const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure,
+                       uint32_t nTimeouts)
+{
+  NFD_LOG_DEBUG("Sending " << update);
+
+  if (update.action == FibUpdate::ADD_NEXTHOP) {
+    sendAddNextHopUpdate(update, onSuccess, onFailure, nTimeouts);
+  }
+  else if (update.action == FibUpdate::REMOVE_NEXTHOP) {
+    sendRemoveNextHopUpdate(update, onSuccess, onFailure, nTimeouts);
+  }
 }
 
 void
@@ -258,19 +313,35 @@ FibUpdater::onUpdateSuccess(const FibUpdate& update,
                             const FibUpdateSuccessCallback& onSuccess,
                             const FibUpdateFailureCallback& onFailure)
 {
-  if (update.faceId == m_batchFaceId) {
-    m_updatesForBatchFaceId.remove(update);
+  onUpdateDone(update, onSuccess, onFailure);
+}
 
-    if (m_updatesForBatchFaceId.size() == 0) {
-      sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+void
+FibUpdater::onUpdateDone(const FibUpdate& update,
+                         const FibUpdateSuccessCallback& onSuccess,
+                         const FibUpdateFailureCallback& onFailure)
+{
+  BOOST_ASSERT(m_nUpdatesInFlight > 0);
+  --m_nUpdatesInFlight;
+  --m_nRemainingUpdates;
+
+  if (m_failure) {
+    if (m_nUpdatesInFlight == 0) {
+      auto [code, error] = std::move(*m_failure);
+      m_failure.reset();
+      onFailure(code, error);
     }
+    return;
   }
-  else {
-    m_updatesForNonBatchFaceId.remove(update);
 
-    if (m_updatesForNonBatchFaceId.size() == 0) {
-      onSuccess(m_inheritedRoutes);
-    }
+  if (m_nRemainingUpdates > 0) {
+    fillWindow(onSuccess, onFailure);
+  }
+  else if (update.faceId == m_batchFaceId) {
+    sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+  }
+  else {
+    onSuccess(m_inheritedRoutes);
   }
 }
 
@@ -285,19 +356,15 @@ FibUpdater::onUpdateError(const FibUpdate& update,
                 " [code: " << code << ", error: " << response.getText() << "]");
 
   if (code == ndn::nfd::Controller::ERROR_TIMEOUT && nTimeouts < MAX_NUM_TIMEOUTS) {
-    sendAddNextHopUpdate(update, onSuccess, onFailure, ++nTimeouts);
+    sendUpdate(update, onSuccess, onFailure, ++nTimeouts);
   }
   else if (code == ERROR_FACE_NOT_FOUND) {
-    if (update.faceId == m_batchFaceId) {
-      onFailure(code, response.getText());
-    }
-    else {
-      m_updatesForNonBatchFaceId.remove(update);
-
-      if (m_updatesForNonBatchFaceId.size() == 0) {
-        onSuccess(m_inheritedRoutes);
-      }
+    if (update.faceId == m_batchFaceId && !m_failure) {
+      // stop sending, and fail once the updates in flight have completed
+      m_failure.emplace(code, response.getText());
+      m_nextUpdate = m_updatesEnd;
     }
+    onUpdateDone(update, onSuccess, onFailure);
   }
   else {
     NDN_THROW(Error("Non-recoverable error: " + response.getText() + " code: " + to_string(code)));
@@ -311,18 +378,15 @@ FibUpdater::addFibUpdate(const FibUpdate& update)
                                                               m_updatesForNonBatchFaceId;
 
   // If an update with the same name and route already exists, replace it
-  auto it = std::find_if(updates.begin(), updates.end(),
-    [&update] (const FibUpdate& other) {
-      return update.name == other.name && update.faceId == other.faceId;
-    });
+  auto [indexIt, isNew] = m_updateIndex.try_emplace({update.name, update.faceId});
 
-  if (it != updates.end()) {
-    FibUpdate& existingUpdate = *it;
+  if (!isNew) {
+    FibUpdate& existingUpdate = *indexIt->second;
     existingUpdate.action = update.action;
     existingUpdate.cost = update.cost;
   }
   else {
-    updates.push_back(update);
+    indexIt->second = updates.insert(updates.end(), update);
   }
 }
 
@@ -30,7 +30,9 @@
 #include "fib-update.hpp"
 #include "rib.hpp"
 #include "rib-update-batch.hpp"
+#include "mgmt/fib-batch-parameters.hpp"
 
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/mgmt/nfd/controller.hpp>
 
 namespace nfd::rib {
@@ -51,6 +53,14 @@ public:
   using FibUpdateSuccessCallback = std::function<void(RibUpdateList inheritedRoutes)>;
   using FibUpdateFailureCallback = std::function<void(uint32_t code, const std::string& error)>;
 
+  /** \brief A channel to the FIB of a forwarder running in the same process.
+   *
+   *  The function applies the operations of the batch and invokes the continuation, in the
+   *  thread of the FibUpdater, with one response per operation.
+   */
+  using InProcessFib = std::function<void(FibBatchParameters batch,
+                                          std::function<void(std::vector<ndn::nfd::ControlResponse>)> done)>;
+
   FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
 
 #ifdef NFD_WITH_TESTS
@@ -69,6 +79,16 @@ public:
                            const FibUpdateSuccessCallback& onSuccess,
                            const FibUpdateFailureCallback& onFailure);
 
+  /** \brief Sends FIB updates through \p fib instead of signed management commands.
+   *
+   *  Each list of updates is then applied as a single batch, without a window.
+   */
+  void
+  setInProcessFib(InProcessFib fib)
+  {
+    m_inProcessFib = std::move(fib);
+  }
+
 private:
   /**
    * \brief Determines the type of action that will be performed on the RIB and calls the
@@ -80,6 +100,9 @@ private:
   /**
    * \brief Sends the passed updates to NFD.
    *
+   * At most MAX_UPDATES_IN_FLIGHT commands are outstanding at any time; each completed
+   * command makes room for the next one.
+   *
    * onSuccess or onFailure will be called based on the results in
    * onUpdateSuccess or onUpdateFailure.
    *
@@ -91,6 +114,39 @@ private:
               const FibUpdateSuccessCallback& onSuccess,
               const FibUpdateFailureCallback& onFailure);
 
+  /**
+   * \brief Sends the remaining updates of the current list through m_inProcessFib.
+   */
+  void
+  sendUpdatesInProcess(const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure);
+
+  /**
+   * \brief Sends updates from the current list until the window is full.
+   */
+  void
+  fillWindow(const FibUpdateSuccessCallback& onSuccess,
+             const FibUpdateFailureCallback& onFailure);
+
+  /**
+   * \brief Sends a FibAddNextHopCommand or a FibRemoveNextHopCommand, depending on the
+   *        action of \p update.
+   */
+  void
+  sendUpdate(const FibUpdate& update,
+             const FibUpdateSuccessCallback& onSuccess,
+             const FibUpdateFailureCallback& onFailure,
+             uint32_t nTimeouts = 0);
+
+  /**
+   * \brief Accounts for an update that will not be retried, and sends the next updates
+   *        or completes the FIB update process.
+   */
+  void
+  onUpdateDone(const FibUpdate& update,
+               const FibUpdateSuccessCallback& onSuccess,
+               const FibUpdateFailureCallback& onFailure);
+
   /**
    * \brief Sends the updates in m_updatesForBatchFaceId to NFD if any exist,
    *        otherwise calls FibUpdater::sendUpdatesForNonBatchFaceId.
@@ -148,13 +204,13 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
    * \brief Callback used by NfdController when a FibAddNextHopCommand or FibRemoveNextHopCommand
    *        is successful.
    *
-   * If the update has the same Face ID as the batch being processed, the update is
-   * removed from m_updatesForBatchFaceId. If m_updatesForBatchFaceId becomes empty,
+   * If all updates with the same Face ID as the batch being processed have completed,
    * the updates with a different Face ID than the batch are sent to NFD.
    *
-   * If the update has a different Face ID than the batch being processed, the update is
-   * removed from m_updatesForBatchNonFaceId. If m_updatesForBatchNonFaceId becomes empty,
+   * If all updates with a different Face ID than the batch being processed have completed,
    * the FIB update process is considered a success.
+   *
+   * Otherwise, the next update is sent.
    */
   void
   onUpdateSuccess(const FibUpdate& update,
@@ -169,7 +225,8 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
    * is retried.
    *
    * If the update failed due to a non-existent face and the update has the same Face ID
-   * as the update batch, the FIB update process fails.
+   * as the update batch, the FIB update process fails once the other outstanding
+   * updates have completed.
    *
    * If the update failed due to a non-existent face and the update has a different
    * face than the update batch, the update is not retried and the error is
@@ -274,11 +331,28 @@ private:
   void
   removeInheritedRoute(const Name& name, const Route& route);
 
+public:
+  /// maximum number of FIB commands awaiting a response
+  static constexpr size_t MAX_UPDATES_IN_FLIGHT = 64;
+
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  InProcessFib m_inProcessFib;
   uint64_t m_batchFaceId;
 
+  // (name, FaceId) => pending update in m_updatesForBatchFaceId or m_updatesForNonBatchFaceId
+  std::map<std::pair<Name, uint64_t>, FibUpdateList::iterator> m_updateIndex;
+
+  // next update to send, and end of the list being sent
+  FibUpdateList::const_iterator m_nextUpdate;
+  FibUpdateList::const_iterator m_updatesEnd;
+  // updates of the list being sent that have not completed
+  size_t m_nRemainingUpdates = 0;
+  size_t m_nUpdatesInFlight = 0;
+  // set when the batch has failed, reported once the updates in flight have completed
+  std::optional<std::pair<uint32_t, std::string>> m_failure;
+
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   FibUpdateList m_updatesForBatchFaceId;
   FibUpdateList m_updatesForNonBatchFaceId;
@@ -101,7 +101,8 @@ RibEntry::addChild(shared_ptr<RibEntry> child)
 {
   BOOST_ASSERT(!child->getParent());
   child->setParent(this->shared_from_this());
-  m_children.push_back(std::move(child));
+  m_children.push_back(child);
+  child->m_positionInParent = std::prev(m_children.end());
 }
 
 void
@@ -109,7 +110,7 @@ RibEntry::removeChild(shared_ptr<RibEntry> child)
 {
   BOOST_ASSERT(child->getParent().get() == this);
   child->setParent(nullptr);
-  m_children.remove(child);
+  m_children.erase(child->m_positionInParent);
 }
 
 RibEntry::RouteList::iterator
@@ -29,6 +29,7 @@
 #include "route.hpp"
 
 #include <list>
+#include <set>
 
 namespace nfd::rib {
 
@@ -42,6 +43,10 @@ public:
   using iterator = RouteList::iterator;
   using const_iterator = RouteList::const_iterator;
 
+  using RouteComparePredicate = bool (*)(const Route&, const Route&);
+  /// A set of routes with distinct FaceIds
+  using RouteSet = std::set<Route, RouteComparePredicate>;
+
   void
   setName(const Name& prefix);
 
@@ -142,6 +147,27 @@ public:
   bool
   hasCapture() const;
 
+  /** \brief Returns the routes inherited by the children of this namespace, or nullptr if
+   *         there are none.
+   *
+   *  These are the routes with the child inherit flag set on this namespace and, unless
+   *  this namespace has capture set, the routes inherited from its parent. Entries that do
+   *  not change the inherited routes share the set of their parent.
+   *
+   *  \note This cache is maintained by Rib.
+   */
+  const shared_ptr<const RouteSet>&
+  getInheritableRoutes() const
+  {
+    return m_inheritableRoutes;
+  }
+
+  void
+  setInheritableRoutes(shared_ptr<const RouteSet> routes)
+  {
+    m_inheritableRoutes = std::move(routes);
+  }
+
   /** \brief Determines if the entry has an inherited route with the passed
    *         face ID and its child inherit flag set.
    *  \return True, if a matching inherited route is found; otherwise, false.
@@ -200,6 +226,9 @@ private:
   Name m_name;
   std::list<shared_ptr<RibEntry>> m_children;
   shared_ptr<RibEntry> m_parent;
+  // position of this entry in the children of m_parent
+  std::list<shared_ptr<RibEntry>>::iterator m_positionInParent;
+  shared_ptr<const RouteSet> m_inheritableRoutes;
   RouteList m_routes;
   RouteList m_inheritedRoutes;
 
@@ -38,6 +38,8 @@ operator<(const RibRouteRef& lhs, const RibRouteRef& rhs)
          std::tie(rhs.entry->getName(), rhs.route->faceId, rhs.route->origin);
 }
 
+constexpr size_t MAX_BATCH_SIZE = 1024;
+
 static inline bool
 sortRoutes(const Route& lhs, const Route& rhs)
 {
@@ -114,8 +116,14 @@ Rib::insert(const Name& prefix, const Route& route)
         entryIt->cancelExpirationEvent();
       }
 
+      bool isChanged = entryIt->cost != route.cost || entryIt->flags != route.flags;
       *entryIt = route;
+      if (isChanged) {
+        afterUpdateRoute(RibRouteRef{entry, entryIt});
+      }
     }
+
+    refreshInheritableRoutes(*entry);
   }
   else {
     // New name prefix
@@ -135,15 +143,30 @@ Rib::insert(const Name& prefix, const Route& route)
       parent->addChild(entry);
     }
 
-    auto children = findDescendants(prefix);
+    // Take the entries below the new entry from its parent
+    auto children = findChildren(prefix);
     for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
-        entry->addChild(child);
+      BOOST_ASSERT(child->getParent() == parent);
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+      entry->addChild(child);
+    }
+
+    // Index the entry in the name trie
+    TrieNode* node = &m_trieRoot;
+    for (const auto& comp : prefix) {
+      auto& next = node->children[comp];
+      if (next == nullptr) {
+        next = make_unique<TrieNode>();
+      }
+      node = next.get();
+    }
+    node->entry = entry;
+
+    refreshInheritableRoutes(*entry);
+    for (const auto& child : children) {
+      refreshInheritableRoutes(*child);
     }
 
     // Register with face lookup table
@@ -189,6 +212,9 @@ Rib::erase(const Name& prefix, const Route& route)
     if (entry->getRoutes().empty()) {
       eraseEntry(ribIt);
     }
+    else {
+      refreshInheritableRoutes(*entry);
+    }
   }
 }
 
@@ -208,49 +234,86 @@ Rib::onRouteExpiration(const Name& prefix, const Route& route)
 shared_ptr<RibEntry>
 Rib::findParent(const Name& prefix) const
 {
-  for (int i = prefix.size() - 1; i >= 0; i--) {
-    auto it = m_rib.find(prefix.getPrefix(i));
-    if (it != m_rib.end()) {
-      return it->second;
+  shared_ptr<RibEntry> parent;
+  const TrieNode* node = &m_trieRoot;
+  for (size_t i = 0; i < prefix.size(); ++i) {
+    if (node->entry != nullptr) {
+      parent = node->entry;
+    }
+    auto it = node->children.find(prefix[i]);
+    if (it == node->children.end()) {
+      break;
     }
+    node = it->second.get();
   }
 
-  return nullptr;
+  return parent;
 }
 
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendants(const Name& prefix) const
+Rib::RibEntryList
+Rib::findChildren(const Name& prefix) const
 {
-  std::list<shared_ptr<RibEntry>> children;
-
-  auto it = m_rib.find(prefix);
-  if (it != m_rib.end()) {
-    ++it;
-    for (; it != m_rib.end(); ++it) {
-      if (prefix.isPrefixOf(it->first)) {
-        children.push_back(it->second);
-      }
-      else {
-        break;
-      }
+  RibEntryList children;
+
+  const TrieNode* node = findNode(prefix);
+  if (node == nullptr) {
+    return children;
+  }
+
+  // depth-first traversal in canonical order, which stops at the first entry on each branch
+  std::vector<const TrieNode*> stack;
+  auto pushChildren = [&stack] (const TrieNode& n) {
+    for (auto it = n.children.rbegin(); it != n.children.rend(); ++it) {
+      stack.push_back(it->second.get());
+    }
+  };
+  pushChildren(*node);
+  while (!stack.empty()) {
+    const TrieNode* n = stack.back();
+    stack.pop_back();
+    if (n->entry != nullptr) {
+      children.push_back(n->entry);
+    }
+    else {
+      pushChildren(*n);
     }
   }
 
   return children;
 }
 
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendantsForNonInsertedName(const Name& prefix) const
+const Rib::TrieNode*
+Rib::findNode(const Name& prefix) const
 {
-  std::list<shared_ptr<RibEntry>> children;
-
-  for (const auto& [name, ribEntry] : m_rib) {
-    if (prefix.isPrefixOf(name)) {
-      children.push_back(ribEntry);
+  const TrieNode* node = &m_trieRoot;
+  for (const auto& comp : prefix) {
+    auto it = node->children.find(comp);
+    if (it == node->children.end()) {
+      return nullptr;
     }
+    node = it->second.get();
   }
+  return node;
+}
 
-  return children;
+void
+Rib::eraseNode(const Name& prefix)
+{
+  std::vector<TrieNode*> path{&m_trieRoot};
+  for (const auto& comp : prefix) {
+    auto it = path.back()->children.find(comp);
+    BOOST_ASSERT(it != path.back()->children.end());
+    path.push_back(it->second.get());
+  }
+  path.back()->entry = nullptr;
+
+  for (size_t depth = prefix.size(); depth > 0; --depth) {
+    const TrieNode* node = path[depth];
+    if (node->entry != nullptr || !node->children.empty()) {
+      break;
+    }
+    path[depth - 1]->children.erase(prefix[depth - 1]);
+  }
 }
 
 Rib::RibTable::iterator
@@ -282,8 +345,12 @@ Rib::eraseEntry(RibTable::iterator it)
     if (parent != nullptr) {
       parent->addChild(child);
     }
+
+    // The child now inherits from the former parent
+    refreshInheritableRoutes(*child);
   }
 
+  eraseNode(entry->getName());
   auto nextIt = m_rib.erase(it);
 
   // do something after erasing an entry
@@ -295,47 +362,67 @@ Rib::eraseEntry(RibTable::iterator it)
 Rib::RouteSet
 Rib::getAncestorRoutes(const RibEntry& entry) const
 {
-  RouteSet ancestorRoutes(&sortRoutes);
-
   auto parent = entry.getParent();
-  while (parent != nullptr) {
-    for (const auto& route : parent->getRoutes()) {
-      if (route.isChildInherit()) {
-        ancestorRoutes.insert(route);
-      }
-    }
-
-    if (parent->hasCapture()) {
-      break;
-    }
-
-    parent = parent->getParent();
+  if (parent == nullptr || parent->getInheritableRoutes() == nullptr) {
+    return RouteSet(&sortRoutes);
   }
-
-  return ancestorRoutes;
+  return *parent->getInheritableRoutes();
 }
 
 Rib::RouteSet
 Rib::getAncestorRoutes(const Name& name) const
 {
-  RouteSet ancestorRoutes(&sortRoutes);
-
   auto parent = findParent(name);
-  while (parent != nullptr) {
-    for (const auto& route : parent->getRoutes()) {
+  if (parent == nullptr || parent->getInheritableRoutes() == nullptr) {
+    return RouteSet(&sortRoutes);
+  }
+  return *parent->getInheritableRoutes();
+}
+
+void
+Rib::refreshInheritableRoutes(RibEntry& entry)
+{
+  shared_ptr<const RouteSet> parentRoutes;
+  if (entry.getParent() != nullptr) {
+    parentRoutes = entry.getParent()->getInheritableRoutes();
+  }
+
+  bool hasChildInherit = std::any_of(entry.begin(), entry.end(),
+                                     [] (const Route& r) { return r.isChildInherit(); });
+
+  shared_ptr<const RouteSet> routes;
+  if (!hasChildInherit && !entry.hasCapture()) {
+    // share the routes of the parent
+    routes = parentRoutes;
+  }
+  else {
+    auto ownRoutes = make_shared<RouteSet>(&sortRoutes);
+    for (const auto& route : entry) {
       if (route.isChildInherit()) {
-        ancestorRoutes.insert(route);
+        ownRoutes->insert(route);
       }
     }
-
-    if (parent->hasCapture()) {
-      break;
+    // routes of this entry take precedence over routes of the ancestors with the same FaceId
+    if (!entry.hasCapture() && parentRoutes != nullptr) {
+      ownRoutes->insert(parentRoutes->begin(), parentRoutes->end());
+    }
+    if (!ownRoutes->empty()) {
+      routes = std::move(ownRoutes);
     }
+  }
 
-    parent = parent->getParent();
+  const auto& oldRoutes = entry.getInheritableRoutes();
+  if (routes == oldRoutes ||
+      (routes != nullptr && oldRoutes != nullptr &&
+       std::equal(routes->begin(), routes->end(), oldRoutes->begin(), oldRoutes->end()))) {
+    // the descendants are not affected
+    return;
   }
 
-  return ancestorRoutes;
+  entry.setInheritableRoutes(std::move(routes));
+  for (const auto& child : entry.getChildren()) {
+    refreshInheritableRoutes(*child);
+  }
 }
 
 void
@@ -386,48 +473,116 @@ Rib::enqueueRemoveFace(const RibEntry& entry, uint64_t faceId)
   }
 }
 
+template<typename Callback>
+static Callback
+chainCallbacks(Callback first, Callback second)
+{
+  if (first == nullptr) {
+    return second;
+  }
+  if (second == nullptr) {
+    return first;
+  }
+  return [first = std::move(first), second = std::move(second)] (const auto&... args) {
+    first(args...);
+    second(args...);
+  };
+}
+
 void
 Rib::addUpdateToQueue(const RibUpdate& update,
                       const Rib::UpdateSuccessCallback& onSuccess,
                       const Rib::UpdateFailureCallback& onFailure)
 {
-  RibUpdateBatch batch(update.getRoute().faceId);
-  batch.add(update);
+  const Route& route = update.getRoute();
+  auto [queuedIt, isNew] = m_queuedRoutes.try_emplace({update.getName(), route.faceId, route.origin});
+
+  if (!isNew && queuedIt->second->update.getAction() == update.getAction()) {
+    UpdateQueueItem& queued = *queuedIt->second;
+    NFD_LOG_TRACE("Coalescing " << update << " with queued update");
+
+    if (update.getAction() == RibUpdate::REGISTER) {
+      // the replaced route will never be inserted, so its expiration must not fire
+      Route replaced = queued.update.getRoute();
+      replaced.cancelExpirationEvent();
+      queued.update.setRoute(route);
+    }
+    queued.managerSuccessCallback = chainCallbacks(queued.managerSuccessCallback, onSuccess);
+    queued.managerFailureCallback = chainCallbacks(queued.managerFailureCallback, onFailure);
+    return;
+  }
+
+  queuedIt->second = m_updateQueue.insert(m_updateQueue.end(), {update, onSuccess, onFailure});
+}
 
-  UpdateQueueItem item{batch, onSuccess, onFailure};
-  m_updateBatches.push_back(std::move(item));
+static bool
+isPrefixRelated(const std::set<Name>& names, const Name& name)
+{
+  // a name in the set is a descendant of, or equal to, name
+  auto it = names.lower_bound(name);
+  if (it != names.end() && name.isPrefixOf(*it)) {
+    return true;
+  }
+
+  // a name in the set is an ancestor of name
+  for (size_t i = 0; i < name.size(); ++i) {
+    if (names.count(name.getPrefix(i)) > 0) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void
 Rib::sendBatchFromQueue()
 {
-  if (m_updateBatches.empty() || m_isUpdateInProgress) {
+  if (m_updateQueue.empty() || m_isUpdateInProgress) {
     return;
   }
 
   m_isUpdateInProgress = true;
 
-  UpdateQueueItem item = std::move(m_updateBatches.front());
-  m_updateBatches.pop_front();
+  const RibUpdate& first = m_updateQueue.front().update;
+  const uint64_t faceId = first.getRoute().faceId;
+  const bool isRemoveFace = first.getAction() == RibUpdate::REMOVE_FACE;
+
+  RibUpdateBatch batch(faceId);
+  std::set<Name> names;
+  while (!m_updateQueue.empty() && batch.size() < MAX_BATCH_SIZE) {
+    const RibUpdate& update = m_updateQueue.front().update;
+    if (update.getRoute().faceId != faceId ||
+        (update.getAction() == RibUpdate::REMOVE_FACE) != isRemoveFace ||
+        isPrefixRelated(names, update.getName())) {
+      break;
+    }
+
+    const Route& route = update.getRoute();
+    auto queuedIt = m_queuedRoutes.find({update.getName(), route.faceId, route.origin});
+    if (queuedIt != m_queuedRoutes.end() && queuedIt->second == m_updateQueue.begin()) {
+      m_queuedRoutes.erase(queuedIt);
+    }
+
+    names.insert(update.getName());
+    batch.add(update);
+    m_inProgressUpdates.push_back(std::move(m_updateQueue.front()));
+    m_updateQueue.pop_front();
+  }
 
-  // Until task #1698, each RibUpdateBatch contains exactly one RIB update
-  BOOST_ASSERT(item.batch.size() == 1);
+  NFD_LOG_DEBUG("Sending batch of " << batch.size() << " update(s) for face " << faceId);
 
-  m_fibUpdater->computeAndSendFibUpdates(item.batch,
-    [this, batch = item.batch, successCb = item.managerSuccessCallback] (const auto& routes) {
-      onFibUpdateSuccess(batch, routes, successCb);
-    },
-    [this, failureCb = item.managerFailureCallback] (const auto& code, const auto& error) {
-      onFibUpdateFailure(failureCb, code, error);
-    });
+  m_fibUpdater->computeAndSendFibUpdates(batch,
+    [this] (const auto& routes) { onFibUpdateSuccess(routes); },
+    [this] (const auto& code, const auto& error) { onFibUpdateFailure(code, error); });
 }
 
 void
-Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
-                        const RibUpdateList& inheritedRoutes,
-                        const Rib::UpdateSuccessCallback& onSuccess)
+Rib::onFibUpdateSuccess(const RibUpdateList& inheritedRoutes)
 {
-  for (const RibUpdate& update : batch) {
+  auto updates = std::move(m_inProgressUpdates);
+  m_inProgressUpdates.clear();
+
+  for (const auto& item : updates) {
+    const RibUpdate& update = item.update;
     switch (update.getAction()) {
     case RibUpdate::REGISTER:
       insert(update.getName(), update.getRoute());
@@ -444,8 +599,10 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
 
   m_isUpdateInProgress = false;
 
-  if (onSuccess != nullptr) {
-    onSuccess();
+  for (const auto& item : updates) {
+    if (item.managerSuccessCallback != nullptr) {
+      item.managerSuccessCallback();
+    }
   }
 
   // Try to advance the batch queue
@@ -453,13 +610,17 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
 }
 
 void
-Rib::onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
-                        uint32_t code, const std::string& error)
+Rib::onFibUpdateFailure(uint32_t code, const std::string& error)
 {
+  auto updates = std::move(m_inProgressUpdates);
+  m_inProgressUpdates.clear();
+
   m_isUpdateInProgress = false;
 
-  if (onFailure != nullptr) {
-    onFailure(code, error);
+  for (const auto& item : updates) {
+    if (item.managerFailureCallback != nullptr) {
+      item.managerFailureCallback(code, error);
+    }
   }
 
   // Try to advance the batch queue
@@ -140,6 +140,10 @@ private:
   enqueueRemoveFace(const RibEntry& entry, uint64_t faceId);
 
   /** \brief Append the RIB update to the update queue.
+   *
+   *  If the last queued update of the same route has the same action and has not been sent yet,
+   *  the two updates are coalesced: a registration replaces the queued route, and the callbacks
+   *  of both updates are invoked when the coalesced update completes.
    *
    *  To start updates, invoke sendBatchFromQueue() .
    */
@@ -148,45 +152,36 @@ private:
                    const Rib::UpdateSuccessCallback& onSuccess,
                    const Rib::UpdateFailureCallback& onFailure);
 
-  /** \brief Send the first update batch in the queue, if no other update is in progress.
+  /** \brief Send a batch of updates from the front of the queue, if no other batch is in progress.
+   *
+   *  Consecutive updates are sent in the same batch as long as they are for the same face,
+   *  and no name in the batch is a prefix of another, so that FibUpdater can compute the FIB
+   *  updates of each of them from the current RIB. Face removals are not batched with other
+   *  actions.
    */
   void
   sendBatchFromQueue();
 
   void
-  onFibUpdateSuccess(const RibUpdateBatch& batch,
-                     const RibUpdateList& inheritedRoutes,
-                     const Rib::UpdateSuccessCallback& onSuccess);
+  onFibUpdateSuccess(const RibUpdateList& inheritedRoutes);
 
   void
-  onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
-                     uint32_t code, const std::string& error);
+  onFibUpdateFailure(uint32_t code, const std::string& error);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   erase(const Name& prefix, const Route& route);
 
-private:
-  using RouteComparePredicate = bool (*)(const Route&, const Route&);
-  using RouteSet = std::set<Route, RouteComparePredicate>;
-
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry exists at \p prefix
-   */
-  std::list<shared_ptr<RibEntry>>
-  findDescendants(const Name& prefix) const;
+  using RouteComparePredicate = RibEntry::RouteComparePredicate;
+  using RouteSet = RibEntry::RouteSet;
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry does not exist at \p prefix
+  /** \brief Find the entries that are, or would be, the children of an entry at \p prefix.
+   *
+   *  These are the entries under \p prefix without another entry in between. The cost is
+   *  proportional to the size of the part of the name trie above them.
    */
-  std::list<shared_ptr<RibEntry>>
-  findDescendantsForNonInsertedName(const Name& prefix) const;
-
-  RibTable::iterator
-  eraseEntry(RibTable::iterator it);
-
-  void
-  updateRib(const RibUpdateBatch& batch);
+  RibEntryList
+  findChildren(const Name& prefix) const;
 
   /** \brief Returns routes inherited from the entry's ancestors.
    *  \return a list of inherited routes
@@ -201,6 +196,41 @@ private:
   RouteSet
   getAncestorRoutes(const Name& name) const;
 
+private:
+  /** \brief A node of the name trie that indexes RIB entries by name component.
+   *
+   *  The trie has a node for every prefix of the names of the RIB entries, so that the
+   *  structural queries walk name components instead of searching the table for each prefix.
+   */
+  struct TrieNode
+  {
+    std::map<name::Component, unique_ptr<TrieNode>> children;
+    shared_ptr<RibEntry> entry;
+  };
+
+  const TrieNode*
+  findNode(const Name& prefix) const;
+
+  /** \brief Detach the entry from the node at \p prefix, and erase the nodes that
+   *         no longer lead to an entry.
+   */
+  void
+  eraseNode(const Name& prefix);
+
+  RibTable::iterator
+  eraseEntry(RibTable::iterator it);
+
+  void
+  updateRib(const RibUpdateBatch& batch);
+
+  /** \brief Recomputes the inheritable routes of \p entry and, if they changed, those of
+   *         its descendants.
+   *
+   *  Subtrees whose inheritable routes do not change are not visited.
+   */
+  void
+  refreshInheritableRoutes(RibEntry& entry);
+
   /** \brief Applies the passed \p inheritedRoutes and their actions to the corresponding
    *  RibEntries' inheritedRoutes lists.
    */
@@ -226,12 +256,17 @@ public:
    */
   signal::Signal<Rib, RibRouteRef> afterAddRoute;
 
+  /** \brief Signals after the cost or flags of an existing Route are changed.
+   */
+  signal::Signal<Rib, RibRouteRef> afterUpdateRoute;
+
   /** \brief Signals before a route is removed.
    */
   signal::Signal<Rib, RibRouteRef> beforeRemoveRoute;
 
 private:
   RibTable m_rib;
+  TrieNode m_trieRoot;
   // FaceId => Entry with Route on this face
   std::multimap<uint64_t, shared_ptr<RibEntry>> m_faceEntries;
   size_t m_nItems = 0;
@@ -239,13 +274,17 @@ private:
 
   struct UpdateQueueItem
   {
-    RibUpdateBatch batch;
-    const Rib::UpdateSuccessCallback managerSuccessCallback;
-    const Rib::UpdateFailureCallback managerFailureCallback;
+    RibUpdate update;
+    Rib::UpdateSuccessCallback managerSuccessCallback;
+    Rib::UpdateFailureCallback managerFailureCallback;
   };
 
   using UpdateQueue = std::list<UpdateQueueItem>;
-  UpdateQueue m_updateBatches;
+  UpdateQueue m_updateQueue;
+  // (name, FaceId, origin) => last queued update of this route
+  std::map<std::tuple<Name, uint64_t, ndn::nfd::RouteOrigin>, UpdateQueue::iterator> m_queuedRoutes;
+  // updates of the batch being applied
+  std::vector<UpdateQueueItem> m_inProgressUpdates;
   bool m_isUpdateInProgress = false;
 
   friend FibUpdater;
@@ -88,6 +88,12 @@ public:
     return m_ribManager;
   }
 
+  FibUpdater&
+  getFibUpdater() noexcept
+  {
+    return m_fibUpdater;
+  }
+
 private:
   template<typename ConfigParseFunc>
   Service(ndn::KeyChain& keyChain, shared_ptr<ndn::Transport> localNfdTransport,
@@ -104,6 +104,11 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  const Entry& entry = *nte->getFibEntry();
+  for (const auto& nexthop : entry.getNextHops()) {
+    this->beforeRemoveNextHop(entry.getPrefix(), nexthop);
+  }
+
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -115,7 +120,8 @@ void
 Fib::erase(const Name& prefix)
 {
   name_tree::Entry* nte = m_nameTree.findExactMatch(prefix);
-  if (nte != nullptr) {
+  // a name tree entry may exist without a FIB entry, e.g., between two FIB entries
+  if (nte != nullptr && nte->getFibEntry() != nullptr) {
     this->erase(nte);
   }
 }
@@ -134,20 +140,30 @@ Fib::erase(const Entry& entry)
 void
 Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
 {
-  auto [it, isNew] = entry.addOrUpdateNextHop(face, cost);
-  if (isNew)
-    this->afterNewNextHop(entry.getPrefix(), *it);
+  auto it = entry.findNextHop(face);
+  if (it == entry.m_nextHops.end()) {
+    entry.addOrUpdateNextHop(face, cost);
+    // the list has been sorted, so the new nexthop must be looked up again
+    this->afterNewNextHop(entry.getPrefix(), *entry.findNextHop(face));
+  }
+  else if (it->getCost() != cost) {
+    entry.addOrUpdateNextHop(face, cost);
+    this->afterUpdateNextHop(entry.getPrefix(), *entry.findNextHop(face));
+  }
 }
 
 Fib::RemoveNextHopResult
 Fib::removeNextHop(Entry& entry, const Face& face)
 {
-  bool isRemoved = entry.removeNextHop(face);
-
-  if (!isRemoved) {
+  auto it = entry.findNextHop(face);
+  if (it == entry.m_nextHops.end()) {
     return RemoveNextHopResult::NO_SUCH_NEXTHOP;
   }
-  else if (!entry.hasNextHops()) {
+
+  this->beforeRemoveNextHop(entry.getPrefix(), *it);
+  entry.removeNextHop(face);
+
+  if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
     this->erase(nte, false);
     return RemoveNextHopResult::FIB_ENTRY_REMOVED;
@@ -164,4 +180,13 @@ Fib::getRange() const
          boost::adaptors::transformed(name_tree::GetTableEntry<Entry>(&name_tree::Entry::getFibEntry));
 }
 
+Fib::Range
+Fib::partialEnumerate(const Name& prefix) const
+{
+  return m_nameTree.partialEnumerate(prefix, [] (const name_tree::Entry& nte) {
+           return std::pair(nteHasFibEntry(nte), true);
+         }) |
+         boost::adaptors::transformed(name_tree::GetTableEntry<Entry>(&name_tree::Entry::getFibEntry));
+}
+
 } // namespace nfd::fib
@@ -148,11 +148,27 @@ public: // enumeration
     return this->getRange().end();
   }
 
+  /** \brief Enumerate the entries whose prefix starts with \p prefix.
+   *  \note The iteration order is implementation-defined.
+   *  \warning Undefined behavior may occur if a FIB/PIT/Measurements/StrategyChoice entry
+   *           is inserted or erased during iteration.
+   */
+  Range
+  partialEnumerate(const Name& prefix) const;
+
 public: // signal
   /** \brief Signals on Fib entry nexthop creation.
    */
   signal::Signal<Fib, Name, NextHop> afterNewNextHop;
 
+  /** \brief Signals on Fib entry nexthop cost change.
+   */
+  signal::Signal<Fib, Name, NextHop> afterUpdateNextHop;
+
+  /** \brief Signals before a Fib entry nexthop is removed, including when the entry is erased.
+   */
+  signal::Signal<Fib, Name, NextHop> beforeRemoveNextHop;
+
 private:
   /** \tparam K a parameter acceptable to NameTree::findLongestPrefixMatch
    */
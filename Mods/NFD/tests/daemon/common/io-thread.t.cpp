@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/io-thread.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+#include <atomic>
+
+namespace nfd::tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestIoThread, GlobalIoFixture)
+
+BOOST_AUTO_TEST_CASE(ThreadLocalIoService)
+{
+  IoThread ioThread;
+  BOOST_CHECK(&ioThread.getParentIoService() == &g_io);
+  BOOST_CHECK(&ioThread.getIoService() != &g_io);
+  BOOST_CHECK(!ioThread.isCurrentThread());
+
+  boost::asio::io_service* io = nullptr;
+  Scheduler* scheduler = nullptr;
+  bool isCurrent = false;
+  ioThread.runAndWait([&] {
+    io = &getGlobalIoService();
+    scheduler = &getScheduler();
+    isCurrent = ioThread.isCurrentThread();
+  });
+  BOOST_CHECK(io == &ioThread.getIoService());
+  BOOST_CHECK(scheduler != &getScheduler());
+  BOOST_CHECK(isCurrent);
+}
+
+BOOST_AUTO_TEST_CASE(PostToParent)
+{
+  IoThread ioThread;
+  auto mainThreadId = std::this_thread::get_id();
+
+  bool hasRun = false;
+  ioThread.runAndWait([&] {
+    BOOST_CHECK(mainThreadId != std::this_thread::get_id());
+    ioThread.postToParent([&] {
+      BOOST_CHECK(mainThreadId == std::this_thread::get_id());
+      hasRun = true;
+    });
+  });
+  BOOST_CHECK_EQUAL(hasRun, false);
+
+  pollIo();
+  BOOST_CHECK_EQUAL(hasRun, true);
+}
+
+BOOST_AUTO_TEST_CASE(RunAndWait)
+{
+  IoThread ioThread;
+
+  // runAndWait is ordered after previously posted handlers
+  std::vector<int> order;
+  ioThread.post([&] { order.push_back(1); });
+  ioThread.post([&] { order.push_back(2); });
+  ioThread.runAndWait([&] { order.push_back(3); });
+  BOOST_CHECK_EQUAL(order.size(), 3);
+  BOOST_CHECK(std::is_sorted(order.begin(), order.end()));
+
+  // nested invocation runs immediately
+  bool hasNestedRun = false;
+  ioThread.runAndWait([&] {
+    ioThread.runAndWait([&] { hasNestedRun = true; });
+    BOOST_CHECK_EQUAL(hasNestedRun, true);
+  });
+
+  // exceptions are propagated to the caller
+  BOOST_CHECK_THROW(ioThread.runAndWait([] { NDN_THROW(std::runtime_error("error")); }),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(DrainOnDestruction)
+{
+  std::atomic<int> nRun{0};
+  {
+    IoThread ioThread;
+    for (int i = 0; i < 100; ++i) {
+      ioThread.post([&] { ++nRun; });
+    }
+  }
+  BOOST_CHECK_EQUAL(nRun, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestIoThread
+
+} // namespace nfd::tests
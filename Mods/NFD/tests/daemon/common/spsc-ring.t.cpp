@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/spsc-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestSpscRing)
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  SpscRing<int> ring(5);
+  BOOST_CHECK_EQUAL(ring.capacity(), 8);
+  BOOST_CHECK(ring.empty());
+
+  for (int i = 0; i < 8; ++i) {
+    BOOST_CHECK(ring.tryPush(int(i)));
+  }
+  BOOST_CHECK(!ring.tryPush(8));
+  BOOST_CHECK(!ring.empty());
+
+  std::vector<int> items;
+  BOOST_CHECK_EQUAL(ring.consume([&] (int&& i) { items.push_back(i); }, 3), 3);
+  BOOST_CHECK(ring.tryPush(8));
+  BOOST_CHECK_EQUAL(ring.consume([&] (int&& i) { items.push_back(i); }), 6);
+  BOOST_CHECK(ring.empty());
+
+  std::vector<int> expected{0, 1, 2, 3, 4, 5, 6, 7, 8};
+  BOOST_CHECK_EQUAL_COLLECTIONS(items.begin(), items.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Ownership)
+{
+  auto p = make_shared<int>(1);
+  {
+    SpscRing<shared_ptr<int>> ring(4);
+    auto copy = p;
+    BOOST_CHECK(ring.tryPush(std::move(copy)));
+    BOOST_CHECK(copy == nullptr);
+    BOOST_CHECK_EQUAL(p.use_count(), 2);
+
+    // a rejected item is not moved from
+    copy = p;
+    for (int i = 0; i < 3; ++i) {
+      auto another = p;
+      BOOST_CHECK(ring.tryPush(std::move(another)));
+    }
+    BOOST_CHECK(!ring.tryPush(std::move(copy)));
+    BOOST_CHECK(copy != nullptr);
+    copy.reset();
+
+    // items are destroyed once consumed
+    ring.consume([] (shared_ptr<int>&&) {}, 1);
+    BOOST_CHECK_EQUAL(p.use_count(), 4);
+
+    // an exception thrown by the consumer does not leak the item
+    BOOST_CHECK_THROW(ring.consume([] (shared_ptr<int>&&) { NDN_THROW(std::runtime_error("")); }),
+                      std::runtime_error);
+    BOOST_CHECK_EQUAL(p.use_count(), 3);
+  }
+  // remaining items are destroyed with the ring
+  BOOST_CHECK_EQUAL(p.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent)
+{
+  const uint64_t N_ITEMS = 200000;
+  SpscRing<uint64_t> ring(64);
+
+  std::thread producer([&] {
+    for (uint64_t i = 0; i < N_ITEMS; ++i) {
+      while (!ring.tryPush(uint64_t(i))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint64_t next = 0;
+  bool isOrdered = true;
+  while (next < N_ITEMS) {
+    size_t n = ring.consume([&] (uint64_t&& i) {
+      isOrdered = isOrdered && i == next;
+      ++next;
+    }, 16);
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  BOOST_CHECK(isOrdered);
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscRing
+
+} // namespace nfd::tests
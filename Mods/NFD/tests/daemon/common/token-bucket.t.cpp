@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/token-bucket.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestTokenBucket)
+
+BOOST_AUTO_TEST_CASE(ConsumeAndRefill)
+{
+  auto t0 = time::steady_clock::time_point{} + 1_h;
+  TokenBucket bucket(10, 3, t0);
+  BOOST_CHECK_EQUAL(bucket.getRate(), 10);
+  BOOST_CHECK_EQUAL(bucket.getBurst(), 3);
+
+  // a new bucket is full
+  BOOST_CHECK(bucket.tryConsume(t0));
+  BOOST_CHECK(bucket.tryConsume(t0));
+  BOOST_CHECK(bucket.tryConsume(t0));
+  BOOST_CHECK(!bucket.tryConsume(t0));
+  BOOST_CHECK(!bucket.hasToken(t0 + 50_ms));
+  BOOST_CHECK_EQUAL(bucket.getTimeUntilToken(t0 + 50_ms), 50_ms + 1_ns);
+
+  // one token every 100ms
+  BOOST_CHECK(bucket.hasToken(t0 + 100_ms));
+  BOOST_CHECK(bucket.tryConsume(t0 + 100_ms));
+  BOOST_CHECK(!bucket.tryConsume(t0 + 100_ms));
+  BOOST_CHECK_EQUAL(bucket.getTimeUntilToken(t0 + 200_ms), 0_ns);
+
+  // never more than the burst
+  BOOST_CHECK_CLOSE(bucket.getTokens(t0 + 10_s), 3.0, 0.001);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTokenBucket
+
+} // namespace nfd::tests
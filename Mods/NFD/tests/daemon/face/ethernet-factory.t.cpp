@@ -216,6 +216,31 @@ BOOST_AUTO_TEST_CASE(McastAdHoc)
   BOOST_CHECK_EQUAL(this->countEtherMcastFaces(ndn::nfd::LINK_TYPE_AD_HOC), netifs.size());
 }
 
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+BOOST_AUTO_TEST_CASE(PacketRing)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        listen no
+        mcast yes
+        packet_ring yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  checkChannelListEqual(factory, this->listUrisOfAvailableNetifs());
+  BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), netifs.size());
+}
+#endif // NFD_HAVE_ETHERNET_PACKET_RING
+
 BOOST_AUTO_TEST_CASE(ChangeMcastGroup)
 {
   SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
@@ -417,6 +442,22 @@ BOOST_AUTO_TEST_CASE(BadMcastGroup)
   BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadPacketRing)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(UnknownOption)
 {
   const std::string CONFIG = R"CONFIG(
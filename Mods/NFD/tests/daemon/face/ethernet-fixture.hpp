@@ -34,6 +34,7 @@
 
 namespace nfd::tests {
 
+using face::EthernetIoMode;
 using face::EthernetTransport;
 using face::MulticastEthernetTransport;
 using face::UnicastEthernetTransport;
@@ -82,7 +83,8 @@ protected:
   void
   initializeUnicast(shared_ptr<ndn::net::NetworkInterface> netif = nullptr,
                     ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
-                    ethernet::Address remoteAddr = {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e})
+                    ethernet::Address remoteAddr = {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e},
+                    EthernetIoMode ioMode = EthernetIoMode::PCAP)
   {
     if (!netif) {
       netif = defaultNetif;
@@ -90,7 +92,7 @@ protected:
 
     localEp = netif->getName();
     remoteEp = remoteAddr;
-    transport = make_unique<UnicastEthernetTransport>(*netif, remoteEp, persistency, 2_s);
+    transport = make_unique<UnicastEthernetTransport>(*netif, remoteEp, persistency, 2_s, ioMode);
   }
 
   /** \brief Create a MulticastEthernetTransport.
@@ -98,7 +100,8 @@ protected:
   void
   initializeMulticast(shared_ptr<ndn::net::NetworkInterface> netif = nullptr,
                       ndn::nfd::LinkType linkType = ndn::nfd::LINK_TYPE_MULTI_ACCESS,
-                      ethernet::Address mcastGroup = {0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e})
+                      ethernet::Address mcastGroup = {0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e},
+                      EthernetIoMode ioMode = EthernetIoMode::PCAP)
   {
     if (!netif) {
       netif = defaultNetif;
@@ -106,7 +109,7 @@ protected:
 
     localEp = netif->getName();
     remoteEp = mcastGroup;
-    transport = make_unique<MulticastEthernetTransport>(*netif, remoteEp, linkType);
+    transport = make_unique<MulticastEthernetTransport>(*netif, remoteEp, linkType, ioMode);
   }
 
 protected:
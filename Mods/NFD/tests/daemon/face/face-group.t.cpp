@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/face-group.hpp"
+#include "face/face.hpp"
+#include "face/generic-link-service.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "dummy-transport.hpp"
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+class FaceGroupFixture : public GlobalIoFixture
+{
+protected:
+  shared_ptr<Face>
+  makeFace(const shared_ptr<FaceGroup>& group)
+  {
+    shared_ptr<Face> face;
+    group->getIoThread().runAndWait([&] {
+      face = make_shared<Face>(make_unique<GenericLinkService>(), make_unique<DummyTransport>(),
+                               group);
+    });
+    return face;
+  }
+
+  /** \brief Simulate the reception of \p n Interests, in the IoThread of \p face
+   */
+  static void
+  receiveInterests(Face& face, int n)
+  {
+    face.runInFaceThread([&] {
+      auto transport = static_cast<DummyTransport*>(face.getTransport());
+      for (int i = 0; i < n; ++i) {
+        transport->receivePacket(makeInterest(Name("/group").appendNumber(i))->wireEncode());
+      }
+    });
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestFaceGroup, FaceGroupFixture)
+
+BOOST_AUTO_TEST_CASE(Deliver)
+{
+  auto group = make_shared<FaceGroup>();
+  auto face1 = makeFace(group);
+  auto face2 = makeFace(group);
+  BOOST_CHECK_EQUAL(face1->getFaceGroup(), group.get());
+  BOOST_CHECK_EQUAL(face1->getIoThread(), &group->getIoThread());
+
+  const auto mainThreadId = std::this_thread::get_id();
+  std::vector<std::pair<FaceId, Name>> received;
+  face1->setId(1);
+  face2->setId(2);
+  for (const auto& face : {face1, face2}) {
+    face->afterReceiveInterest.connect([&, id = face->getId()] (const Interest& interest, auto&&) {
+      BOOST_CHECK(std::this_thread::get_id() == mainThreadId);
+      // the forwarder retains received Interests
+      BOOST_CHECK_NO_THROW(interest.shared_from_this());
+      received.emplace_back(id, interest.getName());
+    });
+  }
+
+  // more than one batch
+  receiveInterests(*face1, FaceGroup::MAX_BATCH_SIZE + 10);
+  receiveInterests(*face2, 10);
+  BOOST_CHECK_EQUAL(received.size(), 0);
+
+  this->pollIo();
+  BOOST_REQUIRE_EQUAL(received.size(), FaceGroup::MAX_BATCH_SIZE + 20);
+  // packets are delivered in the order they were received
+  for (size_t i = 0; i < FaceGroup::MAX_BATCH_SIZE + 10; ++i) {
+    BOOST_CHECK_EQUAL(received[i].first, 1);
+    BOOST_CHECK_EQUAL(received[i].second.at(-1).toNumber(), i);
+  }
+  for (size_t i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(received[FaceGroup::MAX_BATCH_SIZE + 10 + i].first, 2);
+  }
+  BOOST_CHECK_EQUAL(face1->getCounters().nInInterests, FaceGroup::MAX_BATCH_SIZE + 10);
+  BOOST_CHECK_EQUAL(group->getNDropped(), 0);
+
+  // the ring is drained again after it became empty
+  receiveInterests(*face2, 1);
+  this->pollIo();
+  BOOST_CHECK_EQUAL(received.size(), FaceGroup::MAX_BATCH_SIZE + 21);
+}
+
+BOOST_AUTO_TEST_CASE(RingFull)
+{
+  auto group = make_shared<FaceGroup>(16);
+  auto face = makeFace(group);
+  size_t nReceived = 0;
+  face->afterReceiveInterest.connect([&] (auto&&...) { ++nReceived; });
+
+  receiveInterests(*face, 20);
+  BOOST_CHECK_EQUAL(group->getNDropped(), 4);
+  BOOST_CHECK_EQUAL(face->getCounters().nInInterests, 20);
+
+  this->pollIo();
+  BOOST_CHECK_EQUAL(nReceived, 16);
+}
+
+BOOST_AUTO_TEST_CASE(ClosedFace)
+{
+  auto group = make_shared<FaceGroup>();
+  auto face = makeFace(group);
+  size_t nReceived = 0;
+  face->afterReceiveInterest.connect([&] (auto&&...) { ++nReceived; });
+
+  // packets pending when the face is closed are not delivered
+  face->runInFaceThread([&] {
+    auto transport = static_cast<DummyTransport*>(face->getTransport());
+    transport->receivePacket(makeInterest("/closed")->wireEncode());
+    transport->setState(FaceState::CLOSING);
+    transport->setState(FaceState::CLOSED);
+  });
+  this->pollIo();
+  BOOST_CHECK_EQUAL(face->getState(), FaceState::CLOSED);
+  BOOST_CHECK_EQUAL(nReceived, 0);
+
+  // packets pending when the face is destroyed are discarded
+  auto face2 = makeFace(group);
+  receiveInterests(*face2, 5);
+  face2.reset();
+  BOOST_CHECK_NO_THROW(this->pollIo());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFaceGroup
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
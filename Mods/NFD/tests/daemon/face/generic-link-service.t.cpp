@@ -237,6 +237,27 @@ BOOST_AUTO_TEST_CASE(ReceiveInterest)
   BOOST_CHECK_EQUAL(receivedInterests.back().wireEncode(), interest1->wireEncode());
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveInterestHopLimitZero)
+{
+  auto interest1 = makeInterest("/hGDmNf5Y");
+  interest1->setHopLimit(0);
+  transport->receivePacket(interest1->wireEncode());
+
+  // dropped without being handed to forwarding
+  BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 1);
+  BOOST_CHECK_EQUAL(face->getCounters().nInHopLimitZero, 1);
+  BOOST_CHECK(receivedInterests.empty());
+
+  auto interest2 = makeInterest("/hGDmNf5Y");
+  interest2->setHopLimit(1);
+  transport->receivePacket(interest2->wireEncode());
+
+  BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 2);
+  BOOST_CHECK_EQUAL(face->getCounters().nInHopLimitZero, 1);
+  BOOST_REQUIRE_EQUAL(receivedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(receivedInterests.back().wireEncode(), interest2->wireEncode());
+}
+
 BOOST_AUTO_TEST_CASE(ReceiveBareData)
 {
   // Initialize with Options that disables all services
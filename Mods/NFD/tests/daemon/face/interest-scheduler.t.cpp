@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/interest-scheduler.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd::tests {
+
+using face::InterestScheduler;
+
+class InterestSchedulerFixture : public GlobalIoTimeFixture
+{
+protected:
+  void
+  makeScheduler(InterestScheduler::Options options)
+  {
+    scheduler = make_unique<InterestScheduler>(options, [this] (const Interest& interest) {
+      transmitted.push_back(interest.getName());
+    });
+  }
+
+  static shared_ptr<Interest>
+  makeFlowInterest(const Name& name, FaceId downstream)
+  {
+    auto interest = makeInterest(name);
+    interest->setTag(make_shared<lp::IncomingFaceIdTag>(downstream));
+    return interest;
+  }
+
+protected:
+  unique_ptr<InterestScheduler> scheduler;
+  std::vector<Name> transmitted;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestInterestScheduler, InterestSchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(FairShare)
+{
+  InterestScheduler::Options options;
+  options.rate = 10;
+  options.burst = 1;
+  // one Interest per round
+  options.quantum = makeFlowInterest("/A/1", 1)->wireEncode().size();
+  makeScheduler(options);
+
+  // the first Interest uses the initial token
+  scheduler->enqueue(*makeFlowInterest("/A/1", 1));
+  BOOST_CHECK_EQUAL(transmitted.size(), 1);
+
+  for (int i = 2; i <= 5; ++i) {
+    scheduler->enqueue(*makeFlowInterest(Name("/A").append(to_string(i)), 1));
+  }
+  scheduler->enqueue(*makeFlowInterest("/B/1", 2));
+  scheduler->enqueue(*makeFlowInterest("/B/2", 2));
+  BOOST_CHECK_EQUAL(transmitted.size(), 1);
+  BOOST_CHECK_EQUAL(scheduler->getQueueLength(), 6);
+
+  // 10 Interests per second
+  this->advanceClocks(10_ms, 250_ms);
+  BOOST_CHECK_EQUAL(transmitted.size(), 3);
+
+  this->advanceClocks(10_ms, 1_s);
+  std::vector<Name> expected{"/A/1", "/A/2", "/B/1", "/A/3", "/B/2", "/A/4", "/A/5"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(transmitted.begin(), transmitted.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(scheduler->getQueueLength(), 0);
+  BOOST_CHECK_EQUAL(scheduler->getNDropped(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(QueueLimit)
+{
+  InterestScheduler::Options options;
+  options.rate = 1;
+  options.maxQueueLength = 2;
+  makeScheduler(options);
+
+  for (int i = 1; i <= 5; ++i) {
+    scheduler->enqueue(*makeFlowInterest(Name("/A").append(to_string(i)), 1));
+  }
+  scheduler->enqueue(*makeFlowInterest("/B/1", 2));
+  // one sent, two queued and two dropped in flow 1, one queued in flow 2
+  BOOST_CHECK_EQUAL(transmitted.size(), 1);
+  BOOST_CHECK_EQUAL(scheduler->getQueueLength(), 3);
+  BOOST_CHECK_EQUAL(scheduler->getNDropped(), 2);
+
+  this->advanceClocks(100_ms, 4_s);
+  BOOST_CHECK_EQUAL(transmitted.size(), 4);
+  BOOST_CHECK_EQUAL(scheduler->getQueueLength(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestScheduler
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
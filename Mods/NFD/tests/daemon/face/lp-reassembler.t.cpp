@@ -264,6 +264,66 @@ BOOST_AUTO_TEST_CASE(OutOfOrder)
   BOOST_TEST(isComplete);
 }
 
+BOOST_AUTO_TEST_CASE(ShortFirstFragment)
+{
+  // the first fragment is shorter than the others, as it carries other NDNLPv2 headers
+  const std::vector<std::pair<size_t, size_t>> layout{{0, 2}, {2, 3}, {5, 3}, {8, 2}};
+  ndn::Buffer dataBuffer(data, sizeof(data));
+  std::vector<lp::Packet> frags;
+  for (size_t i = 0; i < layout.size(); ++i) {
+    auto [offset, size] = layout[i];
+    lp::Packet& frag = frags.emplace_back();
+    frag.add<lp::FragmentField>(std::make_pair(dataBuffer.begin() + offset,
+                                               dataBuffer.begin() + offset + size));
+    frag.add<lp::FragIndexField>(i);
+    frag.add<lp::FragCountField>(layout.size());
+    frag.add<lp::SequenceField>(1000 + i);
+  }
+  frags[0].add<lp::NextHopFaceIdField>(200);
+
+  bool isComplete = false;
+  Block netPacket;
+  lp::Packet packet;
+
+  for (size_t i : {3, 0, 2}) {
+    std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment({}, frags[i]);
+    BOOST_TEST(!isComplete);
+  }
+  std::tie(isComplete, netPacket, packet) = reassembler.receiveFragment({}, frags[1]);
+  BOOST_REQUIRE(isComplete);
+  BOOST_CHECK(packet.has<lp::NextHopFaceIdField>());
+  BOOST_CHECK_EQUAL_COLLECTIONS(data, data + sizeof(data), netPacket.begin(), netPacket.end());
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IrregularFragments)
+{
+  // fragments that do not fit the stride of the middle fragments are retained as is
+  const std::vector<std::pair<size_t, size_t>> layout{{0, 4}, {4, 1}, {5, 3}, {8, 2}};
+  ndn::Buffer dataBuffer(data, sizeof(data));
+  std::vector<lp::Packet> frags;
+  for (size_t i = 0; i < layout.size(); ++i) {
+    auto [offset, size] = layout[i];
+    lp::Packet& frag = frags.emplace_back();
+    frag.add<lp::FragmentField>(std::make_pair(dataBuffer.begin() + offset,
+                                               dataBuffer.begin() + offset + size));
+    frag.add<lp::FragIndexField>(i);
+    frag.add<lp::FragCountField>(layout.size());
+    frag.add<lp::SequenceField>(1000 + i);
+  }
+
+  bool isComplete = false;
+  Block netPacket;
+
+  for (size_t i : {0, 1, 3}) {
+    std::tie(isComplete, std::ignore, std::ignore) = reassembler.receiveFragment({}, frags[i]);
+    BOOST_TEST(!isComplete);
+  }
+  std::tie(isComplete, netPacket, std::ignore) = reassembler.receiveFragment({}, frags[2]);
+  BOOST_REQUIRE(isComplete);
+  BOOST_CHECK_EQUAL_COLLECTIONS(data, data + sizeof(data), netPacket.begin(), netPacket.end());
+}
+
 BOOST_AUTO_TEST_CASE(Duplicate)
 {
   ndn::Buffer data0Buffer(data, 5);
@@ -318,6 +378,38 @@ BOOST_AUTO_TEST_CASE(Timeout)
   BOOST_TEST(!isComplete);
 }
 
+BOOST_AUTO_TEST_CASE(TimeoutRefreshed)
+{
+  ndn::Buffer data1Buffer(data, 4);
+  ndn::Buffer data2Buffer(data + 4, 4);
+
+  lp::Packet received1;
+  received1.add<lp::FragmentField>(std::make_pair(data1Buffer.begin(), data1Buffer.end()));
+  received1.add<lp::FragIndexField>(0);
+  received1.add<lp::FragCountField>(3);
+  received1.add<lp::SequenceField>(1000);
+
+  lp::Packet received2;
+  received2.add<lp::FragmentField>(std::make_pair(data2Buffer.begin(), data2Buffer.end()));
+  received2.add<lp::FragIndexField>(1);
+  received2.add<lp::FragCountField>(3);
+  received2.add<lp::SequenceField>(1001);
+
+  reassembler.receiveFragment({}, received1);
+  advanceClocks(1_ms, 300);
+  reassembler.receiveFragment({}, received2);
+
+  // the timeout is counted from the last received fragment
+  advanceClocks(1_ms, 400);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_CHECK(timeoutHistory.empty());
+
+  advanceClocks(1_ms, 200);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+  BOOST_REQUIRE_EQUAL(timeoutHistory.size(), 1);
+  BOOST_CHECK_EQUAL(std::get<1>(timeoutHistory.back()), 2);
+}
+
 BOOST_AUTO_TEST_CASE(MissingSequence)
 {
   ndn::Buffer data1Buffer(data, 4);
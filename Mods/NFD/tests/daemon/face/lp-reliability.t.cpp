@@ -204,7 +204,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
                  reliability->m_unackedFrags.at(firstTxSeq + 1).netPkt);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq).retxCount, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, firstTxSeq);
   BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -222,7 +222,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 2).retxCount, 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 1), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, firstTxSeq + 1);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -241,7 +241,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 4).retxCount, 2);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 3), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 3).retxCount, 1);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, firstTxSeq + 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -260,7 +260,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 6).retxCount, 3);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 5), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 5).retxCount, 2);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 5);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, firstTxSeq + 5);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 7);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -277,7 +277,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 6), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 7), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 7).retxCount, 3);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 7);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, firstTxSeq + 7);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 8);
 
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
@@ -351,7 +351,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 2));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 3));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 0);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
@@ -386,7 +386,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 3));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 5));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 4);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -420,7 +420,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 5));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 6));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -454,7 +454,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 6));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 7));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -483,7 +483,7 @@ BOOST_AUTO_TEST_CASE(AckUnknownTxSeq)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 1);
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -497,7 +497,7 @@ BOOST_AUTO_TEST_CASE(AckUnknownTxSeq)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 1);
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -530,7 +530,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK(reliability->m_unackedFrags.at(3).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 0xFFFFFFFFFFFFFFFF);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 0);
@@ -557,7 +557,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 0xFFFFFFFFFFFFFFFF);
   BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -585,7 +585,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(101010), 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 0xFFFFFFFFFFFFFFFF);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 2);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -610,7 +610,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(4), 1); // pkt1 new TxSeq
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(4).retxCount, 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(4).nGreaterSeqAcks, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   lp::Packet sentRetxPkt(transport->sentPackets.back());
   BOOST_REQUIRE(sentRetxPkt.has<lp::TxSequenceField>());
@@ -637,7 +637,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(4), 0); // pkt1 new TxSeq
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.begin()->first, 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 1);
@@ -662,7 +662,7 @@ BOOST_AUTO_TEST_CASE(SkipFragmentsRemovedInRtt)
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 5);
 
-  lp::Sequence firstTxSeq = reliability->m_firstUnackedFrag->first;
+  lp::Sequence firstTxSeq = reliability->m_unackedFrags.begin()->first;
 
   // Ack the last 2 packets
   lp::Packet ackPkt1;
@@ -941,7 +941,7 @@ BOOST_AUTO_TEST_CASE(TrackRecentReceivedLpPackets)
   pkt1.add<lp::TxSequenceField>(12);
   BOOST_CHECK(reliability->processIncomingPacket({pkt1}));
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.size(), 1);
-  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front(), 7);
+  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front().first, 7);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(7), 1);
 
@@ -956,7 +956,7 @@ BOOST_AUTO_TEST_CASE(TrackRecentReceivedLpPackets)
   pkt2.add<lp::TxSequenceField>(13);
   BOOST_CHECK(reliability->processIncomingPacket({pkt2}));
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.size(), 2);
-  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front(), 7);
+  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front().first, 7);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.size(), 2);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(7), 1);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(23), 1);
@@ -969,7 +969,7 @@ BOOST_AUTO_TEST_CASE(TrackRecentReceivedLpPackets)
   pkt3.add<lp::TxSequenceField>(14);
   BOOST_CHECK(reliability->processIncomingPacket({pkt3}));
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.size(), 2);
-  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front(), 23);
+  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front().first, 23);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.size(), 2);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(23), 1);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(24), 1);
@@ -982,7 +982,7 @@ BOOST_AUTO_TEST_CASE(TrackRecentReceivedLpPackets)
   pkt4.add<lp::TxSequenceField>(15);
   BOOST_CHECK(reliability->processIncomingPacket({pkt4}));
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.size(), 2);
-  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front(), 24);
+  BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqsQueue.front().first, 24);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.size(), 2);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(24), 1);
   BOOST_CHECK_EQUAL(reliability->m_recentRecvSeqs.count(25), 1);
@@ -1016,7 +1016,7 @@ BOOST_AUTO_TEST_CASE(DropDuplicateAckForRetx)
   // Will send out a single fragment
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
-  lp::Sequence firstTxSeq = reliability->m_firstUnackedFrag->first;
+  lp::Sequence firstTxSeq = reliability->m_unackedFrags.begin()->first;
 
   // RTO is initially 1 second, so will time out and retx
   advanceClocks(1250_ms, 1);
@@ -1033,7 +1033,7 @@ BOOST_AUTO_TEST_CASE(DropDuplicateAckForRetx)
   // Acknowledge second transmission
   // Ack will acknowledge retx and remove unacked frag
   lp::Packet ackPkt2;
-  ackPkt2.add<lp::AckField>(reliability->m_firstUnackedFrag->first);
+  ackPkt2.add<lp::AckField>(reliability->m_unackedFrags.begin()->first);
   reliability->processIncomingPacket(ackPkt2);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 0);
 }
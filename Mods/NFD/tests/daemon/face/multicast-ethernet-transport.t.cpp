@@ -26,7 +26,9 @@
 #include "ethernet-fixture.hpp"
 
 #include "common/global.hpp"
+#include "face/face.hpp"
 
+#include "tests/daemon/face/dummy-link-service.hpp"
 #include "tests/daemon/face/transport-test-common.hpp"
 
 namespace nfd::tests {
@@ -137,6 +139,61 @@ BOOST_AUTO_TEST_CASE(SendQueueLength)
   BOOST_CHECK_EQUAL(transport->getSendQueueLength(), QUEUE_UNSUPPORTED);
 }
 
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+BOOST_AUTO_TEST_CASE(PacketRingExchange)
+{
+  // Needs at least two running interfaces on the same link, e.g., a veth pair
+  // inside a dedicated network namespace:
+  //   ip netns add nfd-test
+  //   ip -n nfd-test link add veth0 type veth peer name veth1
+  //   ip -n nfd-test link set veth0 up && ip -n nfd-test link set veth1 up
+  //   ip netns exec nfd-test unit-tests-daemon -t Face/TestMulticastEthernetTransport
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(2);
+
+  const ethernet::Address group{0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e};
+  std::vector<unique_ptr<nfd::Face>> faces;
+  for (const auto& netif : netifs) {
+    if (netif->getState() == ndn::net::InterfaceState::RUNNING) {
+      faces.push_back(make_unique<nfd::Face>(make_unique<DummyLinkService>(),
+                                             make_unique<MulticastEthernetTransport>(
+                                               *netif, group, ndn::nfd::LINK_TYPE_MULTI_ACCESS,
+                                               EthernetIoMode::PACKET_RING)));
+    }
+  }
+  if (faces.size() < 2) {
+    BOOST_WARN_MESSAGE(false, "skipping assertions that require two running Ethernet interfaces");
+    return;
+  }
+
+  // queued frames are transmitted together once control returns to the io_service
+  const size_t nFrames = 32;
+  auto* sender = faces.front()->getTransport();
+  auto payload = ndn::encoding::makeStringBlock(300, std::string(500, 'x'));
+  for (size_t i = 0; i < nFrames; ++i) {
+    sender->send(payload);
+  }
+  BOOST_CHECK_EQUAL(sender->getCounters().nOutPackets, nFrames);
+  limitedIo.defer(200_ms);
+
+  const auto& netif = *std::find_if(netifs.begin(), netifs.end(), [sender] (const auto& n) {
+    return FaceUri::fromDev(n->getName()) == sender->getLocalUri();
+  });
+
+  size_t nPeers = 0;
+  for (auto it = std::next(faces.begin()); it != faces.end(); ++it) {
+    const auto& received = static_cast<DummyLinkService*>((*it)->getLinkService())->receivedPackets;
+    if (received.empty()) {
+      continue; // not on the same link as the sender
+    }
+    ++nPeers;
+    BOOST_CHECK_EQUAL(received.size(), nFrames);
+    BOOST_CHECK_EQUAL(received.back().packet, payload);
+    BOOST_CHECK(received.back().endpoint == EndpointId(netif->getEthernetAddress()));
+  }
+  BOOST_WARN_MESSAGE(nPeers > 0, "no interface shares a link with " << sender->getLocalUri());
+}
+#endif // NFD_HAVE_ETHERNET_PACKET_RING
+
 BOOST_AUTO_TEST_SUITE_END() // TestMulticastEthernetTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -46,7 +46,7 @@ protected:
       port = getNextPort();
 
     return std::make_shared<UdpChannel>(udp::Endpoint(addr, port), 2_s, false,
-                                        mtu.value_or(ndn::MAX_NDN_PACKET_SIZE));
+                                        mtu.value_or(ndn::MAX_NDN_PACKET_SIZE), faceGroups);
   }
 
   void
@@ -67,6 +67,8 @@ protected:
 
 protected:
   std::vector<shared_ptr<Face>> clientFaces;
+  /// FaceGroups given to channels created by makeChannel()
+  std::vector<shared_ptr<face::FaceGroup>> faceGroups;
 };
 
 } // namespace nfd::tests
@@ -29,6 +29,8 @@
 
 #include <boost/mpl/vector.hpp>
 
+#include <thread>
+
 namespace nfd::tests {
 
 BOOST_AUTO_TEST_SUITE(Face)
@@ -60,6 +62,67 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(DefaultMtu, F, AddressFamilies)
   }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(IoThreads, F, AddressFamilies)
+{
+  auto address = getTestIp(F::value, AddressScope::Loopback);
+  SKIP_IF_IP_UNAVAILABLE(address);
+  this->faceGroups = {make_shared<face::FaceGroup>(), make_shared<face::FaceGroup>()};
+  this->listen(address);
+  this->faceGroups.clear();
+  BOOST_CHECK_EQUAL(this->listenerChannel->isListening(), true);
+  BOOST_CHECK_EQUAL(this->listenerChannel->getFaceGroups().size(), 2);
+
+  std::vector<shared_ptr<UdpChannel>> clientChannels;
+  for (int i = 0; i < 4; ++i) {
+    clientChannels.push_back(this->makeChannel(IpAddressTypeFromFamily<F::value>()));
+    this->connect(*clientChannels.back());
+  }
+
+  BOOST_CHECK_EQUAL(this->limitedIo.run(8, 2_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(this->listenerChannel->size(), 4);
+  BOOST_REQUIRE_EQUAL(this->listenerFaces.size(), 4);
+
+  // faces accepted by the listener run in the channel's FaceGroups
+  const auto& channelGroups = this->listenerChannel->getFaceGroups();
+  const auto mainThreadId = std::this_thread::get_id();
+  for (const auto& face : this->listenerFaces) {
+    BOOST_CHECK(std::any_of(channelGroups.begin(), channelGroups.end(),
+                            [&] (const auto& g) { return g.get() == face->getFaceGroup(); }));
+    BOOST_CHECK_EQUAL(face->getPersistency(), ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
+    face->afterReceiveInterest.connect([&] (const Interest&, const EndpointId&) {
+      BOOST_CHECK(std::this_thread::get_id() == mainThreadId);
+      this->limitedIo.afterOp();
+    });
+  }
+
+  // packets received in the IoThreads are delivered in the channel's thread
+  for (const auto& face : this->clientFaces) {
+    face->sendInterest(*makeInterest("/io-threads"));
+  }
+  BOOST_CHECK_EQUAL(this->limitedIo.run(4, 2_s), LimitedIo::EXCEED_OPS);
+
+  // packets sent from the channel's thread are transmitted by the IoThreads
+  for (const auto& face : this->clientFaces) {
+    face->afterReceiveData.connect([this] (const Data&, const EndpointId&) {
+      this->limitedIo.afterOp();
+    });
+  }
+  for (const auto& face : this->listenerFaces) {
+    face->sendData(*makeData("/io-threads"));
+  }
+  BOOST_CHECK_EQUAL(this->limitedIo.run(4, 2_s), LimitedIo::EXCEED_OPS);
+  for (const auto& face : this->listenerFaces) {
+    BOOST_CHECK_EQUAL(face->getCounters().nInInterests, 1);
+    BOOST_CHECK_EQUAL(face->getCounters().nOutData, 1);
+  }
+
+  // closing a face removes it from the channel
+  this->listenerFaces.front()->close();
+  BOOST_CHECK_EQUAL(this->limitedIo.run(1, 2_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(this->listenerFaces.front()->getState(), face::FaceState::CLOSED);
+  BOOST_CHECK_EQUAL(this->listenerChannel->size(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUdpChannel
 BOOST_AUTO_TEST_SUITE_END() // Face
 
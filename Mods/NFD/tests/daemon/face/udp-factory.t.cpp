@@ -559,6 +559,57 @@ BOOST_FIXTURE_TEST_CASE(ChangePredicate, UdpFactoryMcastFixture)
                           [this] (const Face* face) { return isFaceOnNetif(*face, *netifs.back()); }));
 }
 
+BOOST_AUTO_TEST_CASE(IoThreads)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        port 7001
+        io_threads 3
+        mcast no
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  checkChannelListEqual(factory, {"udp4://0.0.0.0:7001", "udp6://[::]:7001"});
+  const std::vector<shared_ptr<face::FaceGroup>>* faceGroups = nullptr;
+  for (const auto& ch : factory.getChannels()) {
+    auto udpCh = std::dynamic_pointer_cast<const face::UdpChannel>(ch);
+    BOOST_REQUIRE(udpCh != nullptr);
+    BOOST_CHECK(udpCh->isListening());
+    BOOST_CHECK_EQUAL(udpCh->getFaceGroups().size(), 3);
+    // all channels share the same FaceGroups
+    if (faceGroups != nullptr) {
+      BOOST_CHECK(udpCh->getFaceGroups() == *faceGroups);
+    }
+    faceGroups = &udpCh->getFaceGroups();
+  }
+
+  // the number of I/O threads cannot be changed after the channels are created
+  const std::string CONFIG_RELOAD = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        port 7001
+        io_threads 1
+        mcast no
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG_RELOAD, false);
+  for (const auto& ch : factory.getChannels()) {
+    auto udpCh = std::dynamic_pointer_cast<const face::UdpChannel>(ch);
+    BOOST_CHECK_EQUAL(udpCh->getFaceGroups().size(), 3);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(Omitted)
 {
   const std::string CONFIG = R"CONFIG(
@@ -730,6 +781,37 @@ BOOST_AUTO_TEST_CASE(BadMtu)
   BOOST_CHECK_THROW(parseConfig(CONFIG3, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadIoThreads)
+{
+  // not a number
+  const std::string CONFIG1 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        io_threads hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, false), ConfigFile::Error);
+
+  // overflow
+  const std::string CONFIG2 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        io_threads 65
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(BadMcast)
 {
   const std::string CONFIG = R"CONFIG(
@@ -169,6 +169,31 @@ BOOST_AUTO_TEST_CASE(IdleClose)
   BOOST_CHECK_EQUAL(nStateChanges, 2);
 }
 
+#ifdef NFD_HAVE_ETHERNET_PACKET_RING
+BOOST_AUTO_TEST_CASE(PacketRingSendAndClose)
+{
+  SKIP_IF_NO_RUNNING_ETHERNET_NETIF();
+  initializeUnicast(getRunningNetif(), ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                    {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e}, EthernetIoMode::PACKET_RING);
+  BOOST_REQUIRE_EQUAL(transport->getState(), TransportState::UP);
+
+  // queued frames are transmitted together once control returns to the io_service
+  auto block = ndn::encoding::makeStringBlock(300, "hello");
+  transport->send(block);
+  transport->send(block);
+  g_io.poll();
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 2);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+
+  transport->afterStateChange.connect([this] (auto, auto newState) {
+    if (newState == TransportState::CLOSED)
+      this->limitedIo.afterOp();
+  });
+  transport->close();
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+}
+#endif // NFD_HAVE_ETHERNET_PACKET_RING
+
 BOOST_AUTO_TEST_CASE(SendQueueLength)
 {
   SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
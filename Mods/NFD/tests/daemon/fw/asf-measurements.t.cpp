@@ -41,8 +41,10 @@ BOOST_FIXTURE_TEST_CASE(FaceInfo, GlobalIoTimeFixture)
 
   BOOST_CHECK_EQUAL(info.getLastRtt(), FaceInfo::RTT_NO_MEASUREMENT);
   BOOST_CHECK_EQUAL(info.getSrtt(), FaceInfo::RTT_NO_MEASUREMENT);
+  BOOST_CHECK_EQUAL(info.getRankingValue(), FaceInfo::RANKING_VALUE_NO_MEASUREMENT);
 
   info.recordRtt(100_ms);
+  BOOST_CHECK_EQUAL(info.getRankingValue(), 100_ms);
   Name interestName("/ndn/interest");
 
   // Receive Interest and forward to next hop; should update RTO information
@@ -69,6 +71,7 @@ BOOST_FIXTURE_TEST_CASE(FaceInfo, GlobalIoTimeFixture)
 
   BOOST_CHECK_EQUAL(info.getLastRtt(), FaceInfo::RTT_TIMEOUT);
   BOOST_CHECK_EQUAL(info.getSrtt(), previousSrtt);
+  BOOST_CHECK_EQUAL(info.getRankingValue(), FaceInfo::RANKING_VALUE_TIMEOUT);
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
 }
 
@@ -82,8 +85,22 @@ BOOST_FIXTURE_TEST_CASE(NamespaceInfo, GlobalIoTimeFixture)
   auto& faceInfo = info.getOrCreateFaceInfo(1234);
   BOOST_CHECK(info.getFaceInfo(1234) == &faceInfo);
 
-  this->advanceClocks(fw::asf::AsfMeasurements::MEASUREMENTS_LIFETIME + 1_s);
+  this->advanceClocks(1_min);
+  auto& faceInfo2 = info.getOrCreateFaceInfo(12);
+  auto& faceInfo3 = info.getOrCreateFaceInfo(5678);
+  BOOST_CHECK(info.getFaceInfo(12) == &faceInfo2);
+  BOOST_CHECK(info.getFaceInfo(1234) == &faceInfo); // not moved by insertions
+  BOOST_CHECK(info.getFaceInfo(5678) == &faceInfo3);
+  BOOST_CHECK(&info.getOrCreateFaceInfo(5678) == &faceInfo3);
+
+  this->advanceClocks(fw::asf::AsfMeasurements::MEASUREMENTS_LIFETIME - 1_min + 1_s);
   BOOST_CHECK(info.getFaceInfo(1234) == nullptr); // expired
+  BOOST_CHECK(info.getFaceInfo(12) == &faceInfo2);
+  BOOST_CHECK(info.getFaceInfo(5678) == &faceInfo3);
+
+  this->advanceClocks(1_min);
+  BOOST_CHECK(info.getFaceInfo(12) == nullptr);
+  BOOST_CHECK(info.getFaceInfo(5678) == nullptr);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestAsfStrategy
@@ -25,6 +25,8 @@
 
 #include "fw/asf-strategy.hpp"
 
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
 #include "strategy-tester.hpp"
 #include "topology-tester.hpp"
 
@@ -536,6 +538,44 @@ BOOST_FIXTURE_TEST_CASE(ProbingInterval, AsfStrategyParametersGridFixture)
   BOOST_CHECK_EQUAL(linkAC->getFace(nodeA).getCounters().nOutInterests, 1);
 }
 
+BOOST_AUTO_TEST_CASE(ReflexiveRtt)
+{
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  auto& strategy = choose<AsfStrategyTester>(forwarder);
+  auto consumer = make_shared<DummyFace>();
+  auto producer = make_shared<DummyFace>();
+  faceTable.add(consumer);
+  faceTable.add(producer);
+
+  auto interest = makeInterest("/P/data");
+  auto pitEntry = forwarder.getPit().insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*consumer, *interest);
+
+  Name reflexiveName("/C");
+  reflexiveName.append(name::Component::fromNumber(960051513, ndn::tlv::ReflexiveNameComponent))
+               .append("1");
+  auto reflexiveInterest = makeInterest(reflexiveName);
+  strategy.afterReceiveInterest(*reflexiveInterest, FaceEndpoint(*producer), pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory[0].outFaceId, consumer->getId());
+
+  auto* faceInfo = strategy.m_measurements.getNamespaceInfo("/C")->getFaceInfo(consumer->getId());
+  BOOST_REQUIRE(faceInfo != nullptr);
+  BOOST_CHECK(faceInfo->isTimeoutScheduled());
+
+  // the forwarder inserts the out-record into the PIT entry of the reflexive Interest
+  auto reflexivePitEntry = forwarder.getPit().insert(*reflexiveInterest).first;
+  reflexivePitEntry->insertOrUpdateOutRecord(*consumer, *reflexiveInterest);
+  this->advanceClocks(20_ms);
+
+  auto data = makeData(reflexiveName);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*consumer), reflexivePitEntry);
+  BOOST_CHECK_EQUAL(faceInfo->getLastRtt(), 20_ms);
+  BOOST_CHECK_EQUAL(faceInfo->getRankingValue(), faceInfo->getSrtt());
+  BOOST_CHECK(!faceInfo->isTimeoutScheduled());
+}
+
 BOOST_AUTO_TEST_CASE(Parameters)
 {
   FaceTable faceTable;
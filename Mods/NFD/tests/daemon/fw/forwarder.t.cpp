@@ -310,6 +310,33 @@ BOOST_AUTO_TEST_CASE(HopLimit)
   BOOST_CHECK_EQUAL(counters.nOutNacks, 0);
 }
 
+BOOST_AUTO_TEST_CASE(HopLimitInPlace)
+{
+  auto faceIn = addFace();
+  auto faceOut = addFace();
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *faceOut, 0);
+
+  auto interest = makeInterest("/A/B");
+  interest->setHopLimit(10);
+  interest->setApplicationParameters(std::vector<uint8_t>(4000, 0xEE));
+  Block wire = interest->wireEncode();
+  faceIn->receiveInterest(*make_shared<Interest>(wire));
+  this->advanceClocks(100_ms, 1_s);
+
+  // the decremented HopLimit is written into the existing encoding
+  BOOST_REQUIRE_EQUAL(faceOut->sentInterests.size(), 1);
+  const Interest& sent = faceOut->sentInterests[0];
+  BOOST_CHECK(sent.hasWire());
+  BOOST_CHECK_EQUAL(sent.getHopLimit().value_or(0), 9);
+  BOOST_CHECK_EQUAL(sent.wireEncode().find(tlv::HopLimit)->value()[0], 9);
+  BOOST_CHECK_EQUAL(sent.wireEncode().size(), wire.size());
+  BOOST_CHECK(sent.isParametersDigestValid());
+  // the received encoding is not modified
+  BOOST_CHECK_EQUAL(Interest(wire).getHopLimit().value_or(0), 10);
+}
+
 BOOST_AUTO_TEST_CASE(AddDefaultHopLimit)
 {
   auto face = addFace();
@@ -996,8 +1023,126 @@ BOOST_AUTO_TEST_CASE(BadDefaultHopLimit)
   BOOST_CHECK_THROW(cf.parse(config, false, "dummy-config"), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(Admission)
+{
+  ConfigFile cf;
+  forwarder.setConfigFile(cf);
+  auto face1 = addFace();
+
+  std::string config = R"CONFIG(
+    forwarder
+    {
+      admission
+      {
+        face_rate 10
+        face_burst 20
+        prefix /A
+        {
+          rate 5
+        }
+        prefix /A/B
+        {
+          rate 1
+          burst 2
+        }
+        egress_rate 100
+        egress_queue_length 16
+      }
+    }
+  )CONFIG";
+
+  cf.parse(config, true, "dummy-config");
+  BOOST_TEST(!forwarder.getInterestAdmission().isEnabled());
+  BOOST_TEST(!forwarder.m_config.egressScheduling);
+
+  cf.parse(config, false, "dummy-config");
+  const auto& admission = forwarder.m_config.admission;
+  BOOST_TEST(admission.faceRate == 10);
+  BOOST_TEST(admission.faceBurst == 20);
+  BOOST_TEST_REQUIRE(admission.prefixLimits.size() == 2);
+  BOOST_TEST(admission.prefixLimits[0].prefix == "/A");
+  BOOST_TEST(admission.prefixLimits[0].rate == 5);
+  BOOST_TEST(admission.prefixLimits[0].burst == 0);
+  BOOST_TEST(admission.prefixLimits[1].prefix == "/A/B");
+  BOOST_TEST(admission.prefixLimits[1].rate == 1);
+  BOOST_TEST(admission.prefixLimits[1].burst == 2);
+  BOOST_TEST(forwarder.getInterestAdmission().isEnabled());
+  BOOST_TEST_REQUIRE(forwarder.m_config.egressScheduling.has_value());
+  BOOST_TEST(forwarder.m_config.egressScheduling->rate == 100);
+  BOOST_TEST(forwarder.m_config.egressScheduling->maxQueueLength == 16);
+
+  // the egress scheduling applies to existing and new non-local faces
+  BOOST_TEST(face1->getInterestScheduler() != nullptr);
+  auto face2 = addFace();
+  BOOST_TEST(face2->getInterestScheduler() != nullptr);
+  auto face3 = addFace("dummy://", "dummy://", ndn::nfd::FACE_SCOPE_LOCAL);
+  BOOST_TEST(face3->getInterestScheduler() == nullptr);
+
+  // removing the subsection disables the limits
+  config = R"CONFIG(
+    forwarder
+    {
+    }
+  )CONFIG";
+  cf.parse(config, false, "dummy-config");
+  BOOST_TEST(!forwarder.getInterestAdmission().isEnabled());
+  BOOST_TEST(face1->getInterestScheduler() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(BadAdmission)
+{
+  ConfigFile cf;
+  forwarder.setConfigFile(cf);
+
+  auto checkInvalid = [&] (const std::string& admission) {
+    std::string config = "forwarder\n{\nadmission\n{\n" + admission + "\n}\n}\n";
+    BOOST_TEST_CONTEXT(admission) {
+      BOOST_CHECK_THROW(cf.parse(config, true, "dummy-config"), ConfigFile::Error);
+    }
+  };
+
+  checkInvalid("face_rate -1");
+  checkInvalid("face_rate hello");
+  checkInvalid("prefix /A\n{\nburst 1\n}");
+  checkInvalid("prefix /A\n{\nrate 0\n}");
+  checkInvalid("prefix /A\n{\nrate 1\nfoo 1\n}");
+  checkInvalid("egress_burst -1");
+  checkInvalid("foo 1");
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ProcessConfig
 
+BOOST_AUTO_TEST_CASE(AdmissionRejectsInterest)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+  fib::Entry* entry = forwarder.getFib().insert("/A").first;
+  forwarder.getFib().addOrUpdateNextHop(*entry, *face2, 0);
+
+  ConfigFile cf;
+  forwarder.setConfigFile(cf);
+  cf.parse("forwarder\n{\nadmission\n{\nface_rate 1\nface_burst 2\n}\n}\n", false, "dummy-config");
+
+  face1->receiveInterest(*makeInterest("/A/1"));
+  face1->receiveInterest(*makeInterest("/A/2"));
+  face1->receiveInterest(*makeInterest("/A/3"));
+  this->advanceClocks(1_ms, 5_ms);
+
+  BOOST_TEST(face2->sentInterests.size() == 2);
+  BOOST_TEST(forwarder.getPit().size() == 2);
+  BOOST_TEST_REQUIRE(face1->sentNacks.size() == 1);
+  BOOST_TEST(face1->sentNacks[0].getInterest().getName() == "/A/3");
+  BOOST_TEST(face1->sentNacks[0].getReason() == lp::NackReason::CONGESTION);
+  BOOST_TEST(counters.nOutNacks == 1);
+
+  // a token is added after one second
+  this->advanceClocks(100_ms, 1_s);
+  face1->receiveInterest(*makeInterest("/A/4"));
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_TEST(face2->sentInterests.size() == 3);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarder
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/interest-admission.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/clock-fixture.hpp"
+
+namespace nfd::tests {
+
+using fw::InterestAdmission;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+
+class InterestAdmissionFixture : public ClockFixture
+{
+protected:
+  // buckets configured by setConfig() are created at the current time of the unit-test clock
+  const time::steady_clock::time_point T0 = time::steady_clock::now();
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestInterestAdmission, InterestAdmissionFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  InterestAdmission admission;
+  BOOST_CHECK(!admission.isEnabled());
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(admission.admit(*makeInterest("/A"), 1, T0));
+  }
+  BOOST_CHECK(admission.getFaceStates().empty());
+}
+
+BOOST_AUTO_TEST_CASE(PerFace)
+{
+  InterestAdmission admission;
+  InterestAdmission::Config config;
+  config.faceRate = 1;
+  config.faceBurst = 2;
+  admission.setConfig(config);
+  BOOST_CHECK(admission.isEnabled());
+
+  auto interest = makeInterest("/A");
+  BOOST_CHECK(admission.admit(*interest, 1, T0));
+  BOOST_CHECK(admission.admit(*interest, 1, T0));
+  BOOST_CHECK(!admission.admit(*interest, 1, T0));
+  // each face has its own bucket
+  BOOST_CHECK(admission.admit(*interest, 2, T0));
+  BOOST_CHECK(admission.admit(*interest, 1, T0 + 1_s));
+
+  BOOST_REQUIRE_EQUAL(admission.getFaceStates().size(), 2);
+  const auto& state1 = admission.getFaceStates().at(1);
+  BOOST_CHECK_EQUAL(state1.nAdmitted, 3);
+  BOOST_CHECK_EQUAL(state1.nRejected, 1);
+
+  admission.removeFace(1);
+  BOOST_CHECK_EQUAL(admission.getFaceStates().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(NestedPrefixes)
+{
+  InterestAdmission admission;
+  InterestAdmission::Config config;
+  config.prefixLimits.push_back({"/A", 1, 3});
+  config.prefixLimits.push_back({"/A/B", 1, 1});
+  admission.setConfig(config);
+  BOOST_CHECK(admission.isEnabled());
+
+  // /A/B is bounded by its own bucket and by the bucket of /A
+  BOOST_CHECK(admission.admit(*makeInterest("/A/B/1"), 1, T0));
+  BOOST_CHECK(!admission.admit(*makeInterest("/A/B/2"), 2, T0));
+  BOOST_CHECK(admission.admit(*makeInterest("/A/C/1"), 1, T0));
+  BOOST_CHECK(admission.admit(*makeInterest("/A/C/2"), 1, T0));
+  BOOST_CHECK(!admission.admit(*makeInterest("/A/C/3"), 1, T0));
+  BOOST_CHECK(admission.admit(*makeInterest("/A/C/4"), 1, T0 + 1_s));
+  // a rejection by /A does not take the token of /A/B
+  BOOST_CHECK(!admission.admit(*makeInterest("/A/B/3"), 1, T0 + 1_s));
+  const auto& prefixes = admission.getPrefixStates();
+  BOOST_REQUIRE_EQUAL(prefixes.size(), 2);
+  TokenBucket bucketAB = prefixes[1].second.bucket;
+  BOOST_CHECK(bucketAB.hasToken(T0 + 1_s));
+  BOOST_CHECK(admission.admit(*makeInterest("/A/B/4"), 1, T0 + 2_s));
+  // other prefixes are not limited
+  BOOST_CHECK(admission.admit(*makeInterest("/Z"), 1, T0 + 2_s));
+
+  BOOST_CHECK_EQUAL(prefixes[0].first, "/A");
+  BOOST_CHECK_EQUAL(prefixes[0].second.nAdmitted, 5);
+  BOOST_CHECK_EQUAL(prefixes[0].second.nRejected, 3);
+  BOOST_CHECK_EQUAL(prefixes[1].first, "/A/B");
+  BOOST_CHECK_EQUAL(prefixes[1].second.nAdmitted, 2);
+  BOOST_CHECK_EQUAL(prefixes[1].second.nRejected, 2);
+
+  // reconfiguring resets the buckets
+  admission.setConfig(config);
+  BOOST_CHECK_EQUAL(admission.getPrefixStates()[0].second.nAdmitted, 0);
+  admission.setConfig({});
+  BOOST_CHECK(!admission.isEnabled());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestAdmission
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace nfd::tests
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** \file
+ *  This test suite checks that a strategy returns a reflexive Interest from a producer
+ *  to the downstream of the original Interest, instead of forwarding it according to the FIB.
+ */
+
+// Strategies that are reflexive-aware, sorted alphabetically.
+#include "fw/access-strategy.hpp"
+#include "fw/asf-strategy.hpp"
+#include "fw/best-route-strategy.hpp"
+#include "fw/multicast-strategy.hpp"
+#include "fw/random-strategy.hpp"
+#include "fw/self-learning-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace nfd::tests {
+
+using namespace nfd::fw;
+
+using SelfLearningStrategyTester = StrategyTester<SelfLearningStrategy>;
+NFD_REGISTER_STRATEGY(SelfLearningStrategyTester);
+
+template<typename S>
+class StrategyReflexiveFixture : public GlobalIoTimeFixture
+{
+public:
+  StrategyReflexiveFixture()
+    : limitedIo(this)
+    , forwarder(faceTable)
+    , strategy(choose<StrategyTester<S>>(forwarder))
+    , fib(forwarder.getFib())
+    , pit(forwarder.getPit())
+    , consumer(make_shared<DummyFace>())
+    , producer(make_shared<DummyFace>())
+    , other(make_shared<DummyFace>())
+  {
+    faceTable.add(consumer);
+    faceTable.add(producer);
+    faceTable.add(other);
+
+    fib::Entry* entry = fib.insert("/").first;
+    fib.addOrUpdateNextHop(*entry, *producer, 10);
+    fib.addOrUpdateNextHop(*entry, *other, 20);
+  }
+
+  static shared_ptr<Interest>
+  makeReflexiveInterest()
+  {
+    Name name("/C");
+    name.append(name::Component::fromNumber(960051513, ndn::tlv::ReflexiveNameComponent));
+    name.append("1");
+    auto interest = makeInterest(name);
+    BOOST_REQUIRE(interest->isReflexiveInterestFromProducer());
+    return interest;
+  }
+
+public:
+  LimitedIo limitedIo;
+
+  FaceTable faceTable;
+  Forwarder forwarder;
+  StrategyTester<S>& strategy;
+  Fib& fib;
+  Pit& pit;
+
+  shared_ptr<Face> consumer;
+  shared_ptr<Face> producer;
+  shared_ptr<Face> other;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_AUTO_TEST_SUITE(TestStrategyReflexive)
+
+using Strategies = boost::mpl::vector<
+  AccessStrategy,
+  AsfStrategy,
+  BestRouteStrategy,
+  MulticastStrategy,
+  RandomStrategy,
+  SelfLearningStrategy
+>;
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReturnToDownstream, S, Strategies, StrategyReflexiveFixture<S>)
+{
+  auto interest = makeInterest("/P/data");
+  auto pitEntry = this->pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*this->consumer, *interest);
+  pitEntry->insertOrUpdateOutRecord(*this->producer, *interest);
+
+  auto reflexiveInterest = this->makeReflexiveInterest();
+  auto f = [&] {
+    this->strategy.afterReceiveInterest(*reflexiveInterest, FaceEndpoint(*this->producer), pitEntry);
+  };
+  BOOST_REQUIRE(this->strategy.waitForAction(f, this->limitedIo, 1));
+
+  BOOST_REQUIRE_EQUAL(this->strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(this->strategy.sendInterestHistory[0].outFaceId, this->consumer->getId());
+  BOOST_CHECK_EQUAL(this->strategy.sendInterestHistory[0].interest.getName(),
+                    reflexiveInterest->getName());
+  BOOST_CHECK_EQUAL(this->strategy.sendNackHistory.size(), 0);
+  BOOST_CHECK_EQUAL(this->strategy.rejectPendingInterestHistory.size(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(NoDownstream, S, Strategies, StrategyReflexiveFixture<S>)
+{
+  auto interest = makeInterest("/P/data");
+  auto pitEntry = this->pit.insert(*interest).first;
+
+  auto reflexiveInterest = this->makeReflexiveInterest();
+  auto f = [&] {
+    this->strategy.afterReceiveInterest(*reflexiveInterest, FaceEndpoint(*this->producer), pitEntry);
+  };
+  BOOST_REQUIRE(this->strategy.waitForAction(f, this->limitedIo, 2));
+
+  BOOST_CHECK_EQUAL(this->strategy.sendInterestHistory.size(), 0);
+  BOOST_CHECK_EQUAL(this->strategy.sendNackHistory.size(), 1);
+  BOOST_CHECK_EQUAL(this->strategy.rejectPendingInterestHistory.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestStrategyReflexive
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace nfd::tests
@@ -103,8 +103,13 @@ protected:
                const shared_ptr<pit::Entry>& pitEntry) override
   {
     sendInterestHistory.push_back({pitEntry->getInterest(), egress.getId(), interest});
-    auto it = pitEntry->insertOrUpdateOutRecord(egress, interest);
-    BOOST_ASSERT(it != pitEntry->out_end());
+    auto outPitEntry = pitEntry;
+    if (interest.isReflexiveInterestFromProducer()) {
+      // the forwarder records a reflexive Interest in its own PIT entry
+      outPitEntry = reflexivePitEntries.emplace_back(make_shared<pit::Entry>(interest));
+    }
+    auto it = outPitEntry->insertOrUpdateOutRecord(egress, interest);
+    BOOST_ASSERT(it != outPitEntry->out_end());
     afterAction();
     return &*it;
   }
@@ -134,6 +139,7 @@ public:
     Interest interest;
   };
   std::vector<SendInterestArgs> sendInterestHistory;
+  std::vector<shared_ptr<pit::Entry>> reflexivePitEntries;
 
   struct RejectPendingInterestArgs
   {
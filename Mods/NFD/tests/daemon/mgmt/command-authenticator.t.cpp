@@ -27,6 +27,9 @@
 
 #include "manager-common-fixture.hpp"
 
+#include <boost/filesystem/operations.hpp>
+#include <fstream>
+
 namespace nfd::tests {
 
 class CommandAuthenticatorFixture : public InterestSignerFixture
@@ -58,7 +61,12 @@ protected:
     if (modifyInterest) {
       modifyInterest(interest);
     }
+    return authorizeInterest(module, interest);
+  }
 
+  bool
+  authorizeInterest(const std::string& module, const Interest& interest)
+  {
     const auto& authorization = authorizations.at(module);
 
     bool isAccepted = false;
@@ -267,6 +275,103 @@ protected:
   const Name id1{"/localhost/CommandAuthenticator/1"};
 };
 
+BOOST_FIXTURE_TEST_CASE(VerifiedKeyCache, IdentityAuthorizedFixture)
+{
+  auto makeCommand = [this] {
+    return makeControlCommandRequest("/prefix/module1/verb", {},
+                                     ndn::security::SignedInterestFormat::V03, id1);
+  };
+
+  // the key is cached after the first full validation
+  BOOST_CHECK(!authenticator->authorizeFromCache("module1", makeCommand()));
+  BOOST_CHECK_EQUAL(authorize("module1", id1), true);
+  std::string requester = lastRequester;
+  Interest cached = makeCommand();
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", cached), true);
+  BOOST_CHECK_EQUAL(lastRequester, requester);
+
+  // a command accepted from the cache cannot be replayed through full validation
+  BOOST_CHECK(!authenticator->authorizeFromCache("module1", cached));
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", cached), false);
+  BOOST_CHECK(lastRejectReply == ndn::mgmt::RejectReply::STATUS403);
+
+  // a bad signature is not accepted from the cache
+  Interest badSig = makeCommand();
+  badSig.setSignatureValue({0xBA, 0xAD});
+  BOOST_CHECK(!authenticator->authorizeFromCache("module1", badSig));
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", badSig), false);
+
+  // the cache is per module
+  makeModules({"module2"});
+  BOOST_CHECK(!authenticator->authorizeFromCache("module2", makeCommand()));
+
+  // an expired key goes through full validation again
+  advanceClocks(CommandAuthenticator::VERIFIED_KEY_LIFETIME);
+  BOOST_CHECK(!authenticator->authorizeFromCache("module1", makeCommand()));
+  BOOST_CHECK_EQUAL(authorize("module1", id1), true);
+  BOOST_CHECK(authenticator->authorizeFromCache("module1", makeCommand()));
+}
+
+BOOST_AUTO_TEST_CASE(HmacKey)
+{
+  // base64 of a 32-octet key
+  const std::string hmacKey = "MDEyMzQ1Njc4OWFiY2RlZjAxMjM0NTY3ODlhYmNkZWY=";
+  std::ofstream("hmac.key") << hmacKey << std::endl;
+
+  Name id1("/localhost/CommandAuthenticator/1");
+  BOOST_REQUIRE(saveIdentityCert(id1, "1.ndncert", true));
+
+  makeModules({"module1", "module2"});
+  const std::string config = R"CONFIG(
+    authorizations
+    {
+      authorize
+      {
+        hmackey "hmac.key"
+        privileges
+        {
+          module1
+        }
+      }
+      authorize
+      {
+        certfile "1.ndncert"
+        privileges
+        {
+          module2
+        }
+      }
+    }
+  )CONFIG";
+  loadConfig(config);
+  boost::filesystem::remove("hmac.key");
+
+  ndn::security::InterestSigner signer(m_keyChain);
+  auto makeHmacCommand = [&] (const Name& name) {
+    Interest interest(Name(name).append(tlv::GenericNameComponent, ControlParameters().wireEncode()));
+    signer.makeSignedInterest(interest, ndn::security::SigningInfo("hmac-sha256:" + hmacKey));
+    return interest;
+  };
+
+  Interest command = makeHmacCommand("/localhost/nfd/module1/verb");
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", command), true);
+  BOOST_CHECK(ndn::security::SigningInfo::getHmacIdentity().isPrefixOf(lastRequester));
+  // replayed command
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", command), false);
+
+  // HMAC keys are accepted only for local commands
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", makeHmacCommand("/prefix/module1/verb")), false);
+  // and only for the modules they are authorized for
+  BOOST_CHECK_EQUAL(authorizeInterest("module2", makeHmacCommand("/localhost/nfd/module2/verb")), false);
+  BOOST_CHECK_EQUAL(authorize("module2", id1), true);
+
+  // a different HMAC key is rejected
+  Interest otherKey(Name("/localhost/nfd/module1/verb"));
+  signer.makeSignedInterest(otherKey, ndn::security::SigningInfo(
+                                        "hmac-sha256:QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWVo0NTY3ODk="));
+  BOOST_CHECK_EQUAL(authorizeInterest("module1", otherKey), false);
+}
+
 BOOST_FIXTURE_TEST_SUITE(Reject, IdentityAuthorizedFixture)
 
 BOOST_AUTO_TEST_CASE(NameTooShort)
@@ -476,6 +581,45 @@ BOOST_AUTO_TEST_CASE(CertfileMissing)
   BOOST_CHECK_THROW(loadConfig(config), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(CertfileAndHmackey)
+{
+  std::ofstream("hmac.key") << "MDEyMzQ1Njc4OWFiY2RlZjAxMjM0NTY3ODlhYmNkZWY=" << std::endl;
+  const std::string config = R"CONFIG(
+    authorizations
+    {
+      authorize
+      {
+        certfile any
+        hmackey "hmac.key"
+        privileges
+        {
+        }
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(loadConfig(config), ConfigFile::Error);
+  boost::filesystem::remove("hmac.key");
+}
+
+BOOST_AUTO_TEST_CASE(HmackeyUnreadable)
+{
+  const std::string config = R"CONFIG(
+    authorizations
+    {
+      authorize
+      {
+        hmackey "hmac.key"
+        privileges
+        {
+        }
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(loadConfig(config), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(CertUnreadable)
 {
   const std::string config = R"CONFIG(
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/fib-manager.hpp"
+#include "common/global.hpp"
 #include "table/fib-nexthop.hpp"
 
 #include "manager-common-fixture.hpp"
@@ -31,6 +32,7 @@
 
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/mgmt/nfd/fib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/fib-event-notification.hpp>
 
 namespace nfd::tests {
 
@@ -43,6 +45,14 @@ public:
   {
     setTopPrefix();
     setPrivilege("fib");
+
+    // keep notifications of fib/events apart from command responses
+    m_face.onSendData.connect([this] (const Data& data) {
+      if (Name("/localhost/nfd/fib/events").isPrefixOf(data.getName())) {
+        m_events.emplace_back(data.getContent().blockFromValue());
+        m_responses.pop_back();
+      }
+    });
   }
 
 public: // for test
@@ -125,6 +135,7 @@ public: // for check
 protected:
   Fib&       m_fib;
   FibManager m_manager;
+  std::vector<ndn::nfd::FibEventNotification> m_events;
 };
 
 static std::ostream&
@@ -398,6 +409,134 @@ BOOST_AUTO_TEST_CASE(RecordNotExist)
 
 BOOST_AUTO_TEST_SUITE_END() // RemoveNextHop
 
+BOOST_AUTO_TEST_SUITE(Batch)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  FibBatchParameters batch;
+  batch.addNextHop("/A", 1, 10)
+       .removeNextHop("/B", 2);
+
+  FibBatchParameters decoded(batch.wireEncode());
+  BOOST_TEST(decoded.wireEncode() == batch.wireEncode());
+  BOOST_REQUIRE_EQUAL(decoded.size(), 2);
+  BOOST_CHECK(decoded.getOperations()[0].action == FibBatchParameters::Action::ADD_NEXTHOP);
+  BOOST_CHECK_EQUAL(decoded.getOperations()[0].parameters.getName(), "/A");
+  BOOST_CHECK_EQUAL(decoded.getOperations()[0].parameters.getCost(), 10);
+  BOOST_CHECK(decoded.getOperations()[1].action == FibBatchParameters::Action::REMOVE_NEXTHOP);
+  BOOST_CHECK_EQUAL(decoded.getOperations()[1].parameters.getFaceId(), 2);
+
+  Block wire = batch.wireEncode();
+  wire.push_back(ndn::makeNonNegativeIntegerBlock(0xF2, 1));
+  wire.encode();
+  BOOST_CHECK_THROW(FibBatchParameters{wire}, FibBatchParameters::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Success)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+
+  fib::Entry* entry = m_fib.insert("/hello").first;
+  m_fib.addOrUpdateNextHop(*entry, *m_faceTable.get(face1), 101);
+
+  FibBatchParameters batch;
+  batch.addNextHop("/hello", face2, 202)
+       .addNextHop("/world", face1, 1)
+       .removeNextHop("/hello", face1);
+  auto req = makeControlCommandRequest("/localhost/nfd/fib/batch", batch);
+  receiveInterest(req);
+
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(),
+                                  ControlResponse(200, "Success").setBody(batch.wireEncode())),
+                    CheckResponseResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face2, 202), CheckNextHopResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/world", 1, face1, 1), CheckNextHopResult::OK);
+}
+
+BOOST_AUTO_TEST_CASE(ImplicitFaceId)
+{
+  auto face1 = addFace();
+
+  FibBatchParameters batch;
+  batch.addNextHop("/hello", 0, 101);
+  auto req = makeControlCommandRequest("/localhost/nfd/fib/batch", batch);
+  req.setTag(make_shared<lp::IncomingFaceIdTag>(face1));
+  receiveInterest(req);
+
+  FibBatchParameters expected;
+  expected.addNextHop("/hello", face1, 101);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(),
+                                  ControlResponse(200, "Success").setBody(expected.wireEncode())),
+                    CheckResponseResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face1, 101), CheckNextHopResult::OK);
+}
+
+BOOST_AUTO_TEST_CASE(Atomic)
+{
+  auto face1 = addFace();
+
+  Name longPrefix;
+  while (longPrefix.size() <= Fib::getMaxDepth()) {
+    longPrefix.append("A");
+  }
+
+  FibBatchParameters unknownFace;
+  unknownFace.addNextHop("/hello", face1, 101)
+             .addNextHop("/world", face1 + 100, 1);
+  auto req = makeControlCommandRequest("/localhost/nfd/fib/batch", unknownFace);
+  receiveInterest(req);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(), ControlResponse(410, "Operation 1: Face not found")),
+                    CheckResponseResult::OK);
+
+  m_responses.clear();
+  FibBatchParameters tooLong;
+  tooLong.addNextHop(longPrefix, face1, 1)
+         .addNextHop("/hello", face1, 101);
+  req = makeControlCommandRequest("/localhost/nfd/fib/batch", tooLong);
+  receiveInterest(req);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  ControlResponse response(m_responses.at(0).getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(response.getCode(), 414);
+
+  BOOST_CHECK_EQUAL(checkNextHop("/hello"), CheckNextHopResult::NO_FIB_ENTRY);
+  BOOST_CHECK_EQUAL(m_fib.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  auto req = makeControlCommandRequest("/localhost/nfd/fib/batch", FibBatchParameters());
+  receiveInterest(req);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, req.getName(), ControlResponse(400, "failed in validating parameters")),
+                    CheckResponseResult::OK);
+}
+
+BOOST_AUTO_TEST_CASE(InProcess)
+{
+  auto face1 = addFace();
+
+  FibBatchParameters batch;
+  batch.addNextHop("/hello", face1, 101)
+       .addNextHop("/world", face1 + 100, 1)
+       .removeNextHop("/foo", face1);
+  auto responses = m_manager.applyBatch(batch);
+
+  // unlike fib/batch, the failed operation does not prevent the others from being applied
+  BOOST_REQUIRE_EQUAL(responses.size(), 3);
+  BOOST_CHECK_EQUAL(responses[0].getCode(), 200);
+  BOOST_CHECK_EQUAL(responses[1].getCode(), 410);
+  BOOST_CHECK_EQUAL(responses[2].getCode(), 200);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face1, 101), CheckNextHopResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/world"), CheckNextHopResult::NO_FIB_ENTRY);
+  BOOST_CHECK_EQUAL(m_responses.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Batch
+
 BOOST_AUTO_TEST_SUITE(List)
 
 BOOST_AUTO_TEST_CASE(FibDataset)
@@ -440,8 +579,104 @@ BOOST_AUTO_TEST_CASE(FibDataset)
   BOOST_TEST(receivedRecords == expectedRecords, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(FibDatasetFilter)
+{
+  auto face = m_faceTable.get(addFace());
+  for (const char* prefix : {"/A", "/A/B", "/A/B/C", "/AB", "/B"}) {
+    m_fib.addOrUpdateNextHop(*m_fib.insert(prefix).first, *face, 1);
+  }
+
+  receiveInterest(Interest(Name("/localhost/nfd/fib/list").append(Name("/A/B").wireEncode()))
+                  .setCanBePrefix(true));
+  Block content = concatenateResponses();
+  content.parse();
+  std::set<Name> prefixes;
+  for (const auto& element : content.elements()) {
+    prefixes.insert(ndn::nfd::FibEntry(element).getPrefix());
+  }
+  BOOST_CHECK_EQUAL(prefixes.size(), 2);
+  BOOST_CHECK_EQUAL(prefixes.count("/A/B"), 1);
+  BOOST_CHECK_EQUAL(prefixes.count("/A/B/C"), 1);
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/list").append("not-a-name")).setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  ControlResponse response(m_responses[0].getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(response.getCode(), 400);
+}
+
+BOOST_AUTO_TEST_CASE(FibDatasetModifiedWhileStreaming)
+{
+  const size_t nEntries = 2000;
+  auto face = m_faceTable.get(addFace());
+  for (size_t i = 0; i < nEntries; ++i) {
+    m_fib.addOrUpdateNextHop(*m_fib.insert(Name("/test").appendSegment(i)).first, *face, 1);
+  }
+
+  // erase every entry once the first slice has been produced
+  m_face.receive(Interest("/localhost/nfd/fib/list").setCanBePrefix(true));
+  getGlobalIoService().post([this] {
+    std::vector<Name> prefixes;
+    for (const auto& entry : m_fib) {
+      prefixes.push_back(entry.getPrefix());
+    }
+    for (const auto& prefix : prefixes) {
+      m_fib.erase(prefix);
+    }
+  });
+  advanceClocks(1_ms);
+
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_CHECK_GT(content.elements().size(), 0);
+  BOOST_CHECK_LT(content.elements().size(), nEntries);
+  BOOST_CHECK_EQUAL(m_fib.size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // List
 
+BOOST_AUTO_TEST_CASE(Events)
+{
+  auto face1 = m_faceTable.get(addFace());
+  auto face2 = m_faceTable.get(addFace());
+
+  fib::Entry& entry = *m_fib.insert("/A").first;
+  m_fib.addOrUpdateNextHop(entry, *face1, 10);
+  m_fib.addOrUpdateNextHop(entry, *face1, 10); // unchanged
+  m_fib.addOrUpdateNextHop(entry, *face1, 20);
+  m_fib.addOrUpdateNextHop(entry, *face2, 30);
+  m_fib.removeNextHop(entry, *face1);
+  advanceClocks(1_ms);
+
+  BOOST_CHECK_EQUAL(m_responses.size(), 0);
+  BOOST_REQUIRE_EQUAL(m_events.size(), 4);
+  using namespace ndn::nfd;
+  const std::vector<std::tuple<RouteEventKind, FaceId, uint64_t>> expected{
+    {ROUTE_EVENT_ADDED, face1->getId(), 10},
+    {ROUTE_EVENT_UPDATED, face1->getId(), 20},
+    {ROUTE_EVENT_ADDED, face2->getId(), 30},
+    {ROUTE_EVENT_REMOVED, face1->getId(), 20},
+  };
+  for (size_t i = 0; i < expected.size(); ++i) {
+    BOOST_TEST_CONTEXT("event " << i) {
+      BOOST_CHECK_EQUAL(m_events[i].getSequence(), i);
+      BOOST_CHECK_EQUAL(m_events[i].getName(), "/A");
+      BOOST_CHECK_EQUAL(m_events[i].getKind(), std::get<0>(expected[i]));
+      BOOST_CHECK_EQUAL(m_events[i].getNextHop().getFaceId(), std::get<1>(expected[i]));
+      BOOST_CHECK_EQUAL(m_events[i].getNextHop().getCost(), std::get<2>(expected[i]));
+    }
+  }
+
+  // erasing the entry announces the removal of its remaining nexthops
+  m_events.clear();
+  m_fib.erase("/A");
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(m_events.size(), 1);
+  BOOST_CHECK_EQUAL(m_events[0].getSequence(), 4);
+  BOOST_CHECK_EQUAL(m_events[0].getKind(), ROUTE_EVENT_REMOVED);
+  BOOST_CHECK_EQUAL(m_events[0].getNextHop().getFaceId(), face2->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestFibManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
@@ -24,9 +24,11 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "mgmt/admission-status.hpp"
 #include "core/version.hpp"
 
 #include "manager-common-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
 
 namespace nfd::tests {
 
@@ -107,6 +109,73 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
 }
 
+BOOST_AUTO_TEST_CASE(AdmissionStatusDataset)
+{
+  ConfigFile cf;
+  m_forwarder.setConfigFile(cf);
+  cf.parse(R"CONFIG(
+    forwarder
+    {
+      admission
+      {
+        face_rate 10
+        face_burst 2
+        prefix /A
+        {
+          rate 5
+          burst 5
+        }
+        egress_rate 100
+      }
+    }
+  )CONFIG", false, "dummy-config");
+
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>("dummy://", "dummy://", ndn::nfd::FACE_SCOPE_LOCAL);
+  m_faceTable.add(face1);
+  m_faceTable.add(face2);
+  for (int i = 0; i < 3; ++i) {
+    face1->receiveInterest(*makeInterest(Name("/A").appendNumber(i)));
+  }
+  this->advanceClocks(1_ms);
+
+  receiveInterest(Interest("/localhost/nfd/status/admission").setCanBePrefix(true));
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  // one entry for /A, one for face1 with its bucket and egress scheduler
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  AdmissionStatus prefixStatus(content.elements()[0]);
+  BOOST_REQUIRE(prefixStatus.prefix.has_value());
+  BOOST_CHECK_EQUAL(*prefixStatus.prefix, "/A");
+  BOOST_CHECK(!prefixStatus.faceId);
+  BOOST_REQUIRE(prefixStatus.bucket.has_value());
+  BOOST_CHECK_EQUAL(prefixStatus.bucket->rate, 5);
+  BOOST_CHECK_EQUAL(prefixStatus.bucket->burst, 5);
+  BOOST_CHECK_EQUAL(prefixStatus.bucket->tokens, 3);
+  BOOST_CHECK_EQUAL(prefixStatus.bucket->nAdmitted, 2);
+  BOOST_CHECK_EQUAL(prefixStatus.bucket->nRejected, 1);
+  BOOST_CHECK(!prefixStatus.egress);
+
+  AdmissionStatus faceStatus(content.elements()[1]);
+  BOOST_CHECK(!faceStatus.prefix);
+  BOOST_REQUIRE(faceStatus.faceId.has_value());
+  BOOST_CHECK_EQUAL(*faceStatus.faceId, face1->getId());
+  BOOST_REQUIRE(faceStatus.bucket.has_value());
+  BOOST_CHECK_EQUAL(faceStatus.bucket->rate, 10);
+  BOOST_CHECK_EQUAL(faceStatus.bucket->tokens, 0);
+  BOOST_CHECK_EQUAL(faceStatus.bucket->nAdmitted, 2);
+  BOOST_CHECK_EQUAL(faceStatus.bucket->nRejected, 1);
+  BOOST_REQUIRE(faceStatus.egress.has_value());
+  BOOST_CHECK_EQUAL(faceStatus.egress->nQueued, 0);
+  BOOST_CHECK_EQUAL(faceStatus.egress->nDropped, 0);
+
+  // encoding round trip
+  BOOST_CHECK_EQUAL(faceStatus.wireEncode(), content.elements()[1]);
+  BOOST_CHECK_THROW(AdmissionStatus(Block(ndn::tlv::Name)), AdmissionStatus::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
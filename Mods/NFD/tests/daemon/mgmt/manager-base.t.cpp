@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/manager-base.hpp"
+#include "common/global.hpp"
 
 #include "manager-common-fixture.hpp"
 
@@ -112,6 +113,57 @@ BOOST_AUTO_TEST_CASE(RegisterStatusDataset)
   BOOST_CHECK(wasHandlerCalled);
 }
 
+BOOST_AUTO_TEST_CASE(StreamStatusDataset)
+{
+  const size_t nSlices = 4;
+  size_t nProducedSlices = 0;
+  std::optional<size_t> nSlicesBeforeOtherHandler;
+
+  m_manager.registerStatusDatasetHandler("test-status", [&] (auto&&, auto&&, auto& context) {
+    m_manager.streamStatusDataset(context, [&] (auto& context, size_t budget) {
+      if (nProducedSlices == 0) {
+        getGlobalIoService().post([&] { nSlicesBeforeOtherHandler = nProducedSlices; });
+      }
+      context.append(std::vector<uint8_t>(budget, static_cast<uint8_t>(nProducedSlices)));
+      return ++nProducedSlices == nSlices;
+    });
+  });
+  setTopPrefix();
+
+  receiveInterest(*makeInterest("/localhost/nfd/test-module/test-status", true));
+  BOOST_CHECK_EQUAL(nProducedSlices, nSlices);
+  // other handlers run between slices
+  BOOST_CHECK_EQUAL(nSlicesBeforeOtherHandler.value_or(0), 1);
+
+  Block content = concatenateResponses();
+  BOOST_CHECK_EQUAL(content.value_size(), nSlices * ManagerBase::DATASET_SLICE_LENGTH);
+}
+
+BOOST_AUTO_TEST_CASE(SegmentRequestedBeforeProduction)
+{
+  shared_ptr<ndn::mgmt::StatusDatasetContext> pendingContext;
+  m_manager.registerStatusDatasetHandler("test-status", [&] (auto&&, auto&&, auto& context) {
+    // fill more than one segment, and complete the response later
+    context.append(std::vector<uint8_t>(ManagerBase::DATASET_SLICE_LENGTH + 1));
+    pendingContext = context.shared_from_this();
+  });
+  setTopPrefix();
+
+  receiveInterest(*makeInterest("/localhost/nfd/test-module/test-status", true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_REQUIRE(pendingContext != nullptr);
+
+  Name segment1 = m_responses[0].getName().getPrefix(-1).appendSegment(1);
+  receiveInterest(*makeInterest(segment1));
+  BOOST_CHECK_EQUAL(m_responses.size(), 1);
+
+  pendingContext->end();
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 2);
+  BOOST_CHECK_EQUAL(m_responses[1].getName(), segment1);
+  BOOST_CHECK_EQUAL(m_responses[1].getContent().value_size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(RegisterNotificationStream)
 {
   auto post = m_manager.registerNotificationStream("test-notification");
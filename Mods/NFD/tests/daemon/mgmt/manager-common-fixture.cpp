@@ -37,6 +37,17 @@ InterestSignerFixture::makeControlCommandRequest(Name commandName,
                                                  const ControlParameters& params,
                                                  ndn::security::SignedInterestFormat format,
                                                  const Name& identity)
+{
+  return makeControlCommandRequest(std::move(commandName),
+                                   static_cast<const ndn::mgmt::ControlParameters&>(params),
+                                   format, identity);
+}
+
+Interest
+InterestSignerFixture::makeControlCommandRequest(Name commandName,
+                                                 const ndn::mgmt::ControlParameters& params,
+                                                 ndn::security::SignedInterestFormat format,
+                                                 const Name& identity)
 {
   commandName.append(tlv::GenericNameComponent, params.wireEncode());
 
@@ -59,6 +59,15 @@ protected:
                             ndn::security::SignedInterestFormat format = ndn::security::SignedInterestFormat::V03,
                             const Name& identity = DEFAULT_COMMAND_SIGNER_IDENTITY);
 
+  /**
+   * \brief Create a ControlCommand request whose parameters are not ControlParameters.
+   */
+  Interest
+  makeControlCommandRequest(Name commandName,
+                            const ndn::mgmt::ControlParameters& params,
+                            ndn::security::SignedInterestFormat format = ndn::security::SignedInterestFormat::V03,
+                            const Name& identity = DEFAULT_COMMAND_SIGNER_IDENTITY);
+
 protected:
   static inline const Name DEFAULT_COMMAND_SIGNER_IDENTITY{"/InterestSignerFixture-identity"};
 
@@ -31,6 +31,7 @@
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/mgmt/nfd/face-status.hpp>
 #include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/rib-event-notification.hpp>
 
 #include <boost/property_tree/info_parser.hpp>
 
@@ -139,6 +140,14 @@ public:
                                                   opts);
     m_keyChain.setDefaultCertificate(derivedKey, derivedCert);
 
+    // keep notifications of rib/events apart from command responses
+    m_face.onSendData.connect([this] (const Data& data) {
+      if (data.getName().size() > 4 && data.getName().getSubName(2, 2) == Name("rib/events")) {
+        m_events.push_back(data);
+        m_responses.pop_back();
+      }
+    });
+
     if (m_status.isLocalhostConfigured) {
       m_manager.applyLocalhostConfig(getValidatorConfigSection(), "test");
     }
@@ -196,8 +205,9 @@ private:
       }
     }
 
-    // clear commands and responses
+    // clear commands, responses, and notifications
     m_responses.clear();
+    m_events.clear();
     m_face.sentInterests.clear();
   }
 
@@ -241,6 +251,7 @@ protected:
   rib::Rib m_rib;
   MockFibUpdater m_fibUpdater;
   RibManager m_manager;
+  std::vector<Data> m_events;
 };
 
 BOOST_AUTO_TEST_SUITE(Mgmt)
@@ -454,6 +465,49 @@ BOOST_AUTO_TEST_CASE(NameTooLong)
 
 BOOST_AUTO_TEST_SUITE_END() // RegisterUnregister
 
+BOOST_FIXTURE_TEST_CASE(Events, AuthorizedRibManagerFixture)
+{
+  auto paramsRegister = makeRegisterParameters("/test-events", 9527);
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register", paramsRegister));
+  paramsRegister.setCost(20);
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register", paramsRegister));
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register", paramsRegister)); // unchanged
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/unregister",
+                                            makeUnregisterParameters("/test-events", 9527)));
+  BOOST_CHECK_EQUAL(m_responses.size(), 4);
+
+  using namespace ndn::nfd;
+  const std::vector<std::pair<RouteEventKind, uint64_t>> expected{
+    {ROUTE_EVENT_ADDED, 10},
+    {ROUTE_EVENT_UPDATED, 20},
+    {ROUTE_EVENT_REMOVED, 20},
+  };
+  // events of the routes toward the management prefixes are not considered
+  std::vector<RibEventNotification> events;
+  for (const auto& data : m_events) {
+    // published under /localhost/nfd only, although localhop is enabled
+    BOOST_CHECK(Name("/localhost/nfd/rib/events").isPrefixOf(data.getName()));
+    RibEventNotification event(data.getContent().blockFromValue());
+    if (event.getName() == "/test-events") {
+      events.push_back(event);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(events.size(), expected.size());
+  uint64_t firstSequence = events[0].getSequence();
+  for (size_t i = 0; i < expected.size(); ++i) {
+    BOOST_TEST_CONTEXT("event " << i) {
+      const auto& event = events[i];
+      BOOST_CHECK_EQUAL(event.getSequence(), firstSequence + i);
+      BOOST_CHECK_EQUAL(event.getKind(), expected[i].first);
+      BOOST_CHECK_EQUAL(event.getName(), "/test-events");
+      BOOST_CHECK_EQUAL(event.getRoute().getFaceId(), 9527);
+      BOOST_CHECK_EQUAL(event.getRoute().getOrigin(), ROUTE_ORIGIN_NLSR);
+      BOOST_CHECK_EQUAL(event.getRoute().getCost(), expected[i].second);
+    }
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE(RibDataset, UnauthorizedRibManagerFixture)
 {
   uint64_t faceId = 0;
@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/rib.hpp"
+
+#include "tests/test-common.hpp"
+#include "fib-updates-common.hpp"
+
+namespace nfd::tests {
+
+class FibUpdatesBatchFixture : public FibUpdatesFixture
+{
+public:
+  /** \brief Queue a registration without processing it.
+   */
+  void
+  beginRegister(const Name& name, uint64_t faceId, uint64_t cost)
+  {
+    rib::RibUpdate update;
+    update.setAction(rib::RibUpdate::REGISTER)
+          .setName(name)
+          .setRoute(createRoute(faceId, 0, cost, 0));
+
+    rib.beginApplyUpdate(update,
+                         [this] { ++nSucceeded; },
+                         [this] (uint32_t, const std::string&) { ++nFailed; });
+  }
+
+  /** \brief Process handlers until the first queued update has completed.
+   */
+  void
+  completeFirstUpdate()
+  {
+    if (g_io.stopped()) {
+      g_io.restart();
+    }
+    while (nSucceeded == 0 && g_io.poll_one() > 0) {
+    }
+  }
+
+  /** \brief Send FIB updates through an in-process channel that answers with \p code.
+   */
+  void
+  useInProcessFib(uint32_t code = 200)
+  {
+    fibUpdater.setInProcessFib([this, code] (auto batch, auto done) {
+      inProcessBatches.push_back(batch);
+      std::vector<ndn::nfd::ControlResponse> responses(batch.size(),
+                                                       ndn::nfd::ControlResponse(code, ""));
+      getGlobalIoService().post([=] { done(responses); });
+    });
+  }
+
+public:
+  size_t nSucceeded = 0;
+  size_t nFailed = 0;
+  std::vector<FibBatchParameters> inProcessBatches;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdates, FibUpdatesBatchFixture)
+BOOST_AUTO_TEST_SUITE(Batch)
+
+BOOST_AUTO_TEST_CASE(UnrelatedPrefixes)
+{
+  beginRegister("/a", 1, 10);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 1);
+
+  beginRegister("/b", 1, 10);
+  beginRegister("/c", 1, 10);
+  beginRegister("/b/x", 1, 10); // descendant of /b
+  beginRegister("/d", 2, 10); // different face
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 1);
+
+  // completing /a starts a batch with /b and /c
+  completeFirstUpdate();
+  BOOST_CHECK_EQUAL(nSucceeded, 1);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 3);
+
+  pollIo();
+  BOOST_CHECK_EQUAL(nSucceeded, 5);
+  BOOST_CHECK_EQUAL(nFailed, 0);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 5);
+  BOOST_CHECK_EQUAL(rib.size(), 5);
+  BOOST_CHECK(rib.find("/b/x") != rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(Coalesce)
+{
+  beginRegister("/a", 1, 10);
+  beginRegister("/b", 1, 10);
+  beginRegister("/b", 1, 20);
+  pollIo();
+
+  BOOST_CHECK_EQUAL(nSucceeded, 3);
+  BOOST_REQUIRE_EQUAL(getFibUpdates().size(), 2);
+  BOOST_CHECK_EQUAL(getFibUpdates().back().name, "/b");
+  BOOST_CHECK_EQUAL(getFibUpdates().back().cost, 20);
+
+  auto route = rib.find("/b", createRoute(1, 0, 0, 0));
+  BOOST_REQUIRE(route != nullptr);
+  BOOST_CHECK_EQUAL(route->cost, 20);
+}
+
+BOOST_AUTO_TEST_CASE(Window)
+{
+  const size_t nPrefixes = FibUpdater::MAX_UPDATES_IN_FLIGHT * 3;
+
+  beginRegister("/first", 1, 10);
+  for (size_t i = 0; i < nPrefixes; ++i) {
+    beginRegister(Name("/p").appendNumber(i), 1, 10);
+  }
+
+  completeFirstUpdate();
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 1 + FibUpdater::MAX_UPDATES_IN_FLIGHT);
+
+  pollIo();
+  BOOST_CHECK_EQUAL(nSucceeded, 1 + nPrefixes);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 1 + nPrefixes);
+  BOOST_CHECK_EQUAL(rib.size(), 1 + nPrefixes);
+}
+
+BOOST_AUTO_TEST_CASE(InProcess)
+{
+  useInProcessFib();
+  beginRegister("/a", 1, 10);
+  beginRegister("/b", 1, 10);
+  beginRegister("/c", 1, 10);
+  pollIo();
+
+  BOOST_CHECK_EQUAL(nSucceeded, 3);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 0);
+  BOOST_REQUIRE_EQUAL(inProcessBatches.size(), 2);
+  BOOST_CHECK_EQUAL(inProcessBatches[0].size(), 1);
+  BOOST_CHECK_EQUAL(inProcessBatches[1].size(), 2);
+  BOOST_CHECK(inProcessBatches[1].getOperations()[0].action == FibBatchParameters::Action::ADD_NEXTHOP);
+  BOOST_CHECK_EQUAL(inProcessBatches[1].getOperations()[0].parameters.getName(), "/b");
+  BOOST_CHECK_EQUAL(inProcessBatches[1].getOperations()[0].parameters.getFaceId(), 1);
+  BOOST_CHECK_EQUAL(inProcessBatches[1].getOperations()[0].parameters.getCost(), 10);
+  BOOST_CHECK_EQUAL(rib.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(InProcessFaceNotFound)
+{
+  useInProcessFib(410);
+  beginRegister("/a", 1, 10);
+  pollIo();
+
+  BOOST_CHECK_EQUAL(nSucceeded, 0);
+  BOOST_CHECK_EQUAL(nFailed, 1);
+  BOOST_CHECK_EQUAL(inProcessBatches.size(), 1);
+  BOOST_CHECK_EQUAL(rib.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Batch
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdates
+
+} // namespace nfd::tests
@@ -163,6 +163,105 @@ BOOST_AUTO_TEST_CASE(EraseRibEntry)
   BOOST_CHECK(ribEntry3->getParent() == ribEntry1);
 }
 
+BOOST_AUTO_TEST_CASE(FindChildren)
+{
+  rib::Rib rib;
+  rib.insert("/a", createRoute(1, 0));
+  rib.insert("/a/b/c", createRoute(1, 0));
+  rib.insert("/a/b/c/d", createRoute(1, 0));
+  rib.insert("/a/b/e", createRoute(1, 0));
+  rib.insert("/a/f", createRoute(1, 0));
+
+  auto names = [] (const rib::Rib::RibEntryList& entries) {
+    std::vector<Name> v;
+    for (const auto& entry : entries) {
+      v.push_back(entry->getName());
+    }
+    return v;
+  };
+
+  std::vector<Name> expected{"/a/b/c", "/a/b/e", "/a/f"};
+  BOOST_TEST(names(rib.findChildren("/a")) == expected, boost::test_tools::per_element());
+  expected = {"/a/b/c", "/a/b/e"};
+  BOOST_TEST(names(rib.findChildren("/a/b")) == expected, boost::test_tools::per_element());
+  expected = {"/a"};
+  BOOST_TEST(names(rib.findChildren("/")) == expected, boost::test_tools::per_element());
+  BOOST_CHECK(rib.findChildren("/x").empty());
+
+  rib.erase("/a/b/c", createRoute(1, 0));
+  expected = {"/a/b/c/d", "/a/b/e", "/a/f"};
+  BOOST_TEST(names(rib.findChildren("/a")) == expected, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(rib.findParent("/a/b/c/d")->getName(), "/a");
+
+  rib.erase("/a/b/c/d", createRoute(1, 0));
+  rib.erase("/a/b/e", createRoute(1, 0));
+  BOOST_CHECK(rib.findChildren("/a/b").empty());
+  BOOST_CHECK_EQUAL(rib.findParent("/a/b/x")->getName(), "/a");
+}
+
+BOOST_AUTO_TEST_CASE(InheritableRoutes)
+{
+  using ndn::nfd::ROUTE_FLAG_CHILD_INHERIT;
+  using ndn::nfd::ROUTE_FLAG_CAPTURE;
+
+  rib::Rib rib;
+  rib.insert("/", createRoute(1, 0, 10, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a", createRoute(2, 0, 20, ROUTE_FLAG_CHILD_INHERIT));
+  rib.insert("/a/b", createRoute(3, 0, 30));
+  rib.insert("/a/b/c", createRoute(4, 0, 40));
+
+  auto faceIds = [] (const rib::Rib::RouteSet& routes) {
+    std::vector<uint64_t> v;
+    for (const auto& route : routes) {
+      v.push_back(route.faceId);
+    }
+    return v;
+  };
+
+  std::vector<uint64_t> expected{1, 2};
+  BOOST_TEST(faceIds(rib.getAncestorRoutes("/a/b/c/d")) == expected, boost::test_tools::per_element());
+  BOOST_TEST(faceIds(rib.getAncestorRoutes(*rib.find("/a/b/c")->second)) == expected,
+             boost::test_tools::per_element());
+
+  // entries without child inherit routes share the routes of their parent
+  BOOST_CHECK(rib.find("/a/b")->second->getInheritableRoutes() ==
+              rib.find("/a")->second->getInheritableRoutes());
+  BOOST_CHECK(rib.find("/a/b/c")->second->getInheritableRoutes() ==
+              rib.find("/a")->second->getInheritableRoutes());
+
+  // a route of a closer ancestor overrides a route on the same face
+  rib.insert("/a/b", createRoute(1, 0, 5, ROUTE_FLAG_CHILD_INHERIT));
+  expected = {1, 2};
+  BOOST_TEST(faceIds(rib.getAncestorRoutes("/a/b/c/d")) == expected, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(rib.getAncestorRoutes("/a/b/c/d").begin()->cost, 5);
+
+  // capture blocks the routes of the ancestors
+  rib.insert("/a/b/c", createRoute(5, 0, 50, ROUTE_FLAG_CAPTURE));
+  BOOST_CHECK(rib.getAncestorRoutes("/a/b/c/d").empty());
+  rib.insert("/a/b/c/d", createRoute(6, 0, 60));
+  BOOST_CHECK(rib.getAncestorRoutes(*rib.find("/a/b/c/d")->second).empty());
+
+  rib.erase("/a/b/c", createRoute(5, 0));
+  BOOST_CHECK_EQUAL(rib.getAncestorRoutes(*rib.find("/a/b/c/d")->second).begin()->cost, 5);
+
+  // erasing an entry makes its children inherit from its parent
+  rib.erase("/a/b", createRoute(1, 0));
+  rib.erase("/a", createRoute(2, 0));
+  expected = {1};
+  BOOST_TEST(faceIds(rib.getAncestorRoutes(*rib.find("/a/b/c/d")->second)) == expected,
+             boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(rib.getAncestorRoutes(*rib.find("/a/b/c/d")->second).begin()->cost, 10);
+
+  // inserting an entry between an entry and its children
+  rib.insert("/a/b/c/x", createRoute(7, 0));
+  rib.insert("/a/b/c", createRoute(8, 0, 80, ROUTE_FLAG_CHILD_INHERIT | ROUTE_FLAG_CAPTURE));
+  expected = {8};
+  BOOST_TEST(faceIds(rib.getAncestorRoutes(*rib.find("/a/b/c/d")->second)) == expected,
+             boost::test_tools::per_element());
+  BOOST_TEST(faceIds(rib.getAncestorRoutes(*rib.find("/a/b/c/x")->second)) == expected,
+             boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(Basic)
 {
   rib::Rib rib;
@@ -58,6 +58,19 @@ BOOST_AUTO_TEST_CASE(FibEntry)
       BOOST_CHECK_EQUAL(&nextHop.getFace(), expectedFace);
       BOOST_CHECK_EQUAL(nextHop.getCost(), expectedCost);
     });
+  size_t nUpdateNextHopSignals = 0;
+  fib.afterUpdateNextHop.connect(
+    [&] (const Name& prefix1, const NextHop& nextHop) {
+      ++nUpdateNextHopSignals;
+      BOOST_CHECK_EQUAL(prefix1, prefix);
+      BOOST_CHECK_EQUAL(nextHop.getCost(), expectedCost);
+    });
+  std::vector<FaceId> removedNextHops;
+  fib.beforeRemoveNextHop.connect(
+    [&] (const Name& prefix1, const NextHop& nextHop) {
+      BOOST_CHECK_EQUAL(prefix1, prefix);
+      removedNextHops.push_back(nextHop.getFace().getId());
+    });
 
   Entry& entry = *fib.insert(prefix).first;
 
@@ -76,12 +89,18 @@ BOOST_AUTO_TEST_CASE(FibEntry)
   BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 20);
   BOOST_CHECK_EQUAL(nNewNextHopSignals, 1);
 
+  expectedCost = 30;
   fib.addOrUpdateNextHop(entry, *face1, 30);
   // [(face1,30)]
   BOOST_CHECK_EQUAL(entry.getNextHops().size(), 1);
   BOOST_CHECK_EQUAL(&entry.getNextHops().begin()->getFace(), face1.get());
   BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 30);
   BOOST_CHECK_EQUAL(nNewNextHopSignals, 1);
+  BOOST_CHECK_EQUAL(nUpdateNextHopSignals, 1);
+
+  fib.addOrUpdateNextHop(entry, *face1, 30);
+  // [(face1,30)]
+  BOOST_CHECK_EQUAL(nUpdateNextHopSignals, 1);
 
   expectedFace = face2.get();
   expectedCost = 40;
@@ -106,6 +125,7 @@ BOOST_AUTO_TEST_CASE(FibEntry)
     BOOST_CHECK_EQUAL(nNewNextHopSignals, 2);
   }
 
+  expectedCost = 10;
   fib.addOrUpdateNextHop(entry, *face2, 10);
   // [(face2,10), (face1,30)]
   BOOST_CHECK_EQUAL(entry.getNextHops().size(), 2);
@@ -124,6 +144,7 @@ BOOST_AUTO_TEST_CASE(FibEntry)
     BOOST_CHECK(it == entry.getNextHops().end());
 
     BOOST_CHECK_EQUAL(nNewNextHopSignals, 2);
+    BOOST_CHECK_EQUAL(nUpdateNextHopSignals, 2);
   }
 
   Fib::RemoveNextHopResult status = fib.removeNextHop(entry, *face1);
@@ -144,6 +165,9 @@ BOOST_AUTO_TEST_CASE(FibEntry)
   // []
   BOOST_CHECK(status == Fib::RemoveNextHopResult::FIB_ENTRY_REMOVED);
   BOOST_CHECK(fib.findExactMatch(prefix) == nullptr);
+  std::vector<FaceId> expectedRemoved{face1->getId(), face2->getId()};
+  BOOST_CHECK_EQUAL_COLLECTIONS(removedNextHops.begin(), removedNextHops.end(),
+                                expectedRemoved.begin(), expectedRemoved.end());
 }
 
 BOOST_AUTO_TEST_CASE(Insert_LongestPrefixMatch)
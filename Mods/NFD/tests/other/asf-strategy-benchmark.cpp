@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "face/null-face.hpp"
+#include "fw/asf-strategy.hpp"
+#include "fw/face-table.hpp"
+#include "fw/forwarder.hpp"
+
+#include <iostream>
+
+namespace nfd::tests {
+
+class AsfStrategyBenchmarkFixture
+{
+protected:
+  AsfStrategyBenchmarkFixture()
+    : m_forwarder(m_faceTable)
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    m_consumer = face::makeNullFace();
+    m_faceTable.add(m_consumer);
+
+    m_forwarder.getStrategyChoice().insert(PREFIX, fw::AsfStrategy::getStrategyName());
+    m_strategy = &m_forwarder.getStrategyChoice().findEffectiveStrategy(PREFIX);
+  }
+
+  /** \brief Register \p nNextHops upstream faces, each of which has answered one Interest.
+   */
+  void
+  addNextHops(size_t nNextHops)
+  {
+    fib::Entry& fibEntry = *m_forwarder.getFib().insert(PREFIX).first;
+    for (size_t i = 0; i < nNextHops; ++i) {
+      auto face = face::makeNullFace();
+      m_faceTable.add(face);
+
+      // make the face the only next hop, so that ASF creates its measurements
+      m_forwarder.getFib().addOrUpdateNextHop(fibEntry, *face, 0);
+      if (!m_upstreams.empty()) {
+        m_forwarder.getFib().removeNextHop(fibEntry, *m_upstreams.back());
+      }
+      expressAndSatisfy(Name(PREFIX).append("warmup").appendNumber(i));
+      m_upstreams.push_back(face);
+    }
+
+    for (size_t i = 0; i < m_upstreams.size(); ++i) {
+      m_forwarder.getFib().addOrUpdateNextHop(fibEntry, *m_upstreams[i], i % 4);
+    }
+  }
+
+  /** \brief Pass an Interest to the strategy, then answer it on the chosen upstream.
+   */
+  void
+  expressAndSatisfy(const Name& name)
+  {
+    auto interest = make_shared<Interest>(name);
+    interest->setCanBePrefix(false);
+    auto pitEntry = m_forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*m_consumer, *interest);
+
+    m_strategy->afterReceiveInterest(*interest, FaceEndpoint(*m_consumer), pitEntry);
+    BOOST_ASSERT(pitEntry->hasOutRecords());
+
+    Data data(name);
+    Face& upstream = pitEntry->getOutRecords().front().getFace();
+    m_strategy->beforeSatisfyInterest(data, FaceEndpoint(upstream), pitEntry);
+    m_forwarder.getPit().erase(pitEntry.get());
+  }
+
+protected:
+  static inline const Name PREFIX{"/bench"};
+
+  FaceTable m_faceTable;
+  Forwarder m_forwarder;
+  fw::Strategy* m_strategy = nullptr;
+  shared_ptr<Face> m_consumer;
+  std::vector<shared_ptr<Face>> m_upstreams;
+};
+
+BOOST_FIXTURE_TEST_CASE(Forward64NextHops, AsfStrategyBenchmarkFixture)
+{
+  constexpr size_t N_NEXTHOPS = 64;
+  constexpr size_t N_INTERESTS = 100000;
+
+  addNextHops(N_NEXTHOPS);
+
+  std::vector<Name> names;
+  names.reserve(N_INTERESTS);
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    names.push_back(Name(PREFIX).appendNumber(i));
+  }
+
+  auto t1 = time::steady_clock::now();
+  for (const auto& name : names) {
+    expressAndSatisfy(name);
+  }
+  auto t2 = time::steady_clock::now();
+
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Time elapsed: " << time::duration_cast<time::microseconds>(elapsed) << "\n"
+            << "Per Interest with " << N_NEXTHOPS << " next hops: "
+            << elapsed.count() / N_INTERESTS << " ns" << std::endl;
+}
+
+} // namespace nfd::tests
@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/common.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+namespace {
+
+std::atomic<size_t> g_nAllocations{0};
+
+} // namespace
+
+// count every heap allocation made by the process, including those made inside ndn-cxx
+void*
+operator new(std::size_t size)
+{
+  ++g_nAllocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size); p != nullptr) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace nfd::tests {
+
+class EncodingBenchmarkFixture
+{
+protected:
+  EncodingBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  /** \brief Run \p f for each of N_PACKETS packets, and print the time and the number of heap
+   *         allocations made by \p f per packet.
+   */
+  static void
+  measure(const std::string& label, const std::function<void(size_t)>& prepare,
+          const std::function<void(size_t)>& f)
+  {
+    time::nanoseconds elapsed = 0_ns;
+    size_t nAllocations = 0;
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      prepare(i);
+      size_t a1 = g_nAllocations;
+      auto t1 = time::steady_clock::now();
+      f(i);
+      auto t2 = time::steady_clock::now();
+      nAllocations += g_nAllocations - a1;
+      elapsed += t2 - t1;
+    }
+    std::cout << label << " " << N_PACKETS << ": " << elapsed.count() / N_PACKETS << " ns, "
+              << static_cast<double>(nAllocations) / N_PACKETS << " allocations per packet"
+              << std::endl;
+  }
+
+protected:
+  static constexpr size_t N_PACKETS = 100000;
+};
+
+BOOST_FIXTURE_TEST_CASE(EncodeData, EncodingBenchmarkFixture)
+{
+  const std::vector<uint8_t> content(1000, 0xBB);
+  const auto signature = std::make_shared<ndn::Buffer>(32);
+  std::optional<Data> data;
+
+  measure("encode-data", [&] (size_t i) {
+    data.emplace(Name("/benchmark/encoding/data").appendSequenceNumber(i));
+    data->setContent(content);
+    data->setFreshnessPeriod(1_s);
+    data->setSignatureInfo(ndn::SignatureInfo(tlv::DigestSha256));
+    data->setSignatureValue(signature);
+  }, [&] (size_t) {
+    data->wireEncode();
+  });
+  BOOST_CHECK_EQUAL(data->wireEncode().type(), tlv::Data);
+}
+
+BOOST_FIXTURE_TEST_CASE(EncodeInterest, EncodingBenchmarkFixture)
+{
+  std::optional<Interest> interest;
+
+  measure("encode-interest", [&] (size_t i) {
+    interest.emplace(Name("/benchmark/encoding/interest").appendSequenceNumber(i));
+    interest->setCanBePrefix(false);
+    interest->setNonce(static_cast<uint32_t>(i));
+    interest->setInterestLifetime(4_s);
+  }, [&] (size_t) {
+    interest->wireEncode();
+  });
+  BOOST_CHECK_EQUAL(interest->wireEncode().type(), tlv::Interest);
+}
+
+BOOST_FIXTURE_TEST_CASE(EncodeName, EncodingBenchmarkFixture)
+{
+  std::optional<Name> name;
+
+  measure("encode-name", [&] (size_t i) {
+    name.emplace("/benchmark/encoding/name/with/several/components");
+    name->appendSequenceNumber(i);
+  }, [&] (size_t) {
+    name->wireEncode();
+  });
+}
+
+// copy of a received packet into its own Block, as done by the transports
+BOOST_FIXTURE_TEST_CASE(CopyReceivedPacket, EncodingBenchmarkFixture)
+{
+  Data data("/benchmark/encoding/received");
+  data.setContent(std::vector<uint8_t>(1000, 0xBB));
+  data.setSignatureInfo(ndn::SignatureInfo(tlv::DigestSha256));
+  data.setSignatureValue(std::make_shared<ndn::Buffer>(32));
+  const Block wire = data.wireEncode();
+  Block block;
+
+  measure("copy-received", [&] (size_t) {
+    block = {};
+  }, [&] (size_t) {
+    std::tie(std::ignore, block) = Block::fromBuffer(wire);
+  });
+  BOOST_CHECK_EQUAL(block.size(), wire.size());
+}
+
+} // namespace nfd::tests
@@ -27,13 +27,21 @@
 #include "face/face.hpp"
 #include "face/tcp-channel.hpp"
 #include "face/udp-channel.hpp"
+#ifdef NFD_HAVE_LIBPCAP
+#include "face/ethernet-channel.hpp"
+#endif
+
+#include <ndn-cxx/net/network-monitor.hpp>
 
 #include <boost/asio/signal_set.hpp>
 #include <boost/exception/diagnostic_information.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/range/adaptor/map.hpp>
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #ifdef NFD_HAVE_VALGRIND
 #include <valgrind/callgrind.h>
@@ -44,8 +52,7 @@ namespace nfd::tests {
 class FaceBenchmark
 {
 public:
-  explicit
-  FaceBenchmark(const char* configFileName)
+  FaceBenchmark(const char* configFileName, bool wantPacketRing)
     : m_terminationSignalSet{getGlobalIoService(), SIGINT, SIGTERM}
     , m_tcpChannel{tcp::Endpoint{boost::asio::ip::tcp::v4(), 6363}, false,
                    [] (auto&&...) { return ndn::nfd::FACE_SCOPE_NON_LOCAL; }}
@@ -65,26 +72,62 @@ public:
     m_udpChannel.listen(std::bind(&FaceBenchmark::onLeftFaceCreated, this, _1),
                         std::bind(&FaceBenchmark::onFaceCreationFailed, _1, _2));
     std::clog << "Listening on " << m_udpChannel.getUri() << std::endl;
+
+    if (!m_etherDevs.empty()) {
+      m_netmon = make_unique<ndn::net::NetworkMonitor>(getGlobalIoService());
+      m_netmon->onEnumerationCompleted.connect([this, wantPacketRing] {
+        this->createEthernetChannels(wantPacketRing);
+      });
+    }
   }
 
 private:
+  static bool
+  isSupportedScheme(const std::string& scheme)
+  {
+#ifdef NFD_HAVE_LIBPCAP
+    if (scheme == "ether")
+      return true;
+#endif
+    return scheme == "tcp4" || scheme == "udp4";
+  }
+
   void
   parseConfig(const char* configFileName)
   {
     std::ifstream file{configFileName};
-    std::string uriStrL;
-    std::string uriStrR;
+    std::string line;
 
-    while (file >> uriStrL >> uriStrR) {
-      FaceUri uriL{uriStrL};
-      FaceUri uriR{uriStrR};
+    while (std::getline(file, line)) {
+      // each ether:// FaceUri is followed by the dev:// FaceUri of the local interface
+      std::istringstream is{line};
+      std::vector<FaceUri> uris;
+      std::string token;
+      while (is >> token) {
+        FaceUri uri{token};
+        if (uri.getScheme() == "dev" && !uris.empty() && uris.back().getScheme() == "ether") {
+          m_etherDevs[uris.back().toString()] = uri.getHost();
+        }
+        else {
+          uris.push_back(std::move(uri));
+        }
+      }
+      if (uris.size() != 2) {
+        continue;
+      }
 
-      if (uriL.getScheme() != "tcp4" && uriL.getScheme() != "udp4") {
+      const auto& uriL = uris.front();
+      const auto& uriR = uris.back();
+      if (!isSupportedScheme(uriL.getScheme())) {
         std::clog << "Unsupported protocol '" << uriL.getScheme() << "'" << std::endl;
       }
-      else if (uriR.getScheme() != "tcp4" && uriR.getScheme() != "udp4") {
+      else if (!isSupportedScheme(uriR.getScheme())) {
         std::clog << "Unsupported protocol '" << uriR.getScheme() << "'" << std::endl;
       }
+      else if ((uriL.getScheme() == "ether" && m_etherDevs.count(uriL.toString()) == 0) ||
+               (uriR.getScheme() == "ether" && m_etherDevs.count(uriR.toString()) == 0)) {
+        std::clog << "Missing local dev:// FaceUri for ether:// FaceUri" << std::endl;
+      }
       else {
         m_faceUris.emplace_back(uriL, uriR);
       }
@@ -95,6 +138,29 @@ private:
     }
   }
 
+  void
+  createEthernetChannels(bool wantPacketRing)
+  {
+#ifdef NFD_HAVE_LIBPCAP
+    auto ioMode = wantPacketRing ? face::EthernetIoMode::PACKET_RING : face::EthernetIoMode::PCAP;
+    for (const auto& dev : m_etherDevs | boost::adaptors::map_values) {
+      if (m_etherChannels.count(dev) > 0) {
+        continue;
+      }
+      auto netif = m_netmon->getNetworkInterface(dev);
+      if (netif == nullptr) {
+        NDN_THROW(std::runtime_error("Network interface '" + dev + "' not found"));
+      }
+
+      auto channel = std::make_shared<face::EthernetChannel>(netif, 10_min, ioMode);
+      channel->listen(std::bind(&FaceBenchmark::onLeftFaceCreated, this, _1),
+                      std::bind(&FaceBenchmark::onFaceCreationFailed, _1, _2));
+      std::clog << "Listening on " << channel->getUri() << " (" << ioMode << ")" << std::endl;
+      m_etherChannels[dev] = std::move(channel);
+    }
+#endif
+  }
+
   void
   onLeftFaceCreated(const shared_ptr<Face>& faceL)
   {
@@ -121,6 +187,16 @@ private:
     }
 
     // create the right face
+#ifdef NFD_HAVE_LIBPCAP
+    if (uriR.getScheme() == "ether") {
+      auto& channel = m_etherChannels.at(m_etherDevs.at(uriR.toString()));
+      channel->connect(ethernet::Address::fromString(uriR.getHost()), {},
+                       std::bind(&FaceBenchmark::onRightFaceCreated, faceL, _1),
+                       std::bind(&FaceBenchmark::onFaceCreationFailed, _1, _2));
+      return;
+    }
+#endif
+
     auto addr = boost::asio::ip::address::from_string(uriR.getHost());
     auto port = boost::lexical_cast<uint16_t>(uriR.getPort());
     if (uriR.getScheme() == "tcp4") {
@@ -170,6 +246,11 @@ private:
   face::TcpChannel m_tcpChannel;
   face::UdpChannel m_udpChannel;
   std::vector<std::pair<FaceUri, FaceUri>> m_faceUris;
+  std::map<std::string, std::string> m_etherDevs; ///< ether:// FaceUri => local ifname
+  unique_ptr<ndn::net::NetworkMonitor> m_netmon;
+#ifdef NFD_HAVE_LIBPCAP
+  std::map<std::string, shared_ptr<face::EthernetChannel>> m_etherChannels; ///< ifname => channel
+#endif
 };
 
 } // namespace nfd::tests
@@ -181,13 +262,14 @@ main(int argc, char** argv)
   std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
 #endif
 
-  if (argc != 2) {
-    std::cerr << "Usage: " << argv[0] << " <config-file>" << std::endl;
+  bool wantPacketRing = argc == 3 && std::strcmp(argv[1], "--packet-ring") == 0;
+  if (argc != 2 && !wantPacketRing) {
+    std::cerr << "Usage: " << argv[0] << " [--packet-ring] <config-file>" << std::endl;
     return 2;
   }
 
   try {
-    nfd::tests::FaceBenchmark bench{argv[1]};
+    nfd::tests::FaceBenchmark bench{argv[argc - 1], wantPacketRing};
 #ifdef NFD_HAVE_VALGRIND
     CALLGRIND_START_INSTRUMENTATION;
 #endif
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/common.hpp"
+
+#include <ndn-cxx/ims/in-memory-storage-lru.hpp>
+#include <ndn-cxx/ims/in-memory-storage-sharded.hpp>
+
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace nfd::tests {
+
+class ImsBenchmarkFixture
+{
+protected:
+  ImsBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    packets.reserve(N_PACKETS);
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      auto data = std::make_shared<Data>(Name("/ims/benchmark").appendSequenceNumber(i));
+      data->setContent(std::vector<uint8_t>(PAYLOAD_SIZE, 0xBB));
+      data->setSignatureInfo(ndn::SignatureInfo(tlv::NullSignature));
+      data->setSignatureValue(std::make_shared<ndn::Buffer>());
+      data->wireEncode();
+      packets.push_back(std::move(data));
+    }
+  }
+
+  /** \brief Runs \p nThreads threads that each look up LOOKUPS_PER_THREAD random packets
+   *         with \p find, and reports the aggregate throughput.
+   */
+  template<typename Find>
+  void
+  run(const std::string& label, size_t nThreads, const Find& find)
+  {
+    // Interests are prepared beforehand, so that only the lookups are measured
+    std::vector<std::vector<Interest>> interests(nThreads);
+    for (size_t t = 0; t < nThreads; ++t) {
+      std::mt19937 rng(t);
+      std::uniform_int_distribution<size_t> dist(0, N_PACKETS - 1);
+      interests[t].reserve(LOOKUPS_PER_THREAD);
+      for (size_t i = 0; i < LOOKUPS_PER_THREAD; ++i) {
+        interests[t].emplace_back(packets[dist(rng)]->getName());
+        interests[t].back().wireEncode();
+      }
+    }
+
+    std::atomic<size_t> nFound{0};
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads);
+    auto t1 = time::steady_clock::now();
+    for (size_t t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t] {
+        size_t n = 0;
+        for (const auto& interest : interests[t]) {
+          n += find(interest) != nullptr;
+        }
+        nFound += n;
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    auto t2 = time::steady_clock::now();
+
+    size_t nLookups = nThreads * LOOKUPS_PER_THREAD;
+    BOOST_CHECK_EQUAL(nFound, nLookups);
+    auto elapsed = time::duration_cast<time::microseconds>(t2 - t1);
+    std::cout << label << " threads=" << nThreads << ": " << elapsed << ", "
+              << static_cast<uint64_t>(nLookups * 1000000.0 / elapsed.count()) << " lookups/s"
+              << std::endl;
+  }
+
+protected:
+  static constexpr size_t N_PACKETS = 100000;
+  static constexpr size_t PAYLOAD_SIZE = 100;
+  static constexpr size_t LOOKUPS_PER_THREAD = 200000;
+  static constexpr size_t BYTE_LIMIT = 64 * 1024 * 1024;
+  static constexpr size_t N_SHARDS = 64;
+  static constexpr std::array<size_t, 6> THREAD_COUNTS{1, 2, 4, 8, 16, 32};
+
+  std::vector<shared_ptr<Data>> packets;
+};
+
+// baseline: a single LRU storage behind one mutex, as a multi-threaded producer would use it
+BOOST_FIXTURE_TEST_CASE(SingleMutex, ImsBenchmarkFixture)
+{
+  ndn::InMemoryStorageLru ims(std::numeric_limits<size_t>::max());
+  ims.setByteLimit(BYTE_LIMIT);
+  for (const auto& data : packets) {
+    ims.insert(*data);
+  }
+  BOOST_REQUIRE_EQUAL(ims.size(), N_PACKETS);
+
+  std::mutex mutex;
+  for (size_t nThreads : THREAD_COUNTS) {
+    run("single-mutex", nThreads, [&] (const Interest& interest) {
+      std::lock_guard<std::mutex> lock(mutex);
+      return ims.find(interest);
+    });
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(Sharded, ImsBenchmarkFixture)
+{
+  ndn::InMemoryStorageSharded ims(N_SHARDS, BYTE_LIMIT);
+  for (const auto& data : packets) {
+    ims.insert(*data);
+  }
+  BOOST_REQUIRE_EQUAL(ims.size(), N_PACKETS);
+
+  for (size_t nThreads : THREAD_COUNTS) {
+    run("sharded", nThreads, [&] (const Interest& interest) {
+      return ims.find(interest);
+    });
+  }
+}
+
+} // namespace nfd::tests
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_CASE(DispatchWith10kFilters)
+{
+  constexpr size_t N_FILTERS = 10000;
+  constexpr size_t N_REGEX_FILTERS = 100;
+  constexpr size_t N_INTERESTS = 100000;
+
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+  ndn::DummyClientFace face;
+  size_t nMatches = 0;
+  auto onInterest = [&nMatches] (const auto&, const auto&) { ++nMatches; };
+
+  // one filter per tenant, and a few tenants that accept only some of their Interests
+  for (size_t i = 0; i < N_FILTERS; ++i) {
+    face.setInterestFilter(Name("/tenant").appendNumber(i), onInterest);
+  }
+  for (size_t i = 0; i < N_REGEX_FILTERS; ++i) {
+    face.setInterestFilter(ndn::InterestFilter(Name("/tenant").appendNumber(i), "<video><>*"),
+                           onInterest);
+  }
+  face.getIoService().poll();
+
+  std::vector<Interest> interests;
+  interests.reserve(N_INTERESTS);
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    Name name = Name("/tenant").appendNumber(i % (N_FILTERS + N_FILTERS / 10));
+    name.append(i % 2 == 0 ? "video" : "audio").appendNumber(i);
+    interests.emplace_back(name);
+  }
+
+  auto t1 = time::steady_clock::now();
+  for (const auto& interest : interests) {
+    face.receive(interest);
+  }
+  face.getIoService().poll();
+  auto t2 = time::steady_clock::now();
+
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Time elapsed: " << time::duration_cast<time::microseconds>(elapsed) << "\n"
+            << "Per Interest with " << N_FILTERS << " filters: "
+            << elapsed.count() / N_INTERESTS << " ns\n"
+            << "Interest callbacks invoked: " << nMatches << std::endl;
+}
+
+} // namespace nfd::tests
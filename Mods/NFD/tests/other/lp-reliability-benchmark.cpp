@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "face/generic-link-service.hpp"
+#include "face/lp-reliability.hpp"
+
+#include <ctime>
+#include <iostream>
+
+#ifdef NFD_HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd::tests {
+
+using face::GenericLinkService;
+using face::LpReliability;
+
+class LpReliabilityBenchmarkFixture
+{
+protected:
+  LpReliabilityBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    LpReliability::Options options;
+    options.isEnabled = true;
+    reliability = make_unique<LpReliability>(options, &linkService);
+  }
+
+  /** \brief Run \p f and print its wall-clock and CPU time, and the resulting throughput.
+   */
+  static void
+  timedRun(const std::string& label, size_t nOps, const std::function<void()>& f)
+  {
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    std::clock_t c1 = std::clock();
+    f();
+    std::clock_t c2 = std::clock();
+    auto t2 = time::steady_clock::now();
+
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    auto wall = time::duration_cast<time::microseconds>(t2 - t1);
+    double cpuUs = 1e6 * (c2 - c1) / CLOCKS_PER_SEC;
+    std::cout << label << " " << nOps << ": " << wall << ", cpu " << cpuUs << " microseconds, "
+              << (nOps * 1e6 / std::max<time::microseconds::rep>(wall.count(), 1)) << " ops/s"
+              << std::endl;
+  }
+
+  static lp::Packet
+  makeFrag(lp::Sequence seq)
+  {
+    static const Block payload = ndn::makeStringBlock(tlv::Content, std::string(1000, 'x'));
+    lp::Packet pkt;
+    pkt.add<lp::FragmentField>({payload.begin(), payload.end()});
+    pkt.add<lp::SequenceField>(seq);
+    return pkt;
+  }
+
+  /** \brief Send one single-fragment network packet.
+   */
+  void
+  send(lp::Sequence seq)
+  {
+    std::vector<lp::Packet> frags{makeFrag(seq)};
+    reliability->handleOutgoing(frags, lp::Packet(frags.front()), false);
+  }
+
+  static lp::Packet
+  makeAck(lp::Sequence txSeq)
+  {
+    lp::Packet pkt;
+    pkt.add<lp::AckField>(txSeq);
+    return pkt;
+  }
+
+protected:
+  static constexpr size_t N_IN_FLIGHT = 10000;
+  static constexpr size_t N_PACKETS = 500000;
+
+  GenericLinkService linkService;
+  unique_ptr<LpReliability> reliability;
+};
+
+// steady state with N_IN_FLIGHT unacknowledged fragments: each Ack for the oldest fragment
+// is followed by the transmission of a new fragment
+BOOST_FIXTURE_TEST_CASE(SendAckInOrder, LpReliabilityBenchmarkFixture)
+{
+  for (size_t i = 0; i < N_IN_FLIGHT; ++i) {
+    send(i);
+  }
+
+  // Acks are prepared in advance, as TxSequences are assigned consecutively starting at 0
+  std::vector<lp::Packet> acks;
+  acks.reserve(N_PACKETS);
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    acks.push_back(makeAck(i));
+  }
+
+  timedRun("send-ack(in-order)", N_PACKETS, [&] {
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      reliability->processIncomingPacket(acks[i]);
+      send(N_IN_FLIGHT + i);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), N_IN_FLIGHT);
+}
+
+// same as SendAckInOrder, except that the Acks of each pair of consecutive fragments are swapped
+BOOST_FIXTURE_TEST_CASE(SendAckReordered, LpReliabilityBenchmarkFixture)
+{
+  for (size_t i = 0; i < N_IN_FLIGHT; ++i) {
+    send(i);
+  }
+
+  std::vector<lp::Packet> acks;
+  acks.reserve(N_PACKETS);
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    acks.push_back(makeAck(i ^ 1));
+  }
+
+  timedRun("send-ack(reordered)", N_PACKETS, [&] {
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      reliability->processIncomingPacket(acks[i]);
+      send(N_IN_FLIGHT + i);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), N_IN_FLIGHT);
+}
+
+// receive N_PACKETS fragments, and piggyback the queued Acks onto outgoing packets
+BOOST_FIXTURE_TEST_CASE(ReceivePiggyback, LpReliabilityBenchmarkFixture)
+{
+  std::vector<lp::Packet> frags;
+  frags.reserve(N_PACKETS);
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    frags.push_back(makeFrag(i));
+    frags.back().add<lp::TxSequenceField>(i);
+  }
+
+  timedRun("receive-piggyback", N_PACKETS, [&] {
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      reliability->processIncomingPacket(frags[i]);
+      if (i % 100 == 99) {
+        lp::Packet pkt;
+        reliability->piggyback(pkt, 1500);
+      }
+    }
+  });
+}
+
+} // namespace nfd::tests
@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "rib/fib-updater.hpp"
+#include "rib/rib.hpp"
+#include "common/global.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <iostream>
+
+namespace nfd::tests {
+
+using rib::FibUpdate;
+using rib::FibUpdater;
+using rib::Rib;
+using rib::RibUpdate;
+using rib::Route;
+
+/** \brief FibUpdater that completes each FIB command after a fixed delay,
+ *         as if NFD answered it after a round trip.
+ */
+class DelayedFibUpdater : public FibUpdater
+{
+public:
+  using FibUpdater::FibUpdater;
+
+private:
+  void
+  sendAddNextHopUpdate(const FibUpdate& update,
+                       const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure,
+                       uint32_t) override
+  {
+    respond(update, onSuccess, onFailure);
+  }
+
+  void
+  sendRemoveNextHopUpdate(const FibUpdate& update,
+                          const FibUpdateSuccessCallback& onSuccess,
+                          const FibUpdateFailureCallback& onFailure,
+                          uint32_t) override
+  {
+    respond(update, onSuccess, onFailure);
+  }
+
+  void
+  respond(const FibUpdate& update,
+          const FibUpdateSuccessCallback& onSuccess,
+          const FibUpdateFailureCallback& onFailure)
+  {
+    ++nCommands;
+    getScheduler().schedule(COMMAND_RTT, [=] { onUpdateSuccess(update, onSuccess, onFailure); });
+  }
+
+public:
+  static constexpr time::microseconds COMMAND_RTT = 200_us;
+  size_t nCommands = 0;
+};
+
+class RibBenchmarkFixture
+{
+protected:
+  RibBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  /** \brief Queue one update per prefix, as a routing daemon does after convergence,
+   *         and print the time until the FIB is consistent with the RIB.
+   */
+  void
+  applyUpdates(const std::string& label, RibUpdate::Action action)
+  {
+    Route route;
+    route.faceId = 1;
+    route.origin = ndn::nfd::ROUTE_ORIGIN_NLSR;
+    route.cost = 10;
+
+    size_t nSucceeded = 0;
+    size_t nCommandsBefore = fibUpdater.nCommands;
+
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < N_PREFIXES; ++i) {
+      RibUpdate update;
+      update.setAction(action)
+            .setName(Name("/bench").appendNumber(i))
+            .setRoute(route);
+      rib.beginApplyUpdate(update, [&] { ++nSucceeded; }, nullptr);
+    }
+    getGlobalIoService().run();
+    getGlobalIoService().restart();
+    auto t2 = time::steady_clock::now();
+
+    std::cout << label << " " << N_PREFIXES << " prefixes: "
+              << time::duration_cast<time::milliseconds>(t2 - t1) << " until FIB is consistent, "
+              << (fibUpdater.nCommands - nCommandsBefore) << " FIB commands with "
+              << DelayedFibUpdater::COMMAND_RTT << " RTT" << std::endl;
+
+    BOOST_CHECK_EQUAL(nSucceeded, N_PREFIXES);
+  }
+
+protected:
+  static constexpr size_t N_PREFIXES = 100000;
+
+  ndn::KeyChain keyChain{"pib-memory:", "tpm-memory:"};
+  ndn::DummyClientFace face{getGlobalIoService(), keyChain};
+  ndn::nfd::Controller controller{face, keyChain};
+  Rib rib;
+  DelayedFibUpdater fibUpdater{rib, controller};
+};
+
+BOOST_FIXTURE_TEST_CASE(RegisterUnregister, RibBenchmarkFixture)
+{
+  applyUpdates("register", RibUpdate::REGISTER);
+  BOOST_CHECK_EQUAL(rib.size(), N_PREFIXES);
+
+  applyUpdates("unregister", RibUpdate::UNREGISTER);
+  BOOST_CHECK_EQUAL(rib.size(), 0);
+}
+
+} // namespace nfd::tests
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+#include <random>
+
+namespace nfd::tests {
+
+using ndn::scheduler::EventId;
+using ndn::scheduler::ScopedEventId;
+using Backend = ndn::Scheduler::Backend;
+
+class SchedulerBenchmarkFixture
+{
+protected:
+  SchedulerBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 999);
+    delays.reserve(N_TIMERS);
+    for (size_t i = 0; i < N_TIMERS; ++i) {
+      delays.push_back(time::milliseconds(dist(rng)));
+    }
+  }
+
+  static const char*
+  toString(Backend backend)
+  {
+    return backend == Backend::ORDERED_SET ? "ordered-set" : "timing-wheel";
+  }
+
+  static void
+  report(Backend backend, const std::string& label, size_t nOps,
+         time::steady_clock::time_point t1, time::steady_clock::time_point t2)
+  {
+    auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+    std::cout << toString(backend) << " " << label << " " << nOps << ": "
+              << time::duration_cast<time::microseconds>(elapsed) << ", "
+              << elapsed.count() / nOps << " ns/op" << std::endl;
+  }
+
+protected:
+  static constexpr size_t N_TIMERS = 1000000;
+
+  boost::asio::io_service io;
+  std::vector<time::nanoseconds> delays;
+};
+
+// 1M concurrent timers with delays below one second, all of which expire
+BOOST_FIXTURE_TEST_CASE(ScheduleAndExpire, SchedulerBenchmarkFixture)
+{
+  for (auto backend : {Backend::ORDERED_SET, Backend::TIMING_WHEEL}) {
+    ndn::Scheduler scheduler(io, backend);
+    size_t nExpired = 0;
+
+    auto t1 = time::steady_clock::now();
+    for (auto delay : delays) {
+      scheduler.schedule(delay, [&nExpired] { ++nExpired; });
+    }
+    auto t2 = time::steady_clock::now();
+    report(backend, "schedule", N_TIMERS, t1, t2);
+
+    io.restart();
+    io.run();
+    BOOST_CHECK_EQUAL(nExpired, N_TIMERS);
+  }
+}
+
+// 1M concurrent timers, like PIT entry timers: each Data satisfies the oldest pending Interest,
+// whose timer is canceled, and a new Interest schedules another timer
+BOOST_FIXTURE_TEST_CASE(CancelHeavy, SchedulerBenchmarkFixture)
+{
+  for (auto backend : {Backend::ORDERED_SET, Backend::TIMING_WHEEL}) {
+    ndn::Scheduler scheduler(io, backend);
+    std::vector<ScopedEventId> timers(N_TIMERS);
+    size_t nExpired = 0;
+    auto onExpire = [&nExpired] { ++nExpired; };
+
+    for (size_t i = 0; i < N_TIMERS; ++i) {
+      timers[i] = scheduler.schedule(4_s + delays[i], onExpire);
+    }
+
+    auto t1 = time::steady_clock::now();
+    for (size_t i = 0; i < N_TIMERS; ++i) {
+      timers[i] = scheduler.schedule(4_s + delays[i], onExpire);
+    }
+    auto t2 = time::steady_clock::now();
+    report(backend, "cancel+schedule", N_TIMERS, t1, t2);
+
+    t1 = time::steady_clock::now();
+    timers.clear();
+    t2 = time::steady_clock::now();
+    report(backend, "cancel", N_TIMERS, t1, t2);
+
+    io.restart();
+    io.poll();
+    BOOST_CHECK_EQUAL(nExpired, 0);
+  }
+}
+
+} // namespace nfd::tests
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2023,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "common/global.hpp"
+#include "face/null-link-service.hpp"
+#include "face/null-transport.hpp"
+#include "fw/face-table.hpp"
+#include "fw/forwarder.hpp"
+#include "fw/self-learning-strategy.hpp"
+
+#include <ndn-cxx/lp/prefix-announcement-header.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+
+#include <iostream>
+
+namespace nfd::tests {
+
+class SelfLearningBenchmarkFixture
+{
+protected:
+  SelfLearningBenchmarkFixture()
+    : m_forwarder(m_faceTable)
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    setMainIoService(&getGlobalIoService());
+    setRibIoService(&m_ribIo);
+
+    m_consumer = addFace();
+    m_forwarder.getStrategyChoice().insert("/", fw::SelfLearningStrategy::getStrategyName());
+    m_strategy = &m_forwarder.getStrategyChoice().findEffectiveStrategy("/");
+  }
+
+  ~SelfLearningBenchmarkFixture()
+  {
+    setMainIoService(nullptr);
+    setRibIoService(nullptr);
+  }
+
+  shared_ptr<Face>
+  addFace()
+  {
+    auto face = make_shared<Face>(make_unique<face::NullLinkService>(),
+                                  make_unique<face::NullTransport>());
+    m_faceTable.add(face);
+    return face;
+  }
+
+  /** \brief Pass a discovery Interest from the consumer to the strategy.
+   */
+  shared_ptr<pit::Entry>
+  expressDiscovery(const Name& name)
+  {
+    auto interest = make_shared<Interest>(name);
+    auto pitEntry = m_forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*m_consumer, *interest);
+    m_strategy->afterReceiveInterest(*interest, FaceEndpoint(*m_consumer), pitEntry);
+    return pitEntry;
+  }
+
+  /** \brief Run the closures posted to the RIB thread, and return how many there were.
+   *
+   *  The RIB service is not instantiated in this benchmark, hence each closure ends with
+   *  an exception once it tries to reach the RibManager.
+   */
+  size_t
+  drainRibIoService()
+  {
+    size_t nClosures = 0;
+    while (true) {
+      try {
+        if (m_ribIo.poll_one() == 0) {
+          break;
+        }
+      }
+      catch (const std::logic_error&) {
+      }
+      ++nClosures;
+    }
+    m_ribIo.restart();
+    return nClosures;
+  }
+
+protected:
+  FaceTable m_faceTable;
+  Forwarder m_forwarder;
+  boost::asio::io_service m_ribIo;
+  fw::Strategy* m_strategy = nullptr;
+  shared_ptr<Face> m_consumer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SelfLearning, SelfLearningBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(BroadcastTo10kFaces)
+{
+  constexpr size_t N_FACES = 10000;
+  // each Interest creates one out-record per face, which dominates the running time
+  constexpr size_t N_INTERESTS = 10;
+
+  for (size_t i = 0; i < N_FACES; ++i) {
+    addFace();
+  }
+
+  auto t1 = time::steady_clock::now();
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    auto pitEntry = expressDiscovery(Name("/bench").appendNumber(i));
+    BOOST_ASSERT(pitEntry->getOutRecords().size() == N_FACES);
+    m_forwarder.getPit().erase(pitEntry.get());
+  }
+  auto t2 = time::steady_clock::now();
+
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Time elapsed: " << time::duration_cast<time::microseconds>(elapsed) << "\n"
+            << "Per discovery Interest to " << N_FACES << " faces: "
+            << elapsed.count() / N_INTERESTS << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(LocalhopFrom10kFaces)
+{
+  constexpr size_t N_FACES = 10000;
+  constexpr size_t N_INTERESTS = 100000;
+
+  for (size_t i = 0; i < N_FACES; ++i) {
+    addFace();
+  }
+
+  // a localhop Interest from a non-local face cannot be forwarded to any non-local face
+  auto t1 = time::steady_clock::now();
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    auto pitEntry = expressDiscovery(Name("/localhop/bench").appendNumber(i));
+    BOOST_ASSERT(!pitEntry->hasOutRecords());
+    m_forwarder.getPit().erase(pitEntry.get());
+  }
+  auto t2 = time::steady_clock::now();
+
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Time elapsed: " << time::duration_cast<time::microseconds>(elapsed) << "\n"
+            << "Per localhop Interest among " << N_FACES << " faces: "
+            << elapsed.count() / N_INTERESTS << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(RouteLearningBurst)
+{
+  constexpr size_t N_DATA = 10000;
+  constexpr size_t N_PREFIXES = 100;
+
+  auto upstream = addFace();
+  ndn::KeyChain keyChain("pib-memory:", "tpm-memory:");
+  std::vector<lp::PrefixAnnouncementHeader> headers;
+  for (size_t i = 0; i < N_PREFIXES; ++i) {
+    ndn::PrefixAnnouncement pa;
+    pa.setAnnouncedName(Name("/bench").appendNumber(i));
+    pa.setExpiration(1_h);
+    pa.toData(keyChain, ndn::security::signingWithSha256());
+    headers.emplace_back(pa);
+  }
+
+  std::vector<std::pair<shared_ptr<pit::Entry>, shared_ptr<Data>>> pending;
+  pending.reserve(N_DATA);
+  for (size_t i = 0; i < N_DATA; ++i) {
+    Name name = Name("/bench").appendNumber(i % N_PREFIXES).appendNumber(i);
+    auto data = make_shared<Data>(name);
+    data->setTag(make_shared<lp::PrefixAnnouncementTag>(headers[i % N_PREFIXES]));
+    pending.emplace_back(expressDiscovery(name), data);
+  }
+
+  auto t1 = time::steady_clock::now();
+  for (const auto& [pitEntry, data] : pending) {
+    m_strategy->afterReceiveData(*data, FaceEndpoint(*upstream), pitEntry);
+  }
+  getGlobalIoService().poll();
+  getGlobalIoService().restart();
+  auto t2 = time::steady_clock::now();
+
+  size_t nClosures = drainRibIoService();
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Time elapsed: " << time::duration_cast<time::microseconds>(elapsed) << "\n"
+            << "Per Data carrying a PrefixAnnouncement: " << elapsed.count() / N_DATA << " ns\n"
+            << "Closures posted to the RIB thread: " << nClosures << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SelfLearning
+
+} // namespace nfd::tests
@@ -155,6 +155,41 @@ BOOST_AUTO_TEST_CASE(NotFound)
   BOOST_CHECK(err.is_equal("Face not found\n"));
 }
 
+BOOST_AUTO_TEST_CASE(Watch)
+{
+  const Name streamPrefix("/localhost/nfd/faces/events");
+  auto sendEvent = [&] (uint64_t seq, const std::string& remoteUri, const std::string& localUri) {
+    FaceEventNotification event;
+    event.setKind(ndn::nfd::FACE_EVENT_CREATED)
+         .setFaceId(seq + 256)
+         .setRemoteUri(remoteUri)
+         .setLocalUri(localUri);
+    auto data = ::nfd::tests::makeData(Name(streamPrefix).appendSequenceNumber(seq));
+    data->setFreshnessPeriod(1_s);
+    data->setContent(event.wireEncode());
+    face.receive(*data);
+  };
+
+  this->processInterest = [&] (const Interest& interest) {
+    if (interest.getName() == streamPrefix) {
+      sendEvent(0, "udp4://10.0.0.1:6363", "udp4://10.0.0.2:6363"); // does not match the scheme
+    }
+    else if (interest.getName() == Name(streamPrefix).appendSequenceNumber(1)) {
+      sendEvent(1, "udp6://[2001:db8::1]:6363", "udp6://[::1]:6363");
+    }
+    else if (interest.getName() != Name(streamPrefix).appendSequenceNumber(2)) {
+      this->sendEmptyDataset(interest.getName());
+    }
+  };
+
+  // no face has this scheme yet, which is not an error when watching
+  this->execute("face list scheme udp6 watch");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("event=created faceid=257 remote=udp6://[2001:db8::1]:6363 "
+                           "local=udp6://[::1]:6363\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
 BOOST_AUTO_TEST_CASE(Error)
 {
   this->processInterest = nullptr; // no response
@@ -25,12 +25,115 @@
 
 #include "nfdc/fib-module.hpp"
 
+#include "execute-command-fixture.hpp"
 #include "status-fixture.hpp"
 
 namespace nfd::tools::nfdc::tests {
 
 BOOST_AUTO_TEST_SUITE(Nfdc)
-BOOST_FIXTURE_TEST_SUITE(TestFibModule, StatusFixture<FibModule>)
+BOOST_AUTO_TEST_SUITE(TestFibModule)
+
+BOOST_FIXTURE_TEST_SUITE(ListCommand, ExecuteCommandFixture)
+
+const std::string LIST_OUTPUT = std::string(R"TEXT(
+FIB:
+  /A nexthops={faceid=262 (cost=9)}
+  /A/B nexthops={faceid=272 (cost=50), faceid=274 (cost=78)}
+)TEXT").substr(1);
+
+BOOST_AUTO_TEST_CASE(All)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK_EQUAL(interest.getName(), "/localhost/nfd/fib/list");
+
+    FibEntry payload1;
+    payload1.setPrefix("/A")
+            .addNextHopRecord(NextHopRecord().setFaceId(262).setCost(9));
+    FibEntry payload2;
+    payload2.setPrefix("/A/B")
+            .addNextHopRecord(NextHopRecord().setFaceId(272).setCost(50))
+            .addNextHopRecord(NextHopRecord().setFaceId(274).setCost(78));
+    this->sendDataset("/localhost/nfd/fib/list", payload1, payload2);
+  };
+
+  this->execute("fib list");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal(LIST_OUTPUT));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(Prefix)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_REQUIRE_EQUAL(interest.getName().size(), 5);
+    BOOST_CHECK_EQUAL(Name(interest.getName()[4].blockFromValue()), "/A/B");
+
+    FibEntry payload;
+    payload.setPrefix("/A/B")
+           .addNextHopRecord(NextHopRecord().setFaceId(272).setCost(50));
+    this->sendDataset(interest.getName(), payload);
+  };
+
+  this->execute("fib list /A/B");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("FIB:\n  /A/B nexthops={faceid=272 (cost=50)}\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(Watch)
+{
+  const Name streamPrefix("/localhost/nfd/fib/events");
+  auto sendEvent = [&] (uint64_t seq, uint64_t eventSeq, const Name& prefix) {
+    FibEventNotification event;
+    event.setKind(ndn::nfd::ROUTE_EVENT_ADDED)
+         .setSequence(eventSeq)
+         .setName(prefix)
+         .setNextHop(NextHopRecord().setFaceId(262).setCost(9));
+    auto data = ::nfd::tests::makeData(Name(streamPrefix).appendSequenceNumber(seq));
+    data->setFreshnessPeriod(1_s);
+    data->setContent(event.wireEncode());
+    face.receive(*data);
+  };
+
+  this->processInterest = [&] (const Interest& interest) {
+    if (Name("/localhost/nfd/fib/list").isPrefixOf(interest.getName())) {
+      FibEntry payload;
+      payload.setPrefix("/A/B")
+             .addNextHopRecord(NextHopRecord().setFaceId(272).setCost(50));
+      this->sendDataset(interest.getName(), payload);
+    }
+    else if (interest.getName() == streamPrefix) {
+      sendEvent(40, 7, "/A/B/C");
+    }
+    else if (interest.getName() == Name(streamPrefix).appendSequenceNumber(41)) {
+      sendEvent(41, 8, "/D"); // outside of the prefix
+    }
+    else if (interest.getName() == Name(streamPrefix).appendSequenceNumber(42)) {
+      sendEvent(42, 10, "/A/B");
+    }
+  };
+
+  this->execute("fib list /A/B watch");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("FIB:\n"
+                           "  /A/B nexthops={faceid=272 (cost=50)}\n"
+                           "seq=7 event=added prefix=/A/B/C nexthop=262 cost=9\n"
+                           "seq=10 event=added prefix=/A/B nexthop=262 cost=9\n"));
+  BOOST_CHECK(err.is_equal("Missed FIB events between seq=9 and seq=10\n"));
+}
+
+BOOST_AUTO_TEST_CASE(ErrorDataset)
+{
+  this->processInterest = nullptr; // no response to dataset
+
+  this->execute("fib list");
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK(err.is_equal("Error 10060 when fetching FIB dataset: Timeout exceeded\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ListCommand
+
+BOOST_FIXTURE_TEST_SUITE(StatusReport, StatusFixture<FibModule>)
 
 const std::string STATUS_XML = stripXmlSpaces(R"XML(
   <fib>
@@ -92,6 +195,7 @@ BOOST_AUTO_TEST_CASE(Status)
   BOOST_CHECK(statusText.is_equal(STATUS_TEXT));
 }
 
+BOOST_AUTO_TEST_SUITE_END() // StatusReport
 BOOST_AUTO_TEST_SUITE_END() // TestFibModule
 BOOST_AUTO_TEST_SUITE_END() // Nfdc
 
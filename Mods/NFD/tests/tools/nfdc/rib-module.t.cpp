@@ -131,6 +131,45 @@ BOOST_AUTO_TEST_CASE(ListByOriginNumeric)
   BOOST_CHECK(err.is_empty());
 }
 
+BOOST_AUTO_TEST_CASE(ListWatch)
+{
+  const Name streamPrefix("/localhost/nfd/rib/events");
+  auto sendEvent = [&] (uint64_t seq, ndn::nfd::RouteOrigin origin) {
+    RibEventNotification event;
+    event.setKind(ndn::nfd::ROUTE_EVENT_ADDED)
+         .setSequence(seq)
+         .setName("/P")
+         .setRoute(Route()
+                     .setFaceId(300)
+                     .setOrigin(origin)
+                     .setCost(10)
+                     .setFlags(ndn::nfd::ROUTE_FLAG_CHILD_INHERIT));
+    auto data = ::nfd::tests::makeData(Name(streamPrefix).appendSequenceNumber(seq));
+    data->setFreshnessPeriod(1_s);
+    data->setContent(event.wireEncode());
+    face.receive(*data);
+  };
+
+  this->processInterest = [&] (const Interest& interest) {
+    if (this->respondRibDataset(interest)) {
+      return;
+    }
+    if (interest.getName() == streamPrefix) {
+      sendEvent(3, ndn::nfd::ROUTE_ORIGIN_STATIC);
+    }
+    else if (interest.getName() == Name(streamPrefix).appendSequenceNumber(4)) {
+      sendEvent(4, ndn::nfd::ROUTE_ORIGIN_NLSR);
+    }
+  };
+
+  // no route in the dataset has this origin, which is not an error when watching
+  this->execute("route list origin nlsr watch");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("seq=4 event=added prefix=/P nexthop=300 origin=nlsr cost=10 "
+                           "flags=child-inherit expires=never\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
 BOOST_AUTO_TEST_CASE(ListByOriginString)
 {
   this->processInterest = [this] (const Interest& interest) {
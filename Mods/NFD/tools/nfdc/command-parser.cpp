@@ -27,6 +27,7 @@
 
 #include "cs-module.hpp"
 #include "face-module.hpp"
+#include "fib-module.hpp"
 #include "rib-module.hpp"
 #include "status.hpp"
 #include "strategy-choice-module.hpp"
@@ -137,6 +138,7 @@ registerCommands(CommandParser& parser)
 {
   registerStatusCommands(parser);
   FaceModule::registerCommands(parser);
+  FibModule::registerCommands(parser);
   RibModule::registerCommands(parser);
   CsModule::registerCommands(parser);
   StrategyChoiceModule::registerCommands(parser);
@@ -35,6 +35,7 @@
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
 #include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/util/notification-subscriber.hpp>
 
 namespace nfd::tools::nfdc {
 
@@ -67,6 +68,23 @@ public:
   ndn::nfd::DatasetFailureCallback
   makeDatasetFailureHandler(const std::string& datasetName);
 
+  /** \brief Subscribe to a notification stream and process events until interrupted.
+   *  \param stream name of the notification stream
+   *  \param handle invoked for each notification
+   */
+  template<typename Notification>
+  void
+  watchNotifications(const Name& stream, const std::function<void(const Notification&)>& handle)
+  {
+    ndn::util::NotificationSubscriber<Notification> subscriber(face, stream);
+    subscriber.onNotification.connect(handle);
+    subscriber.onDecodeError.connect([this] (const Data& data) {
+      err << "Cannot decode notification " << data.getName() << '\n';
+    });
+    subscriber.start();
+    face.processEvents();
+  }
+
 public:
   std::string_view noun;
   std::string_view verb;
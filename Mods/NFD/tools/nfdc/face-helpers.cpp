@@ -91,11 +91,11 @@ FindFace::execute(const FaceQueryFilter& filter, bool allowMulti)
 
   this->query();
   if (m_res == Code::OK) {
-    if (m_results.size() == 0) {
+    if (m_nResults == 0) {
       m_res = Code::NOT_FOUND;
       m_errorReason = "Face not found";
     }
-    else if (m_results.size() > 1 && !allowMulti) {
+    else if (m_nResults > 1 && !allowMulti) {
       m_res = Code::AMBIGUOUS;
       m_errorReason = "Multiple faces match the query";
     }
@@ -130,13 +130,30 @@ FindFace::query()
   auto datasetCb = [this] (const auto& result) {
     m_res = Code::OK;
     m_results = result;
+    m_nResults = result.size();
   };
   auto failureCb = [this] (uint32_t code, const auto& reason) {
     m_res = Code::ERROR;
     m_errorReason = "Error " + to_string(code) + " when querying face: " + reason;
   };
 
-  if (m_filter.empty()) {
+  if (m_onResults) {
+    auto entriesCb = [this] (const auto& results) {
+      m_nResults += results.size();
+      m_onResults(results);
+    };
+    auto completeCb = [this] { m_res = Code::OK; };
+
+    if (m_filter.empty()) {
+      m_ctx.controller.fetchStream<ndn::nfd::FaceDataset>(
+        entriesCb, completeCb, failureCb, m_ctx.makeCommandOptions());
+    }
+    else {
+      m_ctx.controller.fetchStream<ndn::nfd::FaceQueryDataset>(
+        m_filter, entriesCb, completeCb, failureCb, m_ctx.makeCommandOptions());
+    }
+  }
+  else if (m_filter.empty()) {
     m_ctx.controller.fetch<ndn::nfd::FaceDataset>(
       datasetCb, failureCb, m_ctx.makeCommandOptions());
   }
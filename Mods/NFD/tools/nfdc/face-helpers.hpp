@@ -60,6 +60,17 @@ public:
   explicit
   FindFace(ExecuteContext& ctx);
 
+  /** \brief Pass the face status of the results to \p onResults as they are received.
+   *
+   *  The results are then not kept, and getResults() returns an empty vector.
+   *  \pre execute has not been invoked
+   */
+  void
+  setResultsHandler(std::function<void(const std::vector<FaceStatus>&)> onResults)
+  {
+    m_onResults = std::move(onResults);
+  }
+
   /** \brief Find face by FaceUri.
    *  \pre execute has not been invoked
    */
@@ -138,6 +149,8 @@ private:
   FaceQueryFilter m_filter;
   Code m_res = Code::NOT_STARTED;
   std::vector<FaceStatus> m_results;
+  size_t m_nResults = 0;
+  std::function<void(const std::vector<FaceStatus>&)> m_onResults;
   std::string m_errorReason;
 };
 
@@ -40,7 +40,8 @@ FaceModule::registerCommands(CommandParser& parser)
     .setTitle("print face list")
     .addArg("remote", ArgValueType::FACE_URI, Required::NO, Positional::YES)
     .addArg("local", ArgValueType::FACE_URI, Required::NO, Positional::NO)
-    .addArg("scheme", ArgValueType::STRING, Required::NO, Positional::NO, "scheme");
+    .addArg("scheme", ArgValueType::STRING, Required::NO, Positional::NO, "scheme")
+    .addArg("watch", ArgValueType::NONE, Required::NO, Positional::NO);
   parser.addCommand(defFaceList, &FaceModule::list);
   parser.addAlias("face", "list", "");
 
@@ -89,27 +90,72 @@ FaceModule::list(ExecuteContext& ctx)
   }
 
   FindFace findFace(ctx);
+  // print the faces as the segments of the dataset arrive
+  findFace.setResultsHandler([&ctx] (const auto& results) {
+    for (const FaceStatus& item : results) {
+      formatItemText(ctx.out, item, false);
+      ctx.out << '\n';
+    }
+  });
   FindFace::Code res = findFace.execute(filter, true);
 
+  bool wantWatch = ctx.args.get<bool>("watch", false);
+  if (wantWatch && res == FindFace::Code::NOT_FOUND) {
+    // matching faces may be created later
+    res = FindFace::Code::OK;
+  }
+
   ctx.exitCode = static_cast<int>(res);
   switch (res) {
     case FindFace::Code::OK:
-      for (const FaceStatus& item : findFace.getResults()) {
-        formatItemText(ctx.out, item, false);
-        ctx.out << '\n';
-      }
       break;
     case FindFace::Code::ERROR:
     case FindFace::Code::NOT_FOUND:
     case FindFace::Code::CANONIZE_ERROR:
       ctx.err << findFace.getErrorReason() << '\n';
-      break;
+      return;
     default:
       BOOST_ASSERT_MSG(false, "unexpected FindFace result");
-      break;
+      return;
+  }
+
+  if (wantWatch) {
+    watchFaces(ctx, filter);
   }
 }
 
+void
+FaceModule::watchFaces(ExecuteContext& ctx, const FaceQueryFilter& filter)
+{
+  auto hasScheme = [] (const std::string& uri, const std::string& scheme) {
+    return uri.size() > scheme.size() && uri.compare(0, scheme.size(), scheme) == 0 &&
+           uri[scheme.size()] == ':';
+  };
+
+  ctx.watchNotifications<FaceEventNotification>("/localhost/nfd/faces/events",
+    [&] (const FaceEventNotification& event) {
+      if ((filter.hasRemoteUri() && event.getRemoteUri() != filter.getRemoteUri()) ||
+          (filter.hasLocalUri() && event.getLocalUri() != filter.getLocalUri()) ||
+          (filter.hasUriScheme() && !hasScheme(event.getRemoteUri(), filter.getUriScheme()) &&
+                                    !hasScheme(event.getLocalUri(), filter.getUriScheme()))) {
+        return;
+      }
+
+      formatEventText(ctx.out, event);
+      ctx.out << '\n';
+    });
+}
+
+void
+FaceModule::formatEventText(std::ostream& os, const FaceEventNotification& event)
+{
+  text::ItemAttributes ia;
+  os << ia("event") << event.getKind()
+     << ia("faceid") << event.getFaceId()
+     << ia("remote") << event.getRemoteUri()
+     << ia("local") << event.getLocalUri();
+}
+
 void
 FaceModule::show(ExecuteContext& ctx)
 {
@@ -30,10 +30,13 @@
 #include "command-parser.hpp"
 #include "format-helpers.hpp"
 
+#include <ndn-cxx/mgmt/nfd/face-event-notification.hpp>
+#include <ndn-cxx/mgmt/nfd/face-query-filter.hpp>
 #include <ndn-cxx/mgmt/nfd/face-status.hpp>
 
 namespace nfd::tools::nfdc {
 
+using ndn::nfd::FaceEventNotification;
 using ndn::nfd::FaceStatus;
 
 /**
@@ -49,6 +52,9 @@ public:
   registerCommands(CommandParser& parser);
 
   /** \brief The 'face list' command.
+   *
+   *  With 'watch', face events that match the filter are then printed as they are announced
+   *  on the face notification stream.
    */
   static void
   list(ExecuteContext& ctx);
@@ -95,6 +101,13 @@ public:
   static void
   formatItemText(std::ostream& os, const FaceStatus& item, bool wantMultiLine);
 
+  /** \brief Format a face event notification as text.
+   *  \param os output stream
+   *  \param event the notification
+   */
+  static void
+  formatEventText(std::ostream& os, const FaceEventNotification& event);
+
   /** \brief Print face action success message to specified ostream.
    *  \param os output stream
    *  \param actionSummary description of action taken
@@ -111,6 +124,13 @@ public:
   static void
   printFaceParams(std::ostream& os, text::ItemAttributes& ia, const ControlParameters& resp);
 
+private:
+  /** \brief Print the face events that match \p filter, as they are announced on the face
+   *         notification stream.
+   */
+  static void
+  watchFaces(ExecuteContext& ctx, const ndn::nfd::FaceQueryFilter& filter);
+
 private:
   std::vector<FaceStatus> m_status;
 };
@@ -30,6 +30,68 @@
 
 namespace nfd::tools::nfdc {
 
+void
+FibModule::registerCommands(CommandParser& parser)
+{
+  CommandDefinition defFibList("fib", "list");
+  defFibList
+    .setTitle("print FIB entries")
+    .addArg("prefix", ArgValueType::NAME, Required::NO, Positional::YES)
+    .addArg("watch", ArgValueType::NONE, Required::NO, Positional::NO);
+  parser.addCommand(defFibList, &FibModule::list);
+  parser.addAlias("fib", "list", "");
+}
+
+void
+FibModule::list(ExecuteContext& ctx)
+{
+  auto prefix = ctx.args.get<Name>("prefix", Name());
+
+  FibModule module;
+  ctx.out << "FIB:\n";
+  ctx.controller.fetchStream<ndn::nfd::FibDataset>(prefix,
+    [&] (const auto& entries) {
+      for (const FibEntry& entry : entries) {
+        module.formatItemText(ctx.out, entry);
+      }
+    },
+    nullptr,
+    ctx.makeDatasetFailureHandler("FIB dataset"),
+    ctx.makeCommandOptions());
+
+  ctx.face.processEvents();
+
+  if (!ctx.args.get<bool>("watch", false) || ctx.exitCode != 0) {
+    return;
+  }
+
+  std::optional<uint64_t> nextSequence;
+  ctx.watchNotifications<FibEventNotification>("/localhost/nfd/fib/events",
+    [&] (const FibEventNotification& event) {
+      if (nextSequence && event.getSequence() != *nextSequence) {
+        ctx.err << "Missed FIB events between seq=" << *nextSequence
+                << " and seq=" << event.getSequence() << '\n';
+      }
+      nextSequence = event.getSequence() + 1;
+
+      if (prefix.isPrefixOf(event.getName())) {
+        formatEventText(ctx.out, event);
+        ctx.out << '\n';
+      }
+    });
+}
+
+void
+FibModule::formatEventText(std::ostream& os, const FibEventNotification& event)
+{
+  text::ItemAttributes ia;
+  os << ia("seq") << event.getSequence()
+     << ia("event") << event.getKind()
+     << ia("prefix") << event.getName()
+     << ia("nexthop") << event.getNextHop().getFaceId()
+     << ia("cost") << event.getNextHop().getCost();
+}
+
 void
 FibModule::fetchStatus(ndn::nfd::Controller& controller,
                        const std::function<void()>& onSuccess,
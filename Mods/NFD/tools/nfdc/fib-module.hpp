@@ -27,12 +27,15 @@
 #define NFD_TOOLS_NFDC_FIB_MODULE_HPP
 
 #include "module.hpp"
+#include "command-parser.hpp"
 
 #include <ndn-cxx/mgmt/nfd/fib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/fib-event-notification.hpp>
 
 namespace nfd::tools::nfdc {
 
 using ndn::nfd::FibEntry;
+using ndn::nfd::FibEventNotification;
 using ndn::nfd::NextHopRecord;
 
 /**
@@ -42,6 +45,20 @@ using ndn::nfd::NextHopRecord;
 class FibModule : public Module, boost::noncopyable
 {
 public:
+  /** \brief Register 'fib list' command.
+   */
+  static void
+  registerCommands(CommandParser& parser);
+
+  /** \brief The 'fib list' command.
+   *
+   *  Entries are filtered by NFD when a prefix is given, and printed as the segments of
+   *  the dataset arrive. With 'watch', nexthop changes under the prefix are then printed
+   *  as they are announced on the FIB notification stream.
+   */
+  static void
+  list(ExecuteContext& ctx);
+
   void
   fetchStatus(ndn::nfd::Controller& controller,
               const std::function<void()>& onSuccess,
@@ -68,6 +85,13 @@ public:
   void
   formatItemText(std::ostream& os, const FibEntry& item) const;
 
+  /** \brief Format a FIB change notification as text.
+   *  \param os output stream
+   *  \param event the notification
+   */
+  static void
+  formatEventText(std::ostream& os, const FibEventNotification& event);
+
 private:
   std::vector<FibEntry> m_status;
 };
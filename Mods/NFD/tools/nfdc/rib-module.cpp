@@ -39,7 +39,8 @@ RibModule::registerCommands(CommandParser& parser)
   defRouteList
     .setTitle("print RIB routes")
     .addArg("nexthop", ArgValueType::FACE_ID_OR_URI, Required::NO, Positional::YES)
-    .addArg("origin", ArgValueType::ROUTE_ORIGIN, Required::NO, Positional::NO);
+    .addArg("origin", ArgValueType::ROUTE_ORIGIN, Required::NO, Positional::NO)
+    .addArg("watch", ArgValueType::NONE, Required::NO, Positional::NO);
   parser.addCommand(defRouteList, &RibModule::list);
   parser.addAlias("route", "list", "");
 
@@ -98,10 +99,17 @@ RibModule::list(ExecuteContext& ctx)
     nexthops = findFace.getFaceIds();
   }
 
-  listRoutesImpl(ctx, [&] (const RibEntry&, const Route& route) {
+  auto filter = [&] (const RibEntry&, const Route& route) {
     return (nexthops.empty() || nexthops.count(route.getFaceId()) > 0) &&
            (!origin || route.getOrigin() == *origin);
-  });
+  };
+  bool wantWatch = ctx.args.get<bool>("watch", false);
+
+  listRoutesImpl(ctx, filter, wantWatch);
+
+  if (wantWatch && ctx.exitCode == 0) {
+    watchRoutes(ctx, filter);
+  }
 }
 
 void
@@ -115,7 +123,7 @@ RibModule::show(ExecuteContext& ctx)
 }
 
 void
-RibModule::listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter)
+RibModule::listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter, bool isEmptyAllowed)
 {
   ctx.controller.fetch<ndn::nfd::RibDataset>(
     [&] (const auto& dataset) {
@@ -130,7 +138,7 @@ RibModule::listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter)
         }
       }
 
-      if (!hasRoute) {
+      if (!hasRoute && !isEmptyAllowed) {
         ctx.exitCode = 6;
         ctx.err << "Route not found\n";
       }
@@ -141,6 +149,32 @@ RibModule::listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter)
   ctx.face.processEvents();
 }
 
+void
+RibModule::watchRoutes(ExecuteContext& ctx, const RoutePredicate& filter)
+{
+  std::optional<uint64_t> nextSequence;
+  ctx.watchNotifications<RibEventNotification>("/localhost/nfd/rib/events",
+    [&] (const RibEventNotification& event) {
+      if (nextSequence && event.getSequence() != *nextSequence) {
+        ctx.err << "Missed RIB events between seq=" << *nextSequence
+                << " and seq=" << event.getSequence() << '\n';
+      }
+      nextSequence = event.getSequence() + 1;
+
+      RibEntry entry;
+      entry.setName(event.getName());
+      if (!filter(entry, event.getRoute())) {
+        return;
+      }
+
+      text::ItemAttributes ia;
+      ctx.out << ia("seq") << event.getSequence()
+              << ia("event") << event.getKind() << ' ';
+      formatRouteText(ctx.out, entry, event.getRoute(), true);
+      ctx.out << '\n';
+    });
+}
+
 void
 RibModule::add(ExecuteContext& ctx)
 {
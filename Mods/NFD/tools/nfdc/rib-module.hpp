@@ -30,10 +30,12 @@
 #include "command-parser.hpp"
 
 #include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/rib-event-notification.hpp>
 
 namespace nfd::tools::nfdc {
 
 using ndn::nfd::RibEntry;
+using ndn::nfd::RibEventNotification;
 using ndn::nfd::Route;
 
 /**
@@ -83,8 +85,17 @@ public:
 private:
   using RoutePredicate = std::function<bool(const RibEntry&, const Route&)>;
 
+  /** \brief Print the routes that satisfy \p filter.
+   *  \param isEmptyAllowed if false, it is an error that no route satisfies \p filter
+   */
+  static void
+  listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter, bool isEmptyAllowed = false);
+
+  /** \brief Print the route changes that satisfy \p filter, as they are announced on the
+   *         RIB notification stream.
+   */
   static void
-  listRoutesImpl(ExecuteContext& ctx, const RoutePredicate& filter);
+  watchRoutes(ExecuteContext& ctx, const RoutePredicate& filter);
 
   /** \brief Format a single status item as XML.
    *  \param os output stream
@@ -137,13 +137,6 @@ registerStatusCommands(CommandParser& parser)
                     std::bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantChannels));
   parser.addAlias("channel", "list", "");
 
-  CommandDefinition defFibList("fib", "list");
-  defFibList
-    .setTitle("print FIB entries");
-  parser.addCommand(defFibList,
-                    std::bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantFib));
-  parser.addAlias("fib", "list", "");
-
   CommandDefinition defCsInfo("cs", "info");
   defCsInfo
     .setTitle("print CS information");
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/data-view.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+namespace ndn {
+
+DataView::DataView(Block wire)
+  : m_wire(std::move(wire))
+{
+  if (m_wire.type() != tlv::Data) {
+    NDN_THROW(Data::Error("Data", m_wire.type()));
+  }
+}
+
+void
+DataView::locateElements() const
+{
+  if (m_isLocated) {
+    return;
+  }
+
+  // same element order rules as Data::wireDecode, without decoding the elements
+  const uint8_t* pos = m_wire.value();
+  const uint8_t* const end = pos + m_wire.value_size();
+  bool hasSignatureValue = false;
+  int lastElement = 0; // last recognized element index, in spec order
+  while (pos != end) {
+    const uint8_t* elementBegin = pos;
+    uint32_t type = tlv::readType(pos, end);
+    uint64_t length = tlv::readVarNumber(pos, end);
+    if (length > static_cast<uint64_t>(end - pos)) {
+      NDN_THROW(Data::Error("TLV-LENGTH of sub-element of type " + to_string(type) +
+                            " exceeds TLV-VALUE boundary of Data"));
+    }
+    span<const uint8_t> value(pos, static_cast<size_t>(length));
+    pos += length;
+    span<const uint8_t> tlv(elementBegin, pos);
+
+    if (lastElement == 0) {
+      if (type != tlv::Name) {
+        NDN_THROW(Data::Error("Name element is missing or out of order"));
+      }
+      m_nameTlv = tlv;
+      lastElement = 1;
+      continue;
+    }
+
+    switch (type) {
+      case tlv::MetaInfo:
+        if (lastElement >= 2) {
+          NDN_THROW(Data::Error("MetaInfo element is out of order"));
+        }
+        m_metaInfoTlv = tlv;
+        lastElement = 2;
+        break;
+      case tlv::Content:
+        if (lastElement >= 3) {
+          NDN_THROW(Data::Error("Content element is out of order"));
+        }
+        m_content = value;
+        lastElement = 3;
+        break;
+      case tlv::SignatureInfo:
+        if (lastElement >= 4) {
+          NDN_THROW(Data::Error("SignatureInfo element is out of order"));
+        }
+        m_signatureInfoTlv = tlv;
+        lastElement = 4;
+        break;
+      case tlv::SignatureValue:
+        if (lastElement >= 5) {
+          NDN_THROW(Data::Error("SignatureValue element is out of order"));
+        }
+        m_signatureValue = value;
+        hasSignatureValue = true;
+        lastElement = 5;
+        break;
+      default:
+        if (tlv::isCriticalType(type)) {
+          NDN_THROW(Data::Error("Unrecognized element of critical type " + to_string(type)));
+        }
+        break;
+    }
+  }
+
+  if (lastElement == 0) {
+    NDN_THROW(Data::Error("Name element is missing or out of order"));
+  }
+  if (m_signatureInfoTlv.empty()) {
+    NDN_THROW(Data::Error("SignatureInfo element is missing"));
+  }
+  if (!hasSignatureValue) {
+    NDN_THROW(Data::Error("SignatureValue element is missing"));
+  }
+  m_isLocated = true;
+}
+
+Block
+DataView::makeSubBlock(span<const uint8_t> tlv) const
+{
+  auto begin = std::next(m_wire.begin(), tlv.data() - m_wire.data());
+  return Block(m_wire, begin, std::next(begin, tlv.size()));
+}
+
+const Name&
+DataView::getName() const
+{
+  if (!m_name) {
+    locateElements();
+    m_name.emplace(makeSubBlock(m_nameTlv));
+  }
+  return *m_name;
+}
+
+Name
+DataView::getFullName() const
+{
+  return Name(getName()).appendImplicitSha256Digest(util::Sha256::computeDigest(m_wire));
+}
+
+const MetaInfo&
+DataView::getMetaInfo() const
+{
+  if (!m_metaInfo) {
+    locateElements();
+    if (m_metaInfoTlv) {
+      m_metaInfo.emplace(makeSubBlock(*m_metaInfoTlv));
+    }
+    else {
+      m_metaInfo.emplace();
+    }
+  }
+  return *m_metaInfo;
+}
+
+const SignatureInfo&
+DataView::getSignatureInfo() const
+{
+  if (!m_signatureInfo) {
+    locateElements();
+    m_signatureInfo.emplace(makeSubBlock(m_signatureInfoTlv), SignatureInfo::Type::Data);
+  }
+  return *m_signatureInfo;
+}
+
+} // namespace ndn
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DATA_VIEW_HPP
+#define NDN_CXX_DATA_VIEW_HPP
+
+#include "ndn-cxx/data.hpp"
+
+#include <optional>
+
+namespace ndn {
+
+/**
+ * @brief Read-only view of a %Data packet that decodes its fields on demand.
+ *
+ * Constructing a DataView only checks the TLV-TYPE of the packet. The top-level elements are
+ * located on the first access to any field, and each field is decoded when it is first
+ * requested; in particular, SignatureInfo is not decoded unless asked for. Content and
+ * SignatureValue are returned as spans into the wire encoding, which the view keeps alive.
+ * Errors are reported as Data::Error when the affected field, or the element structure as
+ * a whole, is first accessed.
+ *
+ * Use toData() to obtain a fully decoded Data, e.g., before inserting it into a cache.
+ */
+class DataView
+{
+public:
+  /**
+   * @brief Creates a view of @p wire.
+   * @throw Data::Error @p wire is not a Data
+   */
+  explicit
+  DataView(Block wire);
+
+  const Block&
+  getWire() const noexcept
+  {
+    return m_wire;
+  }
+
+  const Name&
+  getName() const;
+
+  /**
+   * @brief Returns the full name, including the implicit digest computed over the wire encoding.
+   */
+  Name
+  getFullName() const;
+
+  const MetaInfo&
+  getMetaInfo() const;
+
+  uint32_t
+  getContentType() const
+  {
+    return getMetaInfo().getType();
+  }
+
+  time::milliseconds
+  getFreshnessPeriod() const
+  {
+    return getMetaInfo().getFreshnessPeriod();
+  }
+
+  bool
+  hasContent() const
+  {
+    locateElements();
+    return m_content.has_value();
+  }
+
+  /**
+   * @brief Returns the TLV-VALUE of Content, or an empty span if absent.
+   */
+  span<const uint8_t>
+  getContent() const
+  {
+    locateElements();
+    return m_content.value_or(span<const uint8_t>{});
+  }
+
+  const SignatureInfo&
+  getSignatureInfo() const;
+
+  /**
+   * @brief Returns the TLV-VALUE of SignatureValue.
+   */
+  span<const uint8_t>
+  getSignatureValue() const
+  {
+    locateElements();
+    return m_signatureValue;
+  }
+
+  /**
+   * @brief Decodes the whole packet.
+   * @throw Data::Error the packet is malformed
+   */
+  shared_ptr<Data>
+  toData() const
+  {
+    return std::make_shared<Data>(m_wire);
+  }
+
+private:
+  void
+  locateElements() const;
+
+  /**
+   * @brief Returns a Block that shares the wire buffer over the TLV @p tlv.
+   */
+  Block
+  makeSubBlock(span<const uint8_t> tlv) const;
+
+private:
+  Block m_wire;
+
+  mutable bool m_isLocated = false;
+  // the following fields are valid after locateElements()
+  mutable span<const uint8_t> m_nameTlv;
+  mutable std::optional<span<const uint8_t>> m_metaInfoTlv;
+  mutable std::optional<span<const uint8_t>> m_content; // TLV-VALUE
+  mutable span<const uint8_t> m_signatureInfoTlv;
+  mutable span<const uint8_t> m_signatureValue; // TLV-VALUE
+
+  mutable std::optional<Name> m_name;
+  mutable std::optional<MetaInfo> m_metaInfo;
+  mutable std::optional<SignatureInfo> m_signatureInfo;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_DATA_VIEW_HPP
@@ -25,6 +25,7 @@
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/impl/buffer-pool.hpp"
 #include "ndn-cxx/security/transform/hex-decode.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
@@ -42,6 +43,17 @@ namespace ndn {
 
 constexpr size_t MAX_SIZE_OF_BLOCK_FROM_STREAM = MAX_NDN_PACKET_SIZE;
 
+/** @brief Copies the range [@p first, @p last) into a pooled Buffer.
+ *  @note The Buffer can be longer than the range, which starts at its beginning.
+ */
+static ConstBufferPtr
+makeBufferCopy(span<const uint8_t>::iterator first, span<const uint8_t>::iterator last)
+{
+  auto buffer = detail::makePooledBuffer(static_cast<size_t>(std::distance(first, last)));
+  std::copy(first, last, buffer->begin());
+  return buffer;
+}
+
 // ---- constructor, creation, assignment ----
 
 Block::Block() = default;
@@ -67,12 +79,13 @@ Block::Block(span<const uint8_t> buffer)
   std::advance(pos, length);
   // pos now points to the end of the TLV
 
-  m_buffer = std::make_shared<Buffer>(buffer.begin(), pos);
-  m_begin = m_buffer->begin();
-  m_end = m_buffer->end();
+  auto b = makeBufferCopy(buffer.begin(), pos);
+  m_size = static_cast<size_t>(std::distance(buffer.begin(), pos));
+  m_begin = b->begin();
+  m_end = std::next(m_begin, m_size);
   m_valueBegin = std::prev(m_end, length);
-  m_valueEnd = m_buffer->end();
-  m_size = m_buffer->size();
+  m_valueEnd = m_end;
+  m_buffer = std::move(b);
 }
 
 Block::Block(const EncodingBuffer& buffer)
@@ -214,8 +227,9 @@ Block::fromBuffer(span<const uint8_t> buffer)
   std::advance(pos, length);
   // pos now points to the end of the TLV
 
-  auto b = std::make_shared<Buffer>(buffer.begin(), pos);
-  return {true, Block(b, type, b->begin(), b->end(), std::prev(b->end(), length), b->end())};
+  auto b = makeBufferCopy(buffer.begin(), pos);
+  auto tlvEnd = std::next(b->begin(), std::distance(buffer.begin(), pos));
+  return {true, Block(b, type, b->begin(), tlvEnd, std::prev(tlvEnd, length), tlvEnd)};
 }
 
 Block
@@ -245,9 +259,9 @@ Block::fromStream(std::istream& is)
   eb.prependVarNumber(length);
   eb.prependVarNumber(type);
 
-  // TLV-VALUE is directly written into eb.buf(), eb.end() is not incremented, but eb.getBuffer()
-  // has the correct layout.
-  return Block(eb.getBuffer());
+  // TLV-VALUE is directly written into eb.buf(), eb.end() is not incremented, but the TLV
+  // ends at eb.end() + length
+  return Block(eb.getBuffer(), eb.begin(), std::next(eb.end(), length), true);
 }
 
 // ---- wire format ----
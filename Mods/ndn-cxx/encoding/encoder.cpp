@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/encoding/encoder.hpp"
+#include "ndn-cxx/impl/buffer-pool.hpp"
 
 #include <boost/endian/conversion.hpp>
 
@@ -28,7 +29,7 @@ namespace ndn::encoding {
 namespace endian = boost::endian;
 
 Encoder::Encoder(size_t totalReserve, size_t reserveFromBack)
-  : m_buffer(make_shared<Buffer>(totalReserve))
+  : m_buffer(detail::makePooledBuffer(totalReserve))
 {
   m_begin = m_end = m_buffer->end() - (reserveFromBack < totalReserve ? reserveFromBack : 0);
 }
@@ -95,6 +95,22 @@ operator<<(std::ostream& os, FaceEventKind faceEventKind)
   return os << static_cast<unsigned>(faceEventKind);
 }
 
+std::ostream&
+operator<<(std::ostream& os, RouteEventKind routeEventKind)
+{
+  switch (routeEventKind) {
+    case ROUTE_EVENT_NONE:
+      return os << "none";
+    case ROUTE_EVENT_ADDED:
+      return os << "added";
+    case ROUTE_EVENT_UPDATED:
+      return os << "updated";
+    case ROUTE_EVENT_REMOVED:
+      return os << "removed";
+  }
+  return os << static_cast<unsigned>(routeEventKind);
+}
+
 std::istream&
 operator>>(std::istream& is, RouteOrigin& routeOrigin)
 {
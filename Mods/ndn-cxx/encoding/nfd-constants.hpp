@@ -86,6 +86,19 @@ enum FaceEventKind : uint8_t {
 std::ostream&
 operator<<(std::ostream& os, FaceEventKind faceEventKind);
 
+/** \ingroup management
+ *  \brief Kind of a change to a FIB nexthop or a RIB route.
+ */
+enum RouteEventKind : uint8_t {
+  ROUTE_EVENT_NONE    = 0,
+  ROUTE_EVENT_ADDED   = 1, ///< nexthop or route was added
+  ROUTE_EVENT_UPDATED = 2, ///< cost or other attributes of nexthop or route were changed
+  ROUTE_EVENT_REMOVED = 3, ///< nexthop or route was removed
+};
+
+std::ostream&
+operator<<(std::ostream& os, RouteEventKind routeEventKind);
+
 /** \ingroup management
  *  \brief CS enablement flags.
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
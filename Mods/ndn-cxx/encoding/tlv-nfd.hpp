@@ -101,6 +101,12 @@ enum : uint32_t {
   // RIB Management
   RibEntry = 128,
   Route    = 129,
+
+  // FIB and RIB notifications
+  FibEventNotification = 194,
+  RibEventNotification = 195,
+  RouteEventKind       = 196,
+  EventSequence        = 197,
 };
 
 } // namespace ndn::tlv::nfd
@@ -0,0 +1,249 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/buffer-pool.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace ndn::detail {
+
+namespace {
+
+// successive classes differ by at most 25%, except for the smallest ones
+constexpr std::array<size_t, 15> SIZE_CLASSES{
+  128, 256, 512, 768, 1024, 1280, 1536, 2048, 2560, 3072, 4096, 5120, 6144, 7168,
+  MAX_NDN_PACKET_SIZE,
+};
+constexpr size_t MAX_BUFFERS_PER_CLASS = 32;
+constexpr size_t MAX_POOLED_OCTETS = 1024 * 1024;
+constexpr size_t MAX_CONTROL_BLOCKS = 256;
+
+/**
+ * @brief Free lists of Buffers, one per size class, and of shared_ptr control blocks.
+ */
+class BufferPool : noncopyable
+{
+public:
+  explicit
+  BufferPool(bool& isDestroyed) noexcept
+    : m_isDestroyed(isDestroyed)
+  {
+  }
+
+  ~BufferPool()
+  {
+    m_isDestroyed = true;
+    for (const auto& buffers : m_buffers) {
+      for (Buffer* buffer : buffers) {
+        delete buffer;
+      }
+    }
+    for (void* block : m_controlBlocks) {
+      ::operator delete(block);
+    }
+  }
+
+  Buffer*
+  takeBuffer(size_t sizeClass) noexcept
+  {
+    auto& buffers = m_buffers[sizeClass];
+    if (buffers.empty()) {
+      return nullptr;
+    }
+    Buffer* buffer = buffers.back();
+    buffers.pop_back();
+    m_nOctets -= buffer->size();
+    return buffer;
+  }
+
+  /**
+   * @return whether the pool has taken ownership of @p buffer
+   */
+  bool
+  giveBuffer(size_t sizeClass, Buffer* buffer) noexcept
+  {
+    auto& buffers = m_buffers[sizeClass];
+    // the owner of a Buffer may have resized it
+    if (buffer->size() != SIZE_CLASSES[sizeClass] || buffers.size() >= MAX_BUFFERS_PER_CLASS ||
+        m_nOctets + buffer->size() > MAX_POOLED_OCTETS) {
+      return false;
+    }
+    if (buffers.capacity() == 0) {
+      buffers.reserve(MAX_BUFFERS_PER_CLASS);
+    }
+    buffers.push_back(buffer);
+    m_nOctets += buffer->size();
+    return true;
+  }
+
+  void*
+  takeControlBlock() noexcept
+  {
+    if (m_controlBlocks.empty()) {
+      return nullptr;
+    }
+    void* block = m_controlBlocks.back();
+    m_controlBlocks.pop_back();
+    return block;
+  }
+
+  bool
+  giveControlBlock(void* block) noexcept
+  {
+    if (m_controlBlocks.size() >= MAX_CONTROL_BLOCKS) {
+      return false;
+    }
+    if (m_controlBlocks.capacity() == 0) {
+      m_controlBlocks.reserve(MAX_CONTROL_BLOCKS);
+    }
+    m_controlBlocks.push_back(block);
+    return true;
+  }
+
+private:
+  bool& m_isDestroyed;
+  std::array<std::vector<Buffer*>, SIZE_CLASSES.size()> m_buffers;
+  size_t m_nOctets = 0;
+  std::vector<void*> m_controlBlocks;
+};
+
+/**
+ * @brief Returns the pool of the calling thread, or nullptr if it has been destroyed.
+ *
+ * A Buffer can be released while thread-local and static objects are being destroyed,
+ * in which case it is simply deleted.
+ */
+BufferPool*
+getPool() noexcept
+{
+  // trivially destructible, hence still accessible after the pool is destroyed
+  static thread_local bool isDestroyed = false;
+  if (isDestroyed) {
+    return nullptr;
+  }
+  static thread_local BufferPool pool(isDestroyed);
+  return &pool;
+}
+
+/**
+ * @brief Allocator of shared_ptr control blocks, which are all of the same type.
+ *
+ * Every block is allocated with ::operator new, so that it can be freed by any thread.
+ */
+template<typename T>
+class ControlBlockAllocator
+{
+public:
+  using value_type = T;
+
+  ControlBlockAllocator() noexcept = default;
+
+  template<typename U>
+  ControlBlockAllocator(const ControlBlockAllocator<U>&) noexcept
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n == 1) {
+      if (auto pool = getPool(); pool != nullptr) {
+        if (void* block = pool->takeControlBlock(); block != nullptr) {
+          return static_cast<T*>(block);
+        }
+      }
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (n == 1) {
+      if (auto pool = getPool(); pool != nullptr && pool->giveControlBlock(p)) {
+        return;
+      }
+    }
+    ::operator delete(p);
+  }
+
+  friend bool
+  operator==(const ControlBlockAllocator&, const ControlBlockAllocator&) noexcept
+  {
+    return true;
+  }
+
+  friend bool
+  operator!=(const ControlBlockAllocator&, const ControlBlockAllocator&) noexcept
+  {
+    return false;
+  }
+};
+
+class PooledBufferDeleter
+{
+public:
+  explicit
+  PooledBufferDeleter(size_t sizeClass) noexcept
+    : m_sizeClass(sizeClass)
+  {
+  }
+
+  void
+  operator()(Buffer* buffer) const noexcept
+  {
+    if (auto pool = getPool(); pool != nullptr && pool->giveBuffer(m_sizeClass, buffer)) {
+      return;
+    }
+    delete buffer;
+  }
+
+private:
+  size_t m_sizeClass;
+};
+
+} // namespace
+
+shared_ptr<Buffer>
+makePooledBuffer(size_t size)
+{
+  auto sizeClass = static_cast<size_t>(std::lower_bound(SIZE_CLASSES.begin(), SIZE_CLASSES.end(),
+                                                        size) - SIZE_CLASSES.begin());
+  if (sizeClass == SIZE_CLASSES.size()) {
+    return std::make_shared<Buffer>(size);
+  }
+
+  Buffer* buffer = nullptr;
+  if (auto pool = getPool(); pool != nullptr) {
+    buffer = pool->takeBuffer(sizeClass);
+  }
+  if (buffer == nullptr) {
+    buffer = new Buffer(SIZE_CLASSES[sizeClass]);
+  }
+
+  // if the control block cannot be allocated, the deleter is invoked on the Buffer
+  return shared_ptr<Buffer>(buffer, PooledBufferDeleter(sizeClass),
+                            ControlBlockAllocator<Buffer>());
+}
+
+} // namespace ndn::detail
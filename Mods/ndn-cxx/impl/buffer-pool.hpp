@@ -0,0 +1,44 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_BUFFER_POOL_HPP
+#define NDN_CXX_IMPL_BUFFER_POOL_HPP
+
+#include "ndn-cxx/encoding/buffer.hpp"
+
+namespace ndn::detail {
+
+/**
+ * @brief Returns a Buffer of at least @p size octets, recycled from a thread-local pool if possible.
+ *
+ * @p size is rounded up to a size class, the largest of which is MAX_NDN_PACKET_SIZE; larger
+ * Buffers are allocated normally and not pooled. When the last reference to a pooled Buffer is
+ * dropped, the Buffer and its shared_ptr control block go back to the pool of the releasing
+ * thread, unless that pool is full.
+ *
+ * The contents of the returned Buffer are unspecified.
+ */
+shared_ptr<Buffer>
+makePooledBuffer(size_t size);
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_IMPL_BUFFER_POOL_HPP
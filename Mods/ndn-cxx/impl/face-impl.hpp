@@ -95,6 +95,7 @@ public: // consumer
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied,
                                              afterNacked, afterTimeout, m_scheduler);
+    m_pendingInterestIndex.insert(entry);
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
@@ -133,22 +134,23 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
-      if (!entry.getInterest()->matchesData(data)) {
-        return false;
+    for (auto id : m_pendingInterestIndex.findDataCandidates(data.getName())) {
+      auto entry = m_pendingInterestTable.get(id);
+      if (entry == nullptr || !entry->getInterest()->matchesData(data)) {
+        continue;
       }
-      NDN_LOG_DEBUG("   satisfying " << *entry.getInterest() << " from " << entry.getOrigin());
+      NDN_LOG_DEBUG("   satisfying " << *entry->getInterest() << " from " << entry->getOrigin());
 
-      if (entry.getOrigin() == PendingInterestOrigin::APP) {
+      if (entry->getOrigin() == PendingInterestOrigin::APP) {
         hasAppMatch = true;
-        entry.invokeDataCallback(data);
+        entry->invokeDataCallback(data);
       }
       else {
         hasForwarderMatch = true;
       }
 
-      return true;
-    });
+      m_pendingInterestTable.erase(id);
+    }
 
     // if Data matches no pending Interest record, it is sent to the forwarder as unsolicited Data
     return hasForwarderMatch || !hasAppMatch;
@@ -161,25 +163,26 @@ public: // consumer
   nackPendingInterests(const lp::Nack& nack)
   {
     std::optional<lp::Nack> outNack;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
-      if (!nack.getInterest().matchesInterest(*entry.getInterest())) {
-        return false;
+    for (auto id : m_pendingInterestIndex.findNackCandidates(nack.getInterest().getName())) {
+      auto entry = m_pendingInterestTable.get(id);
+      if (entry == nullptr || !nack.getInterest().matchesInterest(*entry->getInterest())) {
+        continue;
       }
-      NDN_LOG_DEBUG("   nacking " << *entry.getInterest() << " from " << entry.getOrigin());
+      NDN_LOG_DEBUG("   nacking " << *entry->getInterest() << " from " << entry->getOrigin());
 
-      auto outNack1 = entry.recordNack(nack);
+      auto outNack1 = entry->recordNack(nack);
       if (!outNack1) {
-        return false;
+        continue;
       }
 
-      if (entry.getOrigin() == PendingInterestOrigin::APP) {
-        entry.invokeNackCallback(*outNack1);
+      if (entry->getOrigin() == PendingInterestOrigin::APP) {
+        entry->invokeNackCallback(*outNack1);
       }
       else {
         outNack = outNack1;
       }
-      return true;
-    });
+      m_pendingInterestTable.erase(id);
+    }
 
     // send "least severe" Nack from any PendingInterest record originated from forwarder, because
     // it is unimportant to consider Nack reason for the unlikely case when forwarder sends multiple
@@ -192,7 +195,8 @@ public: // producer
   setInterestFilter(detail::RecordId id, const InterestFilter& filter, const InterestCallback& onInterest)
   {
     NDN_LOG_INFO("setting InterestFilter: " << filter);
-    m_interestFilterTable.put(id, filter, onInterest);
+    auto& record = m_interestFilterTable.put(id, filter, onInterest);
+    m_interestFilterIndex.insert(record);
   }
 
   void
@@ -211,6 +215,7 @@ public: // producer
   {
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.insert(std::move(interest), m_scheduler);
+    m_pendingInterestIndex.insert(entry);
     dispatchInterest(entry, interest2);
   }
 
@@ -278,6 +283,7 @@ public: // prefix registration
         if (filter) {
           NDN_LOG_INFO("setting InterestFilter: " << *filter);
           auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest);
+          m_interestFilterIndex.insert(filterRecord);
           filterId = filterRecord.getId();
         }
         m_registeredPrefixTable.put(id, prefix, options, filterId);
@@ -357,14 +363,15 @@ private:
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
-    m_interestFilterTable.forEach([&] (const InterestFilterRecord& filter) {
-      if (!filter.doesMatch(entry)) {
-        return;
+    for (auto id : m_interestFilterIndex.findCandidates(interest.getName())) {
+      const auto* filter = m_interestFilterTable.get(id);
+      if (filter == nullptr || !filter->doesMatchIndexed(entry)) {
+        continue;
       }
-      NDN_LOG_DEBUG("   matches " << filter.getFilter());
+      NDN_LOG_DEBUG("   matches " << filter->getFilter());
       entry.recordForwarding();
-      filter.invokeInterestCallback(interest);
-    });
+      filter->invokeInterestCallback(interest);
+    }
   }
 
   void
@@ -420,7 +427,10 @@ private:
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
 
+  // each index is declared before its table, because a record leaves the index when destroyed
+  detail::PendingInterestIndex m_pendingInterestIndex;
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
+  detail::InterestFilterIndex m_interestFilterIndex;
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
   detail::RecordContainer<RegisteredPrefix> m_registeredPrefixTable;
 
@@ -0,0 +1,65 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/interest-filter-index.hpp"
+#include "ndn-cxx/impl/interest-filter-record.hpp"
+
+namespace ndn::detail {
+
+void
+InterestFilterIndex::insert(InterestFilterRecord& record)
+{
+  BOOST_ASSERT(record.m_index == nullptr);
+  record.m_indexNode = m_trie.insert(record.getFilter().getPrefix().getnonReflexiveName(), &record);
+  record.m_index = this;
+}
+
+void
+InterestFilterIndex::erase(InterestFilterRecord& record)
+{
+  BOOST_ASSERT(record.m_index == this);
+  m_trie.erase(record.m_indexNode, &record);
+  record.m_index = nullptr;
+  record.m_indexNode = nullptr;
+}
+
+std::vector<RecordId>
+InterestFilterIndex::findCandidates(const Name& interestName) const
+{
+  std::vector<RecordId> ids;
+  auto collect = [&ids] (const Node& node) {
+    for (const auto* record : node.entries) {
+      ids.push_back(record->getId());
+    }
+  };
+
+  if (interestName.isReflexiveName()) {
+    m_trie.visitPrefixes(interestName.getnonReflexiveName(), collect);
+  }
+  else {
+    m_trie.visitPrefixes(interestName, collect);
+  }
+
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+} // namespace ndn::detail
@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_INTEREST_FILTER_INDEX_HPP
+#define NDN_CXX_IMPL_INTEREST_FILTER_INDEX_HPP
+
+#include "ndn-cxx/impl/name-trie.hpp"
+#include "ndn-cxx/impl/record-container.hpp"
+
+namespace ndn {
+
+class InterestFilterRecord;
+
+namespace detail {
+
+/**
+ * @brief Index of the InterestFilter table by filter prefix.
+ *
+ * Each filter is attached to the trie node of its prefix, so that the filters whose prefix
+ * matches an Interest are found by walking the Interest name once, rather than by testing
+ * every filter. A regex filter is attached to the node of its prefix as well, hence its regex
+ * is evaluated only for Interests under that prefix.
+ *
+ * Reflexive names are compared without their reflexive component, as in
+ * InterestFilter::doesMatch. An InterestFilterRecord removes itself from the index when destroyed.
+ */
+class InterestFilterIndex : noncopyable
+{
+public:
+  using Node = NameTrie<InterestFilterRecord>::Node;
+
+  void
+  insert(InterestFilterRecord& record);
+
+  void
+  erase(InterestFilterRecord& record);
+
+  /**
+   * @brief Returns the IDs of the records whose filter prefix matches @p interestName,
+   *        in increasing order.
+   */
+  std::vector<RecordId>
+  findCandidates(const Name& interestName) const;
+
+private:
+  NameTrie<InterestFilterRecord> m_trie;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_INTEREST_FILTER_INDEX_HPP
@@ -22,6 +22,7 @@
 #ifndef NDN_CXX_IMPL_INTEREST_FILTER_RECORD_HPP
 #define NDN_CXX_IMPL_INTEREST_FILTER_RECORD_HPP
 
+#include "ndn-cxx/impl/interest-filter-index.hpp"
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 
@@ -45,6 +46,13 @@ public:
   {
   }
 
+  ~InterestFilterRecord()
+  {
+    if (m_index != nullptr) {
+      m_index->erase(*this);
+    }
+  }
+
   const InterestFilter&
   getFilter() const
   {
@@ -62,6 +70,19 @@ public:
             m_filter.doesMatch(entry.getInterest()->getName());
   }
 
+  /**
+   * @brief Check if an Interest found by InterestFilterIndex matches the filter.
+   *
+   * The index has already matched the filter prefix, hence only the origin of the Interest
+   * and the regex filter, if any, remain to be checked.
+   */
+  bool
+  doesMatchIndexed(const PendingInterest& entry) const
+  {
+    return (entry.getOrigin() == PendingInterestOrigin::FORWARDER || m_filter.allowsLoopback()) &&
+           (!m_filter.hasRegexFilter() || m_filter.doesMatch(entry.getInterest()->getName()));
+  }
+
   /**
    * @brief Invokes the InterestCallback.
    * @note This method does nothing if the Interest callback is empty
@@ -77,6 +98,11 @@ public:
 private:
   InterestFilter m_filter;
   InterestCallback m_interestCallback;
+
+  detail::InterestFilterIndex* m_index = nullptr;
+  detail::InterestFilterIndex::Node* m_indexNode = nullptr;
+
+  friend detail::InterestFilterIndex;
 };
 
 } // namespace ndn
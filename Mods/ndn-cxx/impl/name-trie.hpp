@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_NAME_TRIE_HPP
+#define NDN_CXX_IMPL_NAME_TRIE_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace ndn::detail {
+
+/**
+ * @brief A trie of name components, whose nodes hold pointers to records.
+ * @tparam T record type; records are not owned by the trie
+ *
+ * Each record is attached to the node of one name. The node returned by insert() must be
+ * passed to erase(), after which nodes that no longer lead to a record are removed.
+ */
+template<typename T>
+class NameTrie : noncopyable
+{
+public:
+  struct Node
+  {
+    Node* parent = nullptr;
+    name::Component key;
+    std::map<name::Component, std::unique_ptr<Node>> children;
+    std::vector<T*> entries;
+  };
+
+  Node*
+  insert(const Name& name, T* entry)
+  {
+    Node* node = &m_root;
+    for (const auto& comp : name) {
+      auto& child = node->children[comp];
+      if (child == nullptr) {
+        child = std::make_unique<Node>();
+        child->parent = node;
+        child->key = comp;
+      }
+      node = child.get();
+    }
+    node->entries.push_back(entry);
+    return node;
+  }
+
+  void
+  erase(Node* node, T* entry)
+  {
+    auto it = std::find(node->entries.begin(), node->entries.end(), entry);
+    BOOST_ASSERT(it != node->entries.end());
+    node->entries.erase(it);
+
+    while (node->parent != nullptr && node->entries.empty() && node->children.empty()) {
+      Node* parent = node->parent;
+      parent->children.erase(node->key);
+      node = parent;
+    }
+  }
+
+  /**
+   * @brief Returns the node of @p name, or nullptr if it does not exist.
+   */
+  const Node*
+  find(const Name& name) const
+  {
+    const Node* node = &m_root;
+    for (const auto& comp : name) {
+      auto it = node->children.find(comp);
+      if (it == node->children.end()) {
+        return nullptr;
+      }
+      node = it->second.get();
+    }
+    return node;
+  }
+
+  /**
+   * @brief Visits the existing nodes of @p name and of its prefixes, from the root downward.
+   * @return the node of @p name, or nullptr if it does not exist
+   */
+  template<typename Visitor>
+  const Node*
+  visitPrefixes(const Name& name, const Visitor& visit) const
+  {
+    const Node* node = &m_root;
+    for (size_t i = 0; ; ++i) {
+      visit(*node);
+      if (i == name.size()) {
+        return node;
+      }
+      auto it = node->children.find(name[i]);
+      if (it == node->children.end()) {
+        return nullptr;
+      }
+      node = it->second.get();
+    }
+  }
+
+private:
+  Node m_root;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_IMPL_NAME_TRIE_HPP
@@ -0,0 +1,42 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_PARALLEL_FOR_HPP
+#define NDN_CXX_IMPL_PARALLEL_FOR_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+namespace ndn::detail {
+
+/**
+ * @brief Invokes @p fn for every index in `[0, count)`, using up to @p nThreads threads.
+ *
+ * The calling thread is one of the threads, and the indexes are handed out one at a time, so that
+ * threads that run faster take more of them. The function returns once every invocation has
+ * returned. If an invocation throws, the remaining indexes are skipped and the first exception
+ * is rethrown in the calling thread.
+ */
+void
+parallelFor(size_t count, size_t nThreads, const std::function<void(size_t)>& fn);
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_IMPL_PARALLEL_FOR_HPP
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/pending-interest-index.hpp"
+#include "ndn-cxx/impl/pending-interest.hpp"
+
+#include <algorithm>
+
+namespace ndn::detail {
+
+Name
+PendingInterestIndex::makeExactKey(const Name& interestName)
+{
+  if (!interestName.empty() && interestName[-1].isImplicitSha256Digest()) {
+    return interestName.getPrefix(-1);
+  }
+  return interestName;
+}
+
+void
+PendingInterestIndex::insert(PendingInterest& entry)
+{
+  BOOST_ASSERT(entry.m_index == nullptr);
+  const Interest& interest = *entry.getInterest();
+
+  if (!interest.getCanBePrefix()) {
+    m_exact.emplace(makeExactKey(interest.getName()), &entry);
+  }
+  else {
+    entry.m_indexNode = m_prefix.insert(interest.getName(), &entry);
+  }
+  entry.m_index = this;
+}
+
+void
+PendingInterestIndex::erase(PendingInterest& entry)
+{
+  BOOST_ASSERT(entry.m_index == this);
+  entry.m_index = nullptr;
+
+  Node* node = entry.m_indexNode;
+  if (node == nullptr) {
+    auto range = m_exact.equal_range(makeExactKey(entry.getInterest()->getName()));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == &entry) {
+        m_exact.erase(it);
+        return;
+      }
+    }
+    BOOST_ASSERT(false);
+    return;
+  }
+
+  entry.m_indexNode = nullptr;
+  m_prefix.erase(node, &entry);
+}
+
+std::vector<RecordId>
+PendingInterestIndex::findDataCandidates(const Name& dataName) const
+{
+  std::vector<RecordId> ids;
+
+  auto range = m_exact.equal_range(dataName);
+  for (auto it = range.first; it != range.second; ++it) {
+    ids.push_back(it->second->getId());
+  }
+
+  // Interests with CanBePrefix=true whose name is a prefix of the Data name
+  const Node* node = m_prefix.visitPrefixes(dataName, [&ids] (const Node& n) {
+    for (const auto* entry : n.entries) {
+      ids.push_back(entry->getId());
+    }
+  });
+  if (node != nullptr) {
+    // and those whose name is the full name of the Data; an implicit digest sorts before
+    // any other name component type
+    for (auto it = node->children.begin();
+         it != node->children.end() && it->first.isImplicitSha256Digest(); ++it) {
+      for (const auto* entry : it->second->entries) {
+        ids.push_back(entry->getId());
+      }
+    }
+  }
+
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+std::vector<RecordId>
+PendingInterestIndex::findNackCandidates(const Name& interestName) const
+{
+  std::vector<RecordId> ids;
+
+  auto range = m_exact.equal_range(makeExactKey(interestName));
+  for (auto it = range.first; it != range.second; ++it) {
+    ids.push_back(it->second->getId());
+  }
+
+  if (const Node* node = m_prefix.find(interestName); node != nullptr) {
+    for (const auto* entry : node->entries) {
+      ids.push_back(entry->getId());
+    }
+  }
+
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+} // namespace ndn::detail
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_PENDING_INTEREST_INDEX_HPP
+#define NDN_CXX_IMPL_PENDING_INTEREST_INDEX_HPP
+
+#include "ndn-cxx/impl/name-trie.hpp"
+#include "ndn-cxx/impl/record-container.hpp"
+
+#include <unordered_map>
+
+namespace ndn {
+
+class PendingInterest;
+
+namespace detail {
+
+/**
+ * @brief Index of the pending Interest table by Interest name.
+ *
+ * Interests with CanBePrefix=false are kept in a hash table keyed by their name, without
+ * the trailing implicit digest if any, so that the Interests that may be satisfied by
+ * a Data are found with a single lookup of the Data name.
+ * Interests with CanBePrefix=true are kept in a name trie, which is walked along the Data name.
+ * Looking up a Data or a Nack thus takes time proportional to the length of its name,
+ * rather than to the number of pending Interests.
+ *
+ * The index returns candidates only; the caller still applies Interest::matchesData or
+ * Interest::matchesInterest. A PendingInterest removes itself from the index when destroyed.
+ */
+class PendingInterestIndex : noncopyable
+{
+public:
+  using Node = NameTrie<PendingInterest>::Node;
+
+  void
+  insert(PendingInterest& entry);
+
+  void
+  erase(PendingInterest& entry);
+
+  /**
+   * @brief Returns the IDs of the records whose Interest may be satisfied by a Data
+   *        named @p dataName, in increasing order.
+   */
+  std::vector<RecordId>
+  findDataCandidates(const Name& dataName) const;
+
+  /**
+   * @brief Returns the IDs of the records whose Interest may be named @p interestName,
+   *        in increasing order.
+   */
+  std::vector<RecordId>
+  findNackCandidates(const Name& interestName) const;
+
+private:
+  /**
+   * @brief Returns the key of an Interest with CanBePrefix=false in the hash table.
+   *
+   * An Interest whose name ends with an implicit digest is matched against the full name of
+   * a Data, hence it is keyed by the Data name.
+   */
+  static Name
+  makeExactKey(const Name& interestName);
+
+private:
+  std::unordered_multimap<Name, PendingInterest*> m_exact;
+  NameTrie<PendingInterest> m_prefix;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_PENDING_INTEREST_INDEX_HPP
@@ -25,6 +25,7 @@
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/impl/pending-interest-index.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
@@ -86,6 +87,13 @@ public:
     scheduleTimeoutEvent(scheduler);
   }
 
+  ~PendingInterest()
+  {
+    if (m_index != nullptr) {
+      m_index->erase(*this);
+    }
+  }
+
   shared_ptr<const Interest>
   getInterest() const
   {
@@ -181,6 +189,11 @@ private:
   scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
   std::optional<lp::Nack> m_leastSevereNack;
+
+  detail::PendingInterestIndex* m_index = nullptr;
+  detail::PendingInterestIndex::Node* m_indexNode = nullptr; ///< nullptr if CanBePrefix=false
+
+  friend detail::PendingInterestIndex;
 };
 
 } // namespace ndn
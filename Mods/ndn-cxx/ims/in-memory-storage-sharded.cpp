@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+
+#include <boost/functional/hash.hpp>
+
+namespace ndn {
+
+InMemoryStorageSharded::InMemoryStorageSharded(size_t nShards, size_t byteLimit,
+                                               const ShardFactory& makeShard)
+  : m_nShards(nShards)
+  , m_shards(make_unique<Shard[]>(nShards))
+{
+  BOOST_ASSERT(m_nShards > 0);
+
+  // round up, so that a byte limit smaller than the number of shards still admits packets
+  size_t shardByteLimit = byteLimit / m_nShards + (byteLimit % m_nShards != 0);
+  for (size_t i = 0; i < m_nShards; ++i) {
+    if (makeShard) {
+      m_shards[i].storage = makeShard();
+    }
+    else {
+      m_shards[i].storage = make_unique<InMemoryStorageLru>(std::numeric_limits<size_t>::max());
+    }
+    m_shards[i].storage->setByteLimit(shardByteLimit);
+  }
+}
+
+InMemoryStorageSharded::~InMemoryStorageSharded() = default;
+
+size_t
+InMemoryStorageSharded::getShardIndex(const Name& name) const
+{
+  size_t nComponents = name.size();
+  if (nComponents > 0 && name[-1].isImplicitSha256Digest()) {
+    --nComponents;
+  }
+
+  // hash the components in place, rather than the wire encoding of a prefix copied from name
+  size_t seed = 0;
+  for (size_t i = 0; i < nComponents; ++i) {
+    boost::hash_combine(seed, name[i].type());
+    boost::hash_range(seed, name[i].value_begin(), name[i].value_end());
+  }
+  return seed % m_nShards;
+}
+
+void
+InMemoryStorageSharded::insert(const Data& data)
+{
+  Shard& shard = m_shards[getShardIndex(data.getName())];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.storage->insert(data);
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Interest& interest)
+{
+  if (!interest.getCanBePrefix()) {
+    Shard& shard = m_shards[getShardIndex(interest.getName())];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.storage->find(interest);
+  }
+
+  // each shard returns its leftmost match, hence the leftmost of those is the overall best match
+  shared_ptr<const Data> best;
+  for (size_t i = 0; i < m_nShards; ++i) {
+    shared_ptr<const Data> match;
+    {
+      std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+      match = m_shards[i].storage->find(interest);
+    }
+    if (match != nullptr && (best == nullptr || match->getFullName() < best->getFullName())) {
+      best = std::move(match);
+    }
+  }
+  return best;
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Name& name)
+{
+  Shard& shard = m_shards[getShardIndex(name)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.storage->find(name);
+}
+
+void
+InMemoryStorageSharded::erase(const Name& prefix, bool isPrefix)
+{
+  if (!isPrefix) {
+    Shard& shard = m_shards[getShardIndex(prefix)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.storage->erase(prefix, false);
+    return;
+  }
+
+  for (size_t i = 0; i < m_nShards; ++i) {
+    std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+    m_shards[i].storage->erase(prefix, true);
+  }
+}
+
+size_t
+InMemoryStorageSharded::size() const
+{
+  size_t n = 0;
+  for (size_t i = 0; i < m_nShards; ++i) {
+    std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+    n += m_shards[i].storage->size();
+  }
+  return n;
+}
+
+size_t
+InMemoryStorageSharded::getNBytes() const
+{
+  size_t n = 0;
+  for (size_t i = 0; i < m_nShards; ++i) {
+    std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+    n += m_shards[i].storage->getNBytes();
+  }
+  return n;
+}
+
+} // namespace ndn
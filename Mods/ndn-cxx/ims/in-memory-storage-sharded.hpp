@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <functional>
+#include <mutex>
+
+namespace ndn {
+
+/** @brief Provides in-memory storage that can be accessed concurrently from multiple threads.
+ *
+ *  Packets are partitioned among a fixed number of shards by a hash of their names, without
+ *  the implicit digest. Each shard is an InMemoryStorage guarded by its own mutex, hence
+ *  threads that access different shards do not contend with each other. The replacement policy
+ *  of every shard is determined by the InMemoryStorage subclass it is created as, and operates
+ *  within that shard only.
+ *
+ *  The capacity is expressed in octets of wire encoding, and divided evenly among the shards.
+ *
+ *  @note An Interest with CanBePrefix is looked up in every shard, in turn.
+ *  @note The shards must not be created with an io_service: a MustBeFresh processing window
+ *        relies on a Scheduler, which cannot be shared by multiple threads. Consequently, all
+ *        stored packets are considered fresh.
+ */
+class InMemoryStorageSharded : noncopyable
+{
+public:
+  /** @brief Creates the storage of one shard.
+   *
+   *  The returned storage should have no packet limit; it is given a byte limit afterwards.
+   */
+  using ShardFactory = std::function<unique_ptr<InMemoryStorage>()>;
+
+  /** @brief Create an InMemoryStorageSharded.
+   *  @param nShards number of shards, must be positive
+   *  @param byteLimit maximum total wire size of the stored packets, in octets
+   *  @param makeShard creates each shard; if empty, the shards employ LRU replacement policy
+   */
+  InMemoryStorageSharded(size_t nShards, size_t byteLimit, const ShardFactory& makeShard = nullptr);
+
+  ~InMemoryStorageSharded();
+
+  /** @brief Inserts a Data packet into its shard.
+   *  @param data the packet to insert, must be owned by a shared_ptr, signed, and have wire encoding
+   *  @sa InMemoryStorage::insert
+   */
+  void
+  insert(const Data& data);
+
+  /** @brief Finds the best match Data for an Interest.
+   *
+   *  If the Interest has CanBePrefix, the leftmost match across all shards is returned.
+   *  @sa InMemoryStorage::find(const Interest&)
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /** @brief Finds a Data whose name, with implicit digest, starts with @p name.
+   *
+   *  Only the shard of @p name is searched, hence @p name must be the name of a Data packet,
+   *  with or without implicit digest.
+   *  @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /** @brief Deletes in-memory storage entries by prefix by default.
+   *
+   *  If @p isPrefix is true, every shard is searched; otherwise, @p prefix must be a full name.
+   *  @sa InMemoryStorage::erase
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /** @return Number of packets stored in all shards.
+   */
+  size_t
+  size() const;
+
+  /** @return Total wire size of the packets stored in all shards, in octets.
+   */
+  size_t
+  getNBytes() const;
+
+  size_t
+  getNShards() const
+  {
+    return m_nShards;
+  }
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** @brief Returns the index of the shard responsible for @p name.
+   *
+   *  A trailing implicit digest is ignored, so that all packets with the same name, and
+   *  their full names, map to the same shard.
+   */
+  size_t
+  getShardIndex(const Name& name) const;
+
+private:
+  // aligned to keep the mutexes of adjacent shards off the same cache line
+  struct alignas(64) Shard
+  {
+    mutable std::mutex mutex;
+    unique_ptr<InMemoryStorage> storage;
+  };
+
+  size_t m_nShards;
+  unique_ptr<Shard[]> m_shards;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
@@ -157,6 +157,17 @@ InMemoryStorage::setCapacity(size_t capacity)
   BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
+void
+InMemoryStorage::setByteLimit(size_t nMaxBytes)
+{
+  m_byteLimit = nMaxBytes;
+  while (m_nBytes > m_byteLimit) {
+    if (!evictItem()) {
+      break;
+    }
+  }
+}
+
 void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
@@ -165,6 +176,17 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   if (it != m_cache.get<byFullName>().end())
     return;
 
+  // make room within the byte limit, if any
+  size_t dataSize = data.wireEncode().size();
+  if (dataSize > m_byteLimit) {
+    return;
+  }
+  while (m_nBytes + dataSize > m_byteLimit) {
+    if (!evictItem()) {
+      break;
+    }
+  }
+
   //if full, double the capacity
   bool doesReachLimit = (getLimit() == getCapacity());
   if (isFull() && !doesReachLimit) {
@@ -184,6 +206,7 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   InMemoryStorageEntry* entry = m_freeEntries.top();
   m_freeEntries.pop();
   m_nPackets++;
+  m_nBytes += dataSize;
   entry->setData(data);
   if (m_scheduler != nullptr && mustBeFreshProcessingWindow > ZERO_WINDOW) {
     entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
@@ -310,6 +333,7 @@ InMemoryStorage::selectChild(const Interest& interest,
 InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
+  m_nBytes -= (*it)->getData().wireEncode().size();
   // push the *empty* entry into mem pool
   (*it)->release();
   m_freeEntries.push(*it);
@@ -202,6 +202,31 @@ public:
     return m_nPackets;
   }
 
+  /** @return Maximum total wire size of the packets stored in in-memory storage, in octets.
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @brief Sets the maximum total wire size of the stored packets, in octets.
+   *
+   *  Packets are evicted according to the replacement policy until the storage fits in
+   *  @p nMaxBytes. Afterwards, insert() evicts packets to make room for the new one, and
+   *  ignores a packet larger than @p nMaxBytes.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** @return Total wire size of the packets stored in in-memory storage, in octets.
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
   /** @brief Returns begin iterator of the in-memory storage ordering by name with digest.
    *
    *  @return const_iterator pointing to the beginning of the m_cache
@@ -334,6 +359,10 @@ private:
   size_t m_capacity;
   /// current number of packets in in-memory storage
   size_t m_nPackets;
+  /// user defined maximum total wire size of the packets, in octets
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  /// current total wire size of the packets, in octets
+  size_t m_nBytes = 0;
   /// memory pool
   std::stack<InMemoryStorageEntry*> m_freeEntries;
   /// scheduler
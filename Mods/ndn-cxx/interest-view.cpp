@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/interest-view.hpp"
+
+namespace ndn {
+
+InterestView::InterestView(Block wire)
+  : m_wire(std::move(wire))
+{
+  if (m_wire.type() != tlv::Interest) {
+    NDN_THROW(Interest::Error("Interest", m_wire.type()));
+  }
+}
+
+void
+InterestView::locateElements() const
+{
+  if (m_isLocated) {
+    return;
+  }
+
+  // same element order rules as Interest::wireDecode, without decoding the elements
+  const uint8_t* pos = m_wire.value();
+  const uint8_t* const end = pos + m_wire.value_size();
+  int lastElement = 0; // last recognized element index, in spec order
+  while (pos != end) {
+    const uint8_t* elementBegin = pos;
+    uint32_t type = tlv::readType(pos, end);
+    uint64_t length = tlv::readVarNumber(pos, end);
+    if (length > static_cast<uint64_t>(end - pos)) {
+      NDN_THROW(Interest::Error("TLV-LENGTH of sub-element of type " + to_string(type) +
+                                " exceeds TLV-VALUE boundary of Interest"));
+    }
+    span<const uint8_t> value(pos, static_cast<size_t>(length));
+    pos += length;
+
+    if (lastElement == 0) {
+      if (type != tlv::Name) {
+        NDN_THROW(Interest::Error("Name element is missing or out of order"));
+      }
+      m_nameTlv = span<const uint8_t>(elementBegin, pos);
+      lastElement = 1;
+      continue;
+    }
+
+    switch (type) {
+      case tlv::CanBePrefix:
+        if (lastElement >= 2) {
+          NDN_THROW(Interest::Error("CanBePrefix element is out of order"));
+        }
+        m_canBePrefix = true;
+        lastElement = 2;
+        break;
+      case tlv::MustBeFresh:
+        if (lastElement >= 3) {
+          NDN_THROW(Interest::Error("MustBeFresh element is out of order"));
+        }
+        m_mustBeFresh = true;
+        lastElement = 3;
+        break;
+      case tlv::ForwardingHint:
+        if (lastElement >= 4) {
+          NDN_THROW(Interest::Error("ForwardingHint element is out of order"));
+        }
+        m_hasForwardingHint = true;
+        lastElement = 4;
+        break;
+      case tlv::Nonce:
+        if (lastElement >= 5) {
+          NDN_THROW(Interest::Error("Nonce element is out of order"));
+        }
+        m_nonce = value;
+        lastElement = 5;
+        break;
+      case tlv::InterestLifetime:
+        if (lastElement >= 6) {
+          NDN_THROW(Interest::Error("InterestLifetime element is out of order"));
+        }
+        m_lifetime = value;
+        lastElement = 6;
+        break;
+      case tlv::HopLimit:
+        if (lastElement < 7) { // HopLimit is non-critical, ignore out-of-order appearance
+          m_hopLimit = value;
+          lastElement = 7;
+        }
+        break;
+      case tlv::ApplicationParameters:
+        // ApplicationParameters is non-critical, ignore out-of-order appearance
+        if (lastElement < 8) {
+          m_parameters = value;
+          lastElement = 8;
+        }
+        break;
+      default:
+        if (tlv::isCriticalType(type)) {
+          NDN_THROW(Interest::Error("Unrecognized element of critical type " + to_string(type)));
+        }
+        break;
+    }
+  }
+
+  if (lastElement == 0) {
+    NDN_THROW(Interest::Error("Name element is missing or out of order"));
+  }
+  m_isLocated = true;
+}
+
+const Name&
+InterestView::getName() const
+{
+  if (!m_name) {
+    locateElements();
+    // the Name shares the wire buffer
+    auto nameBegin = std::next(m_wire.begin(), m_nameTlv.data() - m_wire.data());
+    Name name(Block(m_wire, nameBegin, std::next(nameBegin, m_nameTlv.size())));
+    if (name.empty()) {
+      NDN_THROW(Interest::Error("Name has zero name components"));
+    }
+    m_name = std::move(name);
+  }
+  return *m_name;
+}
+
+std::optional<Interest::Nonce>
+InterestView::getNonce() const
+{
+  locateElements();
+  if (!m_nonce) {
+    return std::nullopt;
+  }
+
+  Interest::Nonce nonce;
+  if (m_nonce->size() != nonce.size()) {
+    NDN_THROW(Interest::Error("Nonce element is malformed"));
+  }
+  std::copy(m_nonce->begin(), m_nonce->end(), nonce.begin());
+  return nonce;
+}
+
+time::milliseconds
+InterestView::getInterestLifetime() const
+{
+  locateElements();
+  if (!m_lifetime) {
+    return DEFAULT_INTEREST_LIFETIME;
+  }
+
+  const uint8_t* pos = m_lifetime->data();
+  return time::milliseconds(tlv::readNonNegativeInteger(m_lifetime->size(), pos,
+                                                        pos + m_lifetime->size()));
+}
+
+std::optional<uint8_t>
+InterestView::getHopLimit() const
+{
+  locateElements();
+  if (!m_hopLimit) {
+    return std::nullopt;
+  }
+
+  if (m_hopLimit->size() != 1) {
+    NDN_THROW(Interest::Error("HopLimit element is malformed"));
+  }
+  return m_hopLimit->front();
+}
+
+} // namespace ndn
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_INTEREST_VIEW_HPP
+#define NDN_CXX_INTEREST_VIEW_HPP
+
+#include "ndn-cxx/interest.hpp"
+
+#include <optional>
+
+namespace ndn {
+
+/**
+ * @brief Read-only view of an %Interest packet that decodes its fields on demand.
+ *
+ * Constructing an InterestView only checks the TLV-TYPE of the packet. The top-level elements
+ * are located on the first access to any field, and each field is decoded when it is first
+ * requested. Variable-length fields are returned as spans into the wire encoding, which the
+ * view keeps alive. Errors are reported as Interest::Error when the affected field, or the
+ * element structure as a whole, is first accessed.
+ *
+ * Use toInterest() to obtain a fully decoded Interest, e.g., when the packet is accepted.
+ */
+class InterestView
+{
+public:
+  /**
+   * @brief Creates a view of @p wire.
+   * @throw Interest::Error @p wire is not an Interest
+   */
+  explicit
+  InterestView(Block wire);
+
+  const Block&
+  getWire() const noexcept
+  {
+    return m_wire;
+  }
+
+  const Name&
+  getName() const;
+
+  bool
+  getCanBePrefix() const
+  {
+    locateElements();
+    return m_canBePrefix;
+  }
+
+  bool
+  getMustBeFresh() const
+  {
+    locateElements();
+    return m_mustBeFresh;
+  }
+
+  bool
+  hasForwardingHint() const
+  {
+    locateElements();
+    return m_hasForwardingHint;
+  }
+
+  std::optional<Interest::Nonce>
+  getNonce() const;
+
+  time::milliseconds
+  getInterestLifetime() const;
+
+  std::optional<uint8_t>
+  getHopLimit() const;
+
+  bool
+  hasApplicationParameters() const
+  {
+    locateElements();
+    return m_parameters.has_value();
+  }
+
+  /**
+   * @brief Returns the TLV-VALUE of ApplicationParameters, or an empty span if absent.
+   */
+  span<const uint8_t>
+  getApplicationParameters() const
+  {
+    locateElements();
+    return m_parameters.value_or(span<const uint8_t>{});
+  }
+
+  /**
+   * @brief Decodes the whole packet.
+   * @throw Interest::Error the packet is malformed
+   */
+  shared_ptr<Interest>
+  toInterest() const
+  {
+    return std::make_shared<Interest>(m_wire);
+  }
+
+private:
+  void
+  locateElements() const;
+
+private:
+  Block m_wire;
+
+  mutable bool m_isLocated = false;
+  // the following fields are valid after locateElements()
+  mutable span<const uint8_t> m_nameTlv;
+  mutable bool m_canBePrefix = false;
+  mutable bool m_mustBeFresh = false;
+  mutable bool m_hasForwardingHint = false;
+  // TLV-VALUE of optional elements
+  mutable std::optional<span<const uint8_t>> m_nonce;
+  mutable std::optional<span<const uint8_t>> m_lifetime;
+  mutable std::optional<span<const uint8_t>> m_hopLimit;
+  mutable std::optional<span<const uint8_t>> m_parameters;
+
+  mutable std::optional<Name> m_name;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_INTEREST_VIEW_HPP
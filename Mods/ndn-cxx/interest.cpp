@@ -22,6 +22,7 @@
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/impl/buffer-pool.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
@@ -459,12 +460,49 @@ Interest::setInterestLifetime(time::milliseconds lifetime)
   return *this;
 }
 
+/**
+ * @brief Rewrites the TLV-VALUE of the HopLimit element in a copy of the wire encoding.
+ * @return false if @p wire has no HopLimit element that can be rewritten in place
+ *
+ * The buffer of @p wire may be shared with other packets, as well as with the already decoded
+ * fields of the Interest, therefore it is copied rather than modified. This is still much cheaper
+ * than encoding the Interest again, in particular when it carries large ApplicationParameters.
+ */
+static bool
+patchHopLimit(Block& wire, uint8_t hopLimit)
+{
+  if (!wire.hasWire()) {
+    return false;
+  }
+  wire.parse();
+  auto element = wire.find(tlv::HopLimit);
+  if (element == wire.elements_end() || element->value_size() != 1) {
+    return false;
+  }
+
+  auto buffer = detail::makePooledBuffer(wire.size());
+  std::copy(wire.begin(), wire.end(), buffer->begin());
+  (*buffer)[static_cast<size_t>(element->value() - wire.data())] = hopLimit;
+
+  auto begin = buffer->cbegin();
+  auto end = std::next(begin, wire.size());
+  auto valueBegin = std::next(begin, wire.value() - wire.data());
+  Block patched(std::move(buffer), wire.type(), begin, end, valueBegin, end);
+  patched.parse();
+  wire = std::move(patched);
+  return true;
+}
+
 Interest&
 Interest::setHopLimit(std::optional<uint8_t> hopLimit)
 {
   if (hopLimit != m_hopLimit) {
+    // HopLimit is not covered by the parameters digest nor by the signature,
+    // so replacing its value does not invalidate the rest of the encoding
+    if (!hopLimit || !m_hopLimit || !patchHopLimit(m_wire, *hopLimit)) {
+      m_wire.reset();
+    }
     m_hopLimit = hopLimit;
-    m_wire.reset();
   }
   return *this;
 }
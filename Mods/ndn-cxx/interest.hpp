@@ -299,6 +299,10 @@ public: // Interest fields
    * @brief Set the %Interest's hop limit.
    *
    * Use `setHopLimit(std::nullopt)` to remove any hop limit from the Interest.
+   *
+   * If the Interest has a wire encoding that already contains a HopLimit element, the new value
+   * is written into a copy of that encoding, so that the Interest does not need to be encoded
+   * again. Adding or removing the hop limit discards the wire encoding.
    */
   Interest&
   setHopLimit(std::optional<uint8_t> hopLimit);
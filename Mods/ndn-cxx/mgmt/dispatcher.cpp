@@ -48,6 +48,7 @@ Dispatcher::Dispatcher(Face& face, KeyChain& keyChain,
   , m_keyChain(keyChain)
   , m_signingInfo(signingInfo)
   , m_storage(m_face.getIoService(), imsCapacity)
+  , m_notificationStorage(m_face.getIoService(), imsCapacity)
 {
 }
 
@@ -263,6 +264,13 @@ Dispatcher::processStatusDatasetInterest(const Name& prefix,
   bool endsWithVersionOrSegment = interestName.size() >= 1 &&
                                   (interestName[-1].isVersion() || interestName[-1].isSegment());
   if (endsWithVersionOrSegment) {
+    if (interestName[-1].isSegment()) {
+      // the segment may not have been produced yet, in which case it is sent when it is
+      auto it = m_ongoingDatasets.find(interestName.getPrefix(-1));
+      if (it != m_ongoingDatasets.end()) {
+        it->second.insert(interestName[-1].toSegment());
+      }
+    }
     return;
   }
 
@@ -276,14 +284,15 @@ Dispatcher::processAuthorizedStatusDatasetInterest(const Name& prefix,
                                                    const Interest& interest,
                                                    const StatusDatasetHandler& handler)
 {
-  StatusDatasetContext context(interest,
+  // the handler may keep the context alive to complete the response later
+  shared_ptr<StatusDatasetContext> context(new StatusDatasetContext(interest,
     [this] (auto&&... args) {
       sendStatusDatasetSegment(std::forward<decltype(args)>(args)...);
     },
     [this, interest] (auto&&... args) {
       sendControlResponse(std::forward<decltype(args)>(args)..., interest, true);
-    });
-  handler(prefix, interest, context);
+    }));
+  handler(prefix, interest, *context);
 }
 
 void
@@ -292,8 +301,22 @@ Dispatcher::sendStatusDatasetSegment(const Name& dataName, const Block& content,
   // the first segment will be sent to both places (the face and the in-memory storage)
   // other segments will be inserted to the in-memory storage only
   auto destination = SendDestination::IMS;
-  if (dataName[-1].toSegment() == 0) {
+  uint64_t segmentNo = dataName[-1].toSegment();
+  Name prefix = dataName.getPrefix(-1);
+  if (segmentNo == 0) {
     destination = SendDestination::FACE_AND_IMS;
+    if (!isFinalBlock) {
+      m_ongoingDatasets.try_emplace(prefix);
+    }
+  }
+  else if (auto it = m_ongoingDatasets.find(prefix); it != m_ongoingDatasets.end()) {
+    // a segment requested before it was produced is also sent to the face
+    if (it->second.erase(segmentNo) > 0) {
+      destination = SendDestination::FACE_AND_IMS;
+    }
+    if (isFinalBlock) {
+      m_ongoingDatasets.erase(it);
+    }
   }
 
   MetaInfo metaInfo;
@@ -305,7 +328,7 @@ Dispatcher::sendStatusDatasetSegment(const Name& dataName, const Block& content,
 }
 
 PostNotification
-Dispatcher::addNotificationStream(const PartialName& relPrefix)
+Dispatcher::addNotificationStream(const PartialName& relPrefix, const Name& topPrefix)
 {
   if (!m_topLevelPrefixes.empty()) {
     NDN_THROW(std::domain_error("one or more top-level prefix has been added"));
@@ -317,29 +340,54 @@ Dispatcher::addNotificationStream(const PartialName& relPrefix)
 
   // register a handler for the subscriber of this notification stream
   // keep silent if Interest does not match a stored notification
-  m_handlers[relPrefix] = [this] (auto&&... args) {
-    queryStorage(std::forward<decltype(args)>(args)..., nullptr);
+  m_handlers[relPrefix] = [this] (const Name&, const Interest& interest) {
+    auto data = m_notificationStorage.find(interest);
+    if (data != nullptr) {
+      sendOnFace(*data);
+    }
   };
   m_streams[relPrefix] = 0;
 
-  return [=] (const Block& b) { postNotification(b, relPrefix); };
+  return [=] (const Block& b) { postNotification(b, relPrefix, topPrefix); };
 }
 
 void
-Dispatcher::postNotification(const Block& notification, const PartialName& relPrefix)
+Dispatcher::postNotification(const Block& notification, const PartialName& relPrefix,
+                             const Name& topPrefix)
 {
-  if (m_topLevelPrefixes.size() != 1) {
+  Name streamName;
+  if (!topPrefix.empty()) {
+    if (m_topLevelPrefixes.count(topPrefix) == 0) {
+      NDN_LOG_WARN("postNotification: " << topPrefix << " is not a top-level prefix");
+      return;
+    }
+    streamName = topPrefix;
+  }
+  else if (m_topLevelPrefixes.size() != 1) {
     NDN_LOG_WARN("postNotification: no top-level prefix or too many top-level prefixes");
     return;
   }
+  else {
+    streamName = m_topLevelPrefixes.begin()->first;
+  }
 
-  Name streamName(m_topLevelPrefixes.begin()->first);
   streamName.append(relPrefix);
   streamName.appendSequenceNumber(m_streams[streamName]++);
 
+  auto data = make_shared<Data>(streamName);
+  data->setContent(notification).setFreshnessPeriod(1_s);
+  m_keyChain.sign(*data, m_signingInfo);
+
+  // notifications are kept in their own in-memory storage, so that a burst of notifications
+  // cannot evict the segments of a StatusDataset that is being retrieved
+  lp::CachePolicy policy;
+  policy.setPolicy(lp::CachePolicyType::NO_CACHE);
+  data->setTag(make_shared<lp::CachePolicyTag>(policy));
+  m_notificationStorage.insert(*data, 1_s);
+
   // notification is sent out via the face after inserting into the in-memory storage,
   // because a request may be pending in the PIT
-  sendData(streamName, notification, {}, SendDestination::FACE_AND_IMS);
+  sendOnFace(*data);
 }
 
 } // namespace ndn::mgmt
@@ -30,6 +30,7 @@
 #include "ndn-cxx/mgmt/status-dataset-context.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 
+#include <set>
 #include <unordered_map>
 
 namespace ndn::mgmt {
@@ -117,6 +118,10 @@ using ControlCommandHandler = std::function<void(const Name& prefix, const Inter
  *
  *  This function can generate zero or more blocks and pass them to \p append,
  *  and must call \p end upon completion.
+ *
+ *  The response may also be completed after the function returns, through a pointer obtained
+ *  from StatusDatasetContext::shared_from_this(). Interests for segments that have not been
+ *  produced yet are held by the Dispatcher until the segment is produced.
  */
 using StatusDatasetHandler = std::function<void(const Name& prefix, const Interest& interest,
                                                 StatusDatasetContext& context)>;
@@ -140,7 +145,8 @@ public:
    *  \param face the Face on which the dispatcher operates
    *  \param keyChain a KeyChain to sign Data
    *  \param signingInfo signing parameters to sign Data with \p keyChain
-   *  \param imsCapacity capacity of the internal InMemoryStorage used by dispatcher
+   *  \param imsCapacity capacity of each internal InMemoryStorage used by dispatcher;
+   *                     responses and notifications are stored separately
    */
   Dispatcher(Face& face, KeyChain& keyChain,
              const security::SigningInfo& signingInfo = security::SigningInfo(),
@@ -257,23 +263,27 @@ public: // NotificationStream
    *  \param relPrefix a prefix for this notification stream, e.g., "faces/events";
    *                   relPrefixes in ControlCommands, StatusDatasets, NotificationStreams must be
    *                   non-overlapping (no relPrefix is a prefix of another relPrefix)
+   *  \param topPrefix if not empty, the top-level prefix under which notifications are placed,
+   *                   which allows posting when more than one top-level prefix has been added
    *  \return a function into which notifications can be posted
    *  \pre no top-level prefix has been added
    *  \throw std::out_of_range \p relPrefix overlaps with an existing relPrefix
    *  \throw std::domain_error one or more top-level prefix has been added
    *
    *  Procedure for posting a notification:
-   *  1. if no top-level prefix has been added, or more than one top-level prefixes have been
-   *     added,
+   *  1. if \p topPrefix is not empty and has not been added as a top-level prefix, or
+   *     \p topPrefix is empty and either no top-level prefix or more than one top-level
+   *     prefixes have been added,
    *     abort these steps and log an error
    *  2. assign the next sequence number to the notification
-   *  3. place the notification block into one Data packet under the sole top-level prefix
+   *  3. place the notification block into one Data packet under \p topPrefix, or under the
+   *     sole top-level prefix
    *  4. sign the Data packet
    *  5. if the Data packet is too large, abort these steps and log an error
    *  6. send the signed Data packet
    */
   PostNotification
-  addNotificationStream(const PartialName& relPrefix);
+  addNotificationStream(const PartialName& relPrefix, const Name& topPrefix = {});
 
 private:
   using InterestHandler = std::function<void(const Name& prefix, const Interest&)>;
@@ -429,7 +439,8 @@ private:
   sendStatusDatasetSegment(const Name& dataName, const Block& content, bool isFinalBlock);
 
   void
-  postNotification(const Block& notification, const PartialName& relPrefix);
+  postNotification(const Block& notification, const PartialName& relPrefix,
+                   const Name& topPrefix);
 
 private:
   struct TopPrefixEntry
@@ -448,8 +459,12 @@ private:
   // NotificationStream name => next sequence number
   std::unordered_map<Name, uint64_t> m_streams;
 
+  // versioned prefix of a StatusDataset being produced => requested segments not produced yet
+  std::unordered_map<Name, std::set<uint64_t>> m_ongoingDatasets;
+
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   InMemoryStorageFifo m_storage;
+  InMemoryStorageFifo m_notificationStorage;
 };
 
 template<typename CP>
@@ -153,6 +153,75 @@ Controller::fetchDataset(const Name& prefix,
   fetcher->onError.connect([this, it] (auto&&...) { m_fetchers.erase(it); });
 }
 
+/**
+ * \brief Returns the length of the longest prefix of \p buffer that consists of complete TLV elements.
+ */
+static size_t
+getCompleteElementsLength(const Buffer& buffer) noexcept
+{
+  auto pos = buffer.begin();
+  auto completeEnd = pos;
+  while (pos != buffer.end()) {
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!tlv::readType(pos, buffer.end(), type) ||
+        !tlv::readVarNumber(pos, buffer.end(), length) ||
+        length > static_cast<uint64_t>(std::distance(pos, buffer.end()))) {
+      break;
+    }
+    pos += length;
+    completeEnd = pos;
+  }
+  return static_cast<size_t>(std::distance(buffer.begin(), completeEnd));
+}
+
+void
+Controller::fetchDatasetStream(const Name& prefix,
+                               const std::function<bool(ConstBufferPtr)>& processEntries,
+                               const std::function<void()>& onComplete,
+                               const DatasetFailureCallback& onFailure,
+                               const CommandOptions& options)
+{
+  SegmentFetcher::Options fetcherOptions;
+  fetcherOptions.maxTimeout = options.getTimeout();
+  fetcherOptions.inOrder = true;
+
+  auto fetcher = SegmentFetcher::start(m_face, Interest(prefix), m_validator, fetcherOptions);
+  auto it = m_fetchers.insert(fetcher).first;
+  // octets of an entry that continues in the next segment
+  auto partial = std::make_shared<Buffer>();
+
+  fetcher->onInOrderData.connect([this, it, partial, processEntries] (ConstBufferPtr segment) {
+    partial->insert(partial->end(), segment->begin(), segment->end());
+    size_t length = getCompleteElementsLength(*partial);
+    if (length == 0) {
+      return;
+    }
+
+    auto entries = std::make_shared<Buffer>(partial->begin(), partial->begin() + length);
+    partial->erase(partial->begin(), partial->begin() + length);
+    if (!processEntries(std::move(entries))) {
+      (*it)->stop();
+      m_fetchers.erase(it);
+    }
+  });
+  fetcher->onInOrderComplete.connect([this, it, partial, onComplete, onFailure] {
+    m_fetchers.erase(it);
+    if (!partial->empty()) {
+      if (onFailure)
+        onFailure(ERROR_SERVER, "Dataset decoding failure: truncated element");
+      return;
+    }
+    if (onComplete)
+      onComplete();
+  });
+  fetcher->onError.connect([this, it, onFailure] (uint32_t code, const std::string& msg) {
+    m_fetchers.erase(it);
+    if (onFailure)
+      processDatasetFetchError(onFailure, code, msg);
+  });
+}
+
 void
 Controller::processDatasetFetchError(const DatasetFailureCallback& onFailure,
                                      uint32_t code, std::string msg)
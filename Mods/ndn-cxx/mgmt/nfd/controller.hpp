@@ -124,6 +124,39 @@ public:
     fetchDataset(Dataset(std::forward<ParamType>(param)), onSuccess, onFailure, options);
   }
 
+  /**
+   * \brief Start dataset fetching, and deliver the entries as the segments arrive.
+   *
+   * \p onEntries is invoked, in order, with the entries completed by each segment, so that a
+   * large dataset can be processed before it has been received entirely. \p onComplete is
+   * invoked after the last segment.
+   */
+  template<typename Dataset>
+  std::enable_if_t<std::is_default_constructible_v<Dataset>>
+  fetchStream(const DatasetSuccessCallback<Dataset>& onEntries,
+              const std::function<void()>& onComplete,
+              const DatasetFailureCallback& onFailure,
+              const CommandOptions& options = {})
+  {
+    fetchDatasetStream(Dataset(), onEntries, onComplete, onFailure, options);
+  }
+
+  /**
+   * \brief Start dataset fetching, and deliver the entries as the segments arrive.
+   * \sa fetchStream(const DatasetSuccessCallback<Dataset>&, const std::function<void()>&,
+   *                 const DatasetFailureCallback&, const CommandOptions&)
+   */
+  template<typename Dataset, typename ParamType>
+  void
+  fetchStream(ParamType&& param,
+              const DatasetSuccessCallback<Dataset>& onEntries,
+              const std::function<void()>& onComplete,
+              const DatasetFailureCallback& onFailure,
+              const CommandOptions& options = {})
+  {
+    fetchDatasetStream(Dataset(std::forward<ParamType>(param)), onEntries, onComplete, onFailure, options);
+  }
+
 private:
   void
   startCommand(const shared_ptr<ControlCommand>& command,
@@ -157,6 +190,24 @@ private:
                const DatasetFailureCallback& onFailure,
                const CommandOptions& options);
 
+  template<typename Dataset>
+  void
+  fetchDatasetStream(Dataset&& dataset,
+                     const DatasetSuccessCallback<Dataset>& onEntries,
+                     const std::function<void()>& onComplete,
+                     const DatasetFailureCallback& onFailure,
+                     const CommandOptions& options);
+
+  /**
+   * \param processEntries invoked with complete TLV elements only; returns false to stop fetching
+   */
+  void
+  fetchDatasetStream(const Name& prefix,
+                     const std::function<bool(ConstBufferPtr)>& processEntries,
+                     const std::function<void()>& onComplete,
+                     const DatasetFailureCallback& onFailure,
+                     const CommandOptions& options);
+
   static void
   processDatasetFetchError(const DatasetFailureCallback& onFailure, uint32_t code, std::string msg);
 
@@ -209,6 +260,33 @@ Controller::fetchDataset(Dataset&& dataset,
     onFailure, options);
 }
 
+template<typename Dataset>
+void
+Controller::fetchDatasetStream(Dataset&& dataset,
+                               const DatasetSuccessCallback<Dataset>& onEntries,
+                               const std::function<void()>& onComplete,
+                               const DatasetFailureCallback& onFailure,
+                               const CommandOptions& options)
+{
+  Name prefix = dataset.getDatasetPrefix(options.getPrefix());
+  fetchDatasetStream(prefix,
+    [=, dataset = std::forward<Dataset>(dataset)] (ConstBufferPtr payload) {
+      std::invoke_result_t<decltype(&Dataset::parseResult), Dataset, ConstBufferPtr> result;
+      try {
+        result = dataset.parseResult(std::move(payload));
+      }
+      catch (const tlv::Error& e) {
+        if (onFailure)
+          onFailure(ERROR_SERVER, "Dataset decoding failure: "s + e.what());
+        return false;
+      }
+      if (onEntries)
+        onEntries(result);
+      return true;
+    },
+    onComplete, onFailure, options);
+}
+
 } // namespace nfd
 } // namespace ndn
 
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/mgmt/nfd/fib-event-notification.hpp"
+
+namespace ndn::nfd {
+
+FibEventNotification::FibEventNotification() = default;
+
+FibEventNotification::FibEventNotification(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+FibEventNotification&
+FibEventNotification::setNextHop(const NextHopRecord& nexthop)
+{
+  m_wire.reset();
+  m_nextHop = nexthop;
+  return *this;
+}
+
+template<encoding::Tag TAG>
+size_t
+FibEventNotification::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  totalLength += m_nextHop.wireEncode(encoder);
+  totalLength += prependCommonFields(encoder);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::nfd::FibEventNotification);
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(FibEventNotification);
+
+const Block&
+FibEventNotification::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+FibEventNotification::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::nfd::FibEventNotification) {
+    NDN_THROW(Error("FibEventNotification", block.type()));
+  }
+
+  m_wire = block;
+  m_wire.parse();
+  auto val = m_wire.elements_begin();
+
+  decodeCommonFields(val, m_wire.elements_end());
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NextHopRecord) {
+    m_nextHop.wireDecode(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("missing required NextHopRecord field"));
+  }
+}
+
+bool
+operator==(const FibEventNotification& a, const FibEventNotification& b)
+{
+  return a.getKind() == b.getKind() &&
+      a.getSequence() == b.getSequence() &&
+      a.getName() == b.getName() &&
+      a.getNextHop() == b.getNextHop();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const FibEventNotification& notification)
+{
+  return os << "FibEvent(Kind: " << notification.getKind()
+            << ", Sequence: " << notification.getSequence()
+            << ", Name: " << notification.getName()
+            << ", " << notification.getNextHop() << ")";
+}
+
+} // namespace ndn::nfd
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/mgmt/nfd/rib-event-notification.hpp"
+
+namespace ndn::nfd {
+
+RibEventNotification::RibEventNotification() = default;
+
+RibEventNotification::RibEventNotification(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+RibEventNotification&
+RibEventNotification::setRoute(const Route& route)
+{
+  m_wire.reset();
+  m_route = route;
+  return *this;
+}
+
+template<encoding::Tag TAG>
+size_t
+RibEventNotification::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  totalLength += m_route.wireEncode(encoder);
+  totalLength += prependCommonFields(encoder);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::nfd::RibEventNotification);
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(RibEventNotification);
+
+const Block&
+RibEventNotification::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+RibEventNotification::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::nfd::RibEventNotification) {
+    NDN_THROW(Error("RibEventNotification", block.type()));
+  }
+
+  m_wire = block;
+  m_wire.parse();
+  auto val = m_wire.elements_begin();
+
+  decodeCommonFields(val, m_wire.elements_end());
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Route) {
+    m_route.wireDecode(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("missing required Route field"));
+  }
+}
+
+bool
+operator==(const RibEventNotification& a, const RibEventNotification& b)
+{
+  return a.getKind() == b.getKind() &&
+      a.getSequence() == b.getSequence() &&
+      a.getName() == b.getName() &&
+      a.getRoute() == b.getRoute();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const RibEventNotification& notification)
+{
+  return os << "RibEvent(Kind: " << notification.getKind()
+            << ", Sequence: " << notification.getSequence()
+            << ", Name: " << notification.getName()
+            << ", " << notification.getRoute() << ")";
+}
+
+} // namespace ndn::nfd
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_MGMT_NFD_RIB_EVENT_NOTIFICATION_HPP
+#define NDN_CXX_MGMT_NFD_RIB_EVENT_NOTIFICATION_HPP
+
+#include "ndn-cxx/mgmt/nfd/rib-entry.hpp"
+#include "ndn-cxx/mgmt/nfd/route-event-traits.hpp"
+
+namespace ndn::nfd {
+
+/**
+ * \ingroup management
+ * \brief Represents a RIB route change notification.
+ */
+class RibEventNotification : public RouteEventTraits<RibEventNotification>
+{
+public:
+  RibEventNotification();
+
+  explicit
+  RibEventNotification(const Block& block);
+
+  const Route&
+  getRoute() const
+  {
+    return m_route;
+  }
+
+  RibEventNotification&
+  setRoute(const Route& route);
+
+  /** \brief Prepend RibEventNotification to the encoder.
+   */
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder) const;
+
+  /** \brief Encode RibEventNotification.
+   */
+  const Block&
+  wireEncode() const;
+
+  /** \brief Decode RibEventNotification.
+   */
+  void
+  wireDecode(const Block& wire);
+
+private:
+  Route m_route;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(RibEventNotification);
+
+bool
+operator==(const RibEventNotification& a, const RibEventNotification& b);
+
+inline bool
+operator!=(const RibEventNotification& a, const RibEventNotification& b)
+{
+  return !(a == b);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const RibEventNotification& notification);
+
+} // namespace ndn::nfd
+
+#endif // NDN_CXX_MGMT_NFD_RIB_EVENT_NOTIFICATION_HPP
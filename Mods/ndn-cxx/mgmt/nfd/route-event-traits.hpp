@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2023 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_MGMT_NFD_ROUTE_EVENT_TRAITS_HPP
+#define NDN_CXX_MGMT_NFD_ROUTE_EVENT_TRAITS_HPP
+
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/nfd-constants.hpp"
+#include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/name.hpp"
+
+namespace ndn::nfd {
+
+/**
+ * \ingroup management
+ * \brief Provides getters and setters for the fields shared by FIB and RIB notifications.
+ * \tparam C The concrete subclass
+ *
+ * The sequence number is assigned by the forwarder and increases by one with each
+ * notification of a stream, so that a subscriber can detect notifications it has missed.
+ */
+template<class C>
+class RouteEventTraits
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  RouteEventKind
+  getKind() const
+  {
+    return m_kind;
+  }
+
+  C&
+  setKind(RouteEventKind kind)
+  {
+    m_wire.reset();
+    m_kind = kind;
+    return static_cast<C&>(*this);
+  }
+
+  uint64_t
+  getSequence() const
+  {
+    return m_sequence;
+  }
+
+  C&
+  setSequence(uint64_t sequence)
+  {
+    m_wire.reset();
+    m_sequence = sequence;
+    return static_cast<C&>(*this);
+  }
+
+  const Name&
+  getName() const
+  {
+    return m_name;
+  }
+
+  C&
+  setName(const Name& name)
+  {
+    m_wire.reset();
+    m_name = name;
+    return static_cast<C&>(*this);
+  }
+
+protected:
+  RouteEventTraits() = default;
+
+  /** \brief Prepend RouteEventKind, EventSequence, and Name to the encoder.
+   */
+  template<encoding::Tag TAG>
+  size_t
+  prependCommonFields(EncodingImpl<TAG>& encoder) const
+  {
+    size_t totalLength = 0;
+    totalLength += m_name.wireEncode(encoder);
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::EventSequence, m_sequence);
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::RouteEventKind, m_kind);
+    return totalLength;
+  }
+
+  /** \brief Decode RouteEventKind, EventSequence, and Name, advancing \p val past them.
+   */
+  void
+  decodeCommonFields(Block::element_const_iterator& val, Block::element_const_iterator end)
+  {
+    if (val != end && val->type() == tlv::nfd::RouteEventKind) {
+      m_kind = readNonNegativeIntegerAs<RouteEventKind>(*val);
+      ++val;
+    }
+    else {
+      NDN_THROW(Error("missing required RouteEventKind field"));
+    }
+
+    if (val != end && val->type() == tlv::nfd::EventSequence) {
+      m_sequence = readNonNegativeInteger(*val);
+      ++val;
+    }
+    else {
+      NDN_THROW(Error("missing required EventSequence field"));
+    }
+
+    if (val != end && val->type() == tlv::Name) {
+      m_name.wireDecode(*val);
+      ++val;
+    }
+    else {
+      NDN_THROW(Error("missing required Name field"));
+    }
+  }
+
+protected:
+  RouteEventKind m_kind = ROUTE_EVENT_NONE;
+  uint64_t m_sequence = 0;
+  Name m_name;
+
+  mutable Block m_wire;
+};
+
+} // namespace ndn::nfd
+
+#endif // NDN_CXX_MGMT_NFD_ROUTE_EVENT_TRAITS_HPP
@@ -118,6 +118,22 @@ FibDataset::FibDataset()
 {
 }
 
+FibDataset::FibDataset(const Name& prefix)
+  : StatusDatasetBase("fib/list")
+  , m_prefix(prefix)
+{
+}
+
+Name
+FibDataset::getDatasetPrefix(const Name& prefix) const
+{
+  Name name = StatusDatasetBase::getDatasetPrefix(prefix);
+  if (!m_prefix.empty()) {
+    name.append(m_prefix.wireEncode());
+  }
+  return name;
+}
+
 std::vector<FibEntry>
 FibDataset::parseResult(ConstBufferPtr payload) const
 {
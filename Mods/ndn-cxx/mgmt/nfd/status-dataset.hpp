@@ -164,8 +164,22 @@ class FibDataset : public StatusDatasetBase
 public:
   FibDataset();
 
+  /**
+   * \brief Constructs a dataset that only contains the entries under \p prefix.
+   *
+   * The prefix is appended to the dataset name as a component that holds a Name TLV.
+   */
+  explicit
+  FibDataset(const Name& prefix);
+
+  Name
+  getDatasetPrefix(const Name& prefix) const;
+
   std::vector<FibEntry>
   parseResult(ConstBufferPtr payload) const;
+
+private:
+  Name m_prefix;
 };
 
 /**
@@ -29,8 +29,11 @@ namespace ndn::mgmt {
 
 /**
  * \brief Provides a context for generating the response to a StatusDataset request.
+ *
+ * The context is owned by the Dispatcher through a shared pointer. A handler that produces the
+ * response over several turns of the io_service can keep the context alive with shared_from_this().
  */
-class StatusDatasetContext : noncopyable
+class StatusDatasetContext : noncopyable, public std::enable_shared_from_this<StatusDatasetContext>
 {
 public:
   /**
@@ -93,7 +96,7 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 private:
   friend class Dispatcher;
 
-  const Interest& m_interest;
+  const Interest m_interest;
   DataSender m_dataSender;
   NackSender m_nackSender;
   Name m_prefix;
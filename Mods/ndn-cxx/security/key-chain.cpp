@@ -39,6 +39,7 @@
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/impl/parallel-for.hpp"
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/random.hpp"
@@ -409,6 +410,33 @@ KeyChain::sign(Data& data, const SigningInfo& params)
   data.wireEncode(encoder, *sigValue);
 }
 
+void
+KeyChain::sign(span<const shared_ptr<Data>> packets, const SigningInfo& params, size_t nThreads)
+{
+  if (packets.empty()) {
+    return;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  auto signOne = [&] (size_t i) {
+    Data& data = *packets[i];
+    data.setSignatureInfo(sigInfo);
+    EncodingBuffer encoder;
+    data.wireEncode(encoder, true);
+
+    auto sigValue = sign({encoder}, keyName, params.getDigestAlgorithm());
+    data.wireEncode(encoder, *sigValue);
+  };
+
+  // the first packet is signed in the calling thread, which also makes the TPM load the
+  // private key, so that the other threads only look it up
+  signOne(0);
+  detail::parallelFor(packets.size() - 1, nThreads, [&] (size_t i) { signOne(i + 1); });
+}
+
 void
 KeyChain::sign(Interest& interest, const SigningInfo& params)
 {
@@ -299,6 +299,26 @@ public: // signing
   void
   sign(Data& data, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Sign several Data packets according to the same signing information, using up to
+   *        @p nThreads threads.
+   *
+   * The private key and the SignatureInfo are determined only once for the whole batch, in the
+   * same way as sign(Data&, const SigningInfo&). The packets are then encoded and signed in
+   * parallel, which is worthwhile for large batches such as the segments of an object.
+   *
+   * @param packets The Data packets to sign; each packet must be referenced only once
+   * @param params The signing parameters
+   * @param nThreads Maximum number of threads, including the calling thread
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   * @note The TPM back-end must allow a private key to be used by several threads at once,
+   *       which is the case of the file and memory back-ends.
+   */
+  void
+  sign(span<const shared_ptr<Data>> packets, const SigningInfo& params, size_t nThreads);
+
   /**
    * @brief Sign an Interest according to the supplied signing information.
    *
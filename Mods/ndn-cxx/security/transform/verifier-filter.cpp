@@ -108,7 +108,9 @@ VerifierFilter::finalize()
     if (EVP_DigestSignFinal(m_impl->ctx, hmacBuf->data(), &hmacLen) != 1)
       NDN_THROW(Error(getIndex(), "Failed to finalize HMAC"));
 
-    ok = CRYPTO_memcmp(hmacBuf->data(), m_impl->sig.data(), std::min(hmacLen, m_impl->sig.size())) == 0;
+    // a truncated signature must not match a prefix of the HMAC
+    ok = hmacLen == m_impl->sig.size() &&
+         CRYPTO_memcmp(hmacBuf->data(), m_impl->sig.data(), hmacLen) == 0;
   }
   else {
     ok = EVP_DigestVerifyFinal(m_impl->ctx, m_impl->sig.data(), m_impl->sig.size()) == 1;
@@ -30,6 +30,7 @@
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
@@ -76,6 +77,22 @@ verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transf
   return result;
 }
 
+bool
+verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transform::PrivateKey& hmacKey)
+{
+  bool result = false;
+  try {
+    using namespace transform;
+    bufferSource(blobs) >> verifierFilter(DigestAlgorithm::SHA256, hmacKey, sig)
+                        >> boolSink(result);
+  }
+  catch (const transform::Error&) {
+    return false;
+  }
+
+  return result;
+}
+
 bool
 verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, span<const uint8_t> key)
 {
@@ -146,6 +163,12 @@ verifySignature(const ParseResult& params, span<const uint8_t> key)
   return !params.bufs.empty() && verifySignature(params.bufs, params.sig, key);
 }
 
+static bool
+verifySignature(const ParseResult& params, const transform::PrivateKey& hmacKey)
+{
+  return !params.bufs.empty() && verifySignature(params.bufs, params.sig, hmacKey);
+}
+
 static bool
 verifySignature(const ParseResult& params, const tpm::Tpm& tpm, const Name& keyName,
                 DigestAlgorithm digestAlgorithm)
@@ -202,6 +225,18 @@ verifySignature(const Interest& interest, const transform::PublicKey& key)
   return verifySignature(parse(interest), key);
 }
 
+bool
+verifySignature(const Data& data, const transform::PrivateKey& hmacKey)
+{
+  return verifySignature(parse(data), hmacKey);
+}
+
+bool
+verifySignature(const Interest& interest, const transform::PrivateKey& hmacKey)
+{
+  return verifySignature(parse(interest), hmacKey);
+}
+
 bool
 verifySignature(const Data& data, const pib::Key& key)
 {
@@ -41,6 +41,7 @@ class Tpm;
 } // namespace tpm
 
 namespace transform {
+class PrivateKey;
 class PublicKey;
 } // namespace transform
 
@@ -87,6 +88,25 @@ verifySignature(const Data& data, const transform::PublicKey& key);
 [[nodiscard]] bool
 verifySignature(const Interest& interest, const transform::PublicKey& key);
 
+/**
+ * @brief Verify @p blobs using HMAC key @p hmacKey against @p sig.
+ */
+[[nodiscard]] bool
+verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transform::PrivateKey& hmacKey);
+
+/**
+ * @brief Verify @p data using HMAC key @p hmacKey.
+ */
+[[nodiscard]] bool
+verifySignature(const Data& data, const transform::PrivateKey& hmacKey);
+
+/**
+ * @brief Verify @p interest using HMAC key @p hmacKey.
+ * @note This method verifies only signature of the signed interest.
+ */
+[[nodiscard]] bool
+verifySignature(const Interest& interest, const transform::PrivateKey& hmacKey);
+
 /**
  * @brief Verify @p data using @p key.
  */
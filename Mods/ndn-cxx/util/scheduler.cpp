@@ -19,12 +19,107 @@
  * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
  */
 
+
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/impl/steady-timer.hpp"
 #include "ndn-cxx/util/scope.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <set>
+
 namespace ndn::scheduler {
 
+/** \brief Abstract container of the pending events of a Scheduler
+ */
+class Scheduler::EventQueue : noncopyable
+{
+public:
+  virtual
+  ~EventQueue() = default;
+
+  /** \brief Allocates an event, which is not yet inserted
+   */
+  virtual shared_ptr<EventInfo>
+  makeEvent(time::nanoseconds after, EventCallback&& callback) = 0;
+
+  /** \brief Inserts an event
+   *  \return whether the internal timer must be rescheduled, i.e., the new event has become
+   *          the first one to expire
+   */
+  virtual bool
+  insert(const shared_ptr<EventInfo>& info) = 0;
+
+  /** \brief Removes a pending event
+   *  \return whether the internal timer must be rescheduled, i.e., the event was the first
+   *          one to expire
+   */
+  virtual bool
+  erase(EventInfo& info) = 0;
+
+  virtual void
+  clear() = 0;
+
+  [[nodiscard]] virtual bool
+  empty() const = 0;
+
+  /** \brief Returns when the internal timer should expire next
+   *  \pre !empty()
+   */
+  [[nodiscard]] virtual time::steady_clock::time_point
+  getNextWakeup() const = 0;
+
+  /** \brief Removes and returns the first event that has expired at or before \p now
+   *  \return the event, or nullptr if no event has expired
+   */
+  virtual shared_ptr<EventInfo>
+  popExpired(time::steady_clock::time_point now) = 0;
+};
+
+class Scheduler::OrderedSetQueue final : public Scheduler::EventQueue
+{
+public:
+  class Compare
+  {
+  public:
+    bool
+    operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
+  };
+
+  using Set = std::multiset<shared_ptr<EventInfo>, Compare>;
+
+  shared_ptr<EventInfo>
+  makeEvent(time::nanoseconds after, EventCallback&& callback) final;
+
+  bool
+  insert(const shared_ptr<EventInfo>& info) final;
+
+  bool
+  erase(EventInfo& info) final;
+
+  void
+  clear() final
+  {
+    m_set.clear();
+  }
+
+  bool
+  empty() const final
+  {
+    return m_set.empty();
+  }
+
+  time::steady_clock::time_point
+  getNextWakeup() const final;
+
+  shared_ptr<EventInfo>
+  popExpired(time::steady_clock::time_point now) final;
+
+private:
+  Set m_set;
+};
+
 /** \brief Stores internal information about a scheduled event
  */
 class EventInfo : noncopyable
@@ -36,17 +131,488 @@ public:
   {
   }
 
-  [[nodiscard]] time::nanoseconds
-  expiresFromNow() const
-  {
-    return std::max(expireTime - time::steady_clock::now(), 0_ns);
-  }
-
 public:
   EventCallback callback;
-  Scheduler::EventQueue::const_iterator queueIt;
   time::steady_clock::time_point expireTime;
   bool isExpired = false;
+
+  // position in OrderedSetQueue
+  Scheduler::OrderedSetQueue::Set::const_iterator queueIt;
+
+  // position in TimingWheelQueue
+  enum class Location : uint8_t {
+    NONE,
+    WHEEL,
+    READY,
+  };
+  Location location = Location::NONE;
+  uint8_t level = 0;
+  uint8_t slot = 0;
+  uint64_t seq = 0;
+  EventInfo* prev = nullptr;
+  EventInfo* next = nullptr;
+  shared_ptr<EventInfo> self; ///< keeps the event alive while it is linked in the wheel
+};
+
+bool
+Scheduler::OrderedSetQueue::Compare::operator()(const shared_ptr<EventInfo>& a,
+                                                const shared_ptr<EventInfo>& b) const noexcept
+{
+  return a->expireTime < b->expireTime;
+}
+
+shared_ptr<EventInfo>
+Scheduler::OrderedSetQueue::makeEvent(time::nanoseconds after, EventCallback&& callback)
+{
+  return std::make_shared<EventInfo>(after, std::move(callback));
+}
+
+bool
+Scheduler::OrderedSetQueue::insert(const shared_ptr<EventInfo>& info)
+{
+  auto i = m_set.insert(info);
+  info->queueIt = i;
+  return i == m_set.begin();
+}
+
+bool
+Scheduler::OrderedSetQueue::erase(EventInfo& info)
+{
+  bool isFirst = info.queueIt == m_set.begin();
+  m_set.erase(info.queueIt);
+  return isFirst;
+}
+
+time::steady_clock::time_point
+Scheduler::OrderedSetQueue::getNextWakeup() const
+{
+  return (*m_set.begin())->expireTime;
+}
+
+shared_ptr<EventInfo>
+Scheduler::OrderedSetQueue::popExpired(time::steady_clock::time_point now)
+{
+  if (m_set.empty() || (*m_set.begin())->expireTime > now) {
+    return nullptr;
+  }
+
+  shared_ptr<EventInfo> info = *m_set.begin();
+  m_set.erase(m_set.begin());
+  return info;
+}
+
+namespace {
+
+/** \brief Free list of equally sized memory blocks
+ *
+ *  The pool hands out the storage of EventInfo objects together with their shared_ptr control
+ *  blocks. It is shared by the allocators copied into those control blocks, so that it stays
+ *  alive until the last EventId referring to one of its blocks is gone.
+ */
+class EventPool : noncopyable
+{
+public:
+  ~EventPool()
+  {
+    for (void* chunk : m_chunks) {
+      ::operator delete(chunk);
+    }
+  }
+
+  void*
+  allocate(size_t size)
+  {
+    if (m_blockSize == 0) {
+      m_blockSize = (std::max(size, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) /
+                    alignof(std::max_align_t) * alignof(std::max_align_t);
+    }
+    BOOST_ASSERT(size <= m_blockSize);
+
+    if (m_free == nullptr) {
+      auto chunk = static_cast<uint8_t*>(::operator new(m_blockSize * BLOCKS_PER_CHUNK));
+      m_chunks.push_back(chunk);
+      for (size_t i = BLOCKS_PER_CHUNK; i > 0; --i) {
+        deallocate(chunk + (i - 1) * m_blockSize);
+      }
+    }
+
+    FreeBlock* block = m_free;
+    m_free = block->next;
+    return block;
+  }
+
+  void
+  deallocate(void* p) noexcept
+  {
+    auto block = static_cast<FreeBlock*>(p);
+    block->next = m_free;
+    m_free = block;
+  }
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  static constexpr size_t BLOCKS_PER_CHUNK = 256;
+
+  size_t m_blockSize = 0;
+  FreeBlock* m_free = nullptr;
+  std::vector<void*> m_chunks;
+};
+
+template<typename T>
+class EventPoolAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  EventPoolAllocator(shared_ptr<EventPool> pool) noexcept
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  EventPoolAllocator(const EventPoolAllocator<U>& other) noexcept
+    : m_pool(other.m_pool)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(m_pool->allocate(sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (n != 1) {
+      return std::allocator<T>().deallocate(p, n);
+    }
+    m_pool->deallocate(p);
+  }
+
+  friend bool
+  operator==(const EventPoolAllocator& lhs, const EventPoolAllocator& rhs) noexcept
+  {
+    return lhs.m_pool == rhs.m_pool;
+  }
+
+  friend bool
+  operator!=(const EventPoolAllocator& lhs, const EventPoolAllocator& rhs) noexcept
+  {
+    return lhs.m_pool != rhs.m_pool;
+  }
+
+private:
+  shared_ptr<EventPool> m_pool;
+
+  template<typename U>
+  friend class EventPoolAllocator;
+};
+
+} // namespace
+
+/** \brief Hierarchical timing wheel
+ *
+ *  Time is divided into ticks of TICK. Level \c l of the wheel has 64 slots, each covering
+ *  64^l ticks. An event that expires at tick \c t is linked into the slot of the highest 6-bit
+ *  group in which \c t differs from the current tick; it moves to a lower level when the wheel
+ *  reaches its slot, and to the ready heap when the wheel reaches its tick. The ready heap
+ *  orders due events by expiration time, then by scheduling order.
+ *
+ *  The wheel always advances to the start of its earliest non-empty slot, so the internal timer
+ *  is set to that instant, or to the expiration time of the first ready event.
+ */
+class Scheduler::TimingWheelQueue final : public Scheduler::EventQueue
+{
+public:
+  TimingWheelQueue()
+    : m_pool(make_shared<EventPool>())
+    , m_origin(time::steady_clock::now())
+  {
+    m_slots.fill({});
+  }
+
+  ~TimingWheelQueue() final
+  {
+    clear();
+  }
+
+  shared_ptr<EventInfo>
+  makeEvent(time::nanoseconds after, EventCallback&& callback) final
+  {
+    return std::allocate_shared<EventInfo>(EventPoolAllocator<EventInfo>(m_pool),
+                                           after, std::move(callback));
+  }
+
+  bool
+  insert(const shared_ptr<EventInfo>& info) final
+  {
+    bool wasEmpty = empty();
+    auto oldWakeup = wasEmpty ? time::steady_clock::time_point::max() : getNextWakeup();
+
+    info->seq = m_nextSeq++;
+    ++m_size;
+    place(info);
+
+    return wasEmpty || getNextWakeup() < oldWakeup;
+  }
+
+  bool
+  erase(EventInfo& info) final
+  {
+    auto oldWakeup = getNextWakeup();
+    --m_size;
+
+    if (info.location == EventInfo::Location::WHEEL) {
+      unlink(info);
+      info.self.reset(); // the caller holds another reference
+    }
+    else {
+      // lazy deletion: the event stays in the heap until it reaches the top
+      BOOST_ASSERT(info.location == EventInfo::Location::READY);
+      info.isExpired = true;
+      info.callback = nullptr;
+      discardCanceledReady();
+    }
+
+    return empty() || getNextWakeup() != oldWakeup;
+  }
+
+  void
+  clear() final
+  {
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+      while (m_bitmaps[level] != 0) {
+        EventInfo* head = detachSlot(level, countTrailingZeros(m_bitmaps[level]));
+        while (head != nullptr) {
+          EventInfo* next = head->next;
+          head->location = EventInfo::Location::NONE;
+          head->self.reset();
+          head = next;
+        }
+      }
+    }
+    for (const auto& info : m_ready) {
+      info->location = EventInfo::Location::NONE;
+    }
+    m_ready.clear();
+    m_size = 0;
+  }
+
+  bool
+  empty() const final
+  {
+    return m_size == 0;
+  }
+
+  time::steady_clock::time_point
+  getNextWakeup() const final
+  {
+    BOOST_ASSERT(!empty());
+    if (!m_ready.empty()) {
+      return m_ready.front()->expireTime;
+    }
+    return m_origin + TICK * findNextSlotStart();
+  }
+
+  shared_ptr<EventInfo>
+  popExpired(time::steady_clock::time_point now) final
+  {
+    advance(now <= m_origin ? 0 : (now - m_origin) / TICK);
+
+    if (m_ready.empty() || m_ready.front()->expireTime > now) {
+      return nullptr;
+    }
+
+    std::pop_heap(m_ready.begin(), m_ready.end(), &isLater);
+    shared_ptr<EventInfo> info = std::move(m_ready.back());
+    m_ready.pop_back();
+    info->location = EventInfo::Location::NONE;
+    --m_size;
+    discardCanceledReady();
+    return info;
+  }
+
+private:
+  static constexpr time::nanoseconds TICK = 1_ms;
+  static constexpr size_t LEVEL_BITS = 6;
+  static constexpr size_t N_SLOTS = 1 << LEVEL_BITS;
+  static constexpr size_t N_LEVELS = 8;
+  static constexpr uint64_t NO_SLOT = std::numeric_limits<uint64_t>::max();
+
+  static int
+  countTrailingZeros(uint64_t x) noexcept
+  {
+    return __builtin_ctzll(x);
+  }
+
+  static int
+  findHighestBit(uint64_t x) noexcept
+  {
+    return 63 - __builtin_clzll(x);
+  }
+
+  static bool
+  isLater(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) noexcept
+  {
+    return a->expireTime > b->expireTime ||
+           (a->expireTime == b->expireTime && a->seq > b->seq);
+  }
+
+  /** \brief Returns the first tick at or after the expiration time of \p info
+   */
+  uint64_t
+  getExpireTick(const EventInfo& info) const
+  {
+    if (info.expireTime <= m_origin) {
+      return 0;
+    }
+    auto d = info.expireTime - m_origin;
+    return static_cast<uint64_t>((d + TICK - 1_ns) / TICK);
+  }
+
+  /** \brief Links \p info into the wheel, or pushes it into the ready heap if it is due
+   */
+  void
+  place(const shared_ptr<EventInfo>& info)
+  {
+    uint64_t tick = getExpireTick(*info);
+    if (tick <= m_currentTick) {
+      info->location = EventInfo::Location::READY;
+      m_ready.push_back(info);
+      std::push_heap(m_ready.begin(), m_ready.end(), &isLater);
+      return;
+    }
+
+    uint64_t diff = tick ^ m_currentTick;
+    if ((diff >> (LEVEL_BITS * N_LEVELS)) != 0) {
+      // beyond the span of the wheel: park the event in the last slot of the top level,
+      // from which it is placed again when the wheel gets there
+      tick = m_currentTick | ((uint64_t(1) << (LEVEL_BITS * N_LEVELS)) - 1);
+      diff = tick ^ m_currentTick;
+    }
+
+    size_t level = static_cast<size_t>(findHighestBit(diff)) / LEVEL_BITS;
+    size_t slot = (tick >> (LEVEL_BITS * level)) & (N_SLOTS - 1);
+
+    EventInfo*& head = m_slots[level * N_SLOTS + slot];
+    info->location = EventInfo::Location::WHEEL;
+    info->level = static_cast<uint8_t>(level);
+    info->slot = static_cast<uint8_t>(slot);
+    info->prev = nullptr;
+    info->next = head;
+    if (head != nullptr) {
+      head->prev = info.get();
+    }
+    head = info.get();
+    info->self = info;
+    m_bitmaps[level] |= uint64_t(1) << slot;
+  }
+
+  void
+  unlink(EventInfo& info) noexcept
+  {
+    EventInfo*& head = m_slots[info.level * N_SLOTS + info.slot];
+    if (info.prev != nullptr) {
+      info.prev->next = info.next;
+    }
+    else {
+      head = info.next;
+    }
+    if (info.next != nullptr) {
+      info.next->prev = info.prev;
+    }
+    if (head == nullptr) {
+      m_bitmaps[info.level] &= ~(uint64_t(1) << info.slot);
+    }
+    info.location = EventInfo::Location::NONE;
+    info.prev = info.next = nullptr;
+  }
+
+  EventInfo*
+  detachSlot(size_t level, size_t slot) noexcept
+  {
+    EventInfo* head = std::exchange(m_slots[level * N_SLOTS + slot], nullptr);
+    m_bitmaps[level] &= ~(uint64_t(1) << slot);
+    return head;
+  }
+
+  /** \brief Returns the first tick of the earliest non-empty slot, or NO_SLOT
+   *
+   *  Every event on a level expires after every event on the levels below, hence the earliest
+   *  non-empty slot is the first one on the lowest non-empty level.
+   */
+  uint64_t
+  findNextSlotStart() const noexcept
+  {
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+      if (m_bitmaps[level] != 0) {
+        uint64_t slot = static_cast<uint64_t>(countTrailingZeros(m_bitmaps[level]));
+        size_t shift = LEVEL_BITS * level;
+        uint64_t upperMask = ~((uint64_t(1) << (shift + LEVEL_BITS)) - 1);
+        return (m_currentTick & upperMask) | (slot << shift);
+      }
+    }
+    return NO_SLOT;
+  }
+
+  /** \brief Advances the wheel to \p tick, moving the events that become due to the ready heap
+   */
+  void
+  advance(uint64_t tick)
+  {
+    while (true) {
+      uint64_t slotStart = findNextSlotStart();
+      if (slotStart > tick) {
+        m_currentTick = std::max(m_currentTick, tick);
+        return;
+      }
+
+      // the wheel is empty between the current tick and slotStart
+      m_currentTick = slotStart;
+      size_t level = 0;
+      while (m_bitmaps[level] == 0) {
+        ++level;
+      }
+      EventInfo* head = detachSlot(level, countTrailingZeros(m_bitmaps[level]));
+      while (head != nullptr) {
+        EventInfo* next = head->next;
+        shared_ptr<EventInfo> info = std::move(head->self);
+        place(info);
+        head = next;
+      }
+    }
+  }
+
+  /** \brief Pops canceled events from the top of the ready heap
+   */
+  void
+  discardCanceledReady()
+  {
+    while (!m_ready.empty() && m_ready.front()->isExpired) {
+      std::pop_heap(m_ready.begin(), m_ready.end(), &isLater);
+      m_ready.back()->location = EventInfo::Location::NONE;
+      m_ready.pop_back();
+    }
+  }
+
+private:
+  shared_ptr<EventPool> m_pool;
+  const time::steady_clock::time_point m_origin;
+  uint64_t m_currentTick = 0;
+  uint64_t m_nextSeq = 0;
+  size_t m_size = 0;
+  std::array<uint64_t, N_LEVELS> m_bitmaps{};
+  std::array<EventInfo*, N_LEVELS * N_SLOTS> m_slots;
+  std::vector<shared_ptr<EventInfo>> m_ready; ///< min-heap of due events
 };
 
 EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
@@ -73,16 +639,18 @@ operator<<(std::ostream& os, const EventId& eventId)
   return os << eventId.m_info.lock();
 }
 
-bool
-Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
-                                         const shared_ptr<EventInfo>& b) const noexcept
-{
-  return a->expireTime < b->expireTime;
-}
-
-Scheduler::Scheduler(boost::asio::io_service& ioService)
+Scheduler::Scheduler(boost::asio::io_service& ioService, Backend backend)
   : m_timer(make_unique<detail::SteadyTimer>(ioService))
 {
+  switch (backend) {
+    case Backend::ORDERED_SET:
+      m_queue = make_unique<OrderedSetQueue>();
+      break;
+    case Backend::TIMING_WHEEL:
+      m_queue = make_unique<TimingWheelQueue>();
+      break;
+  }
+  BOOST_ASSERT(m_queue != nullptr);
 }
 
 Scheduler::~Scheduler() = default;
@@ -92,15 +660,13 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
-  auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
-  (*i)->queueIt = i;
-
-  if (!m_isEventExecuting && i == m_queue.begin()) {
+  auto info = m_queue->makeEvent(after, std::move(callback));
+  if (m_queue->insert(info) && !m_isEventExecuting) {
     // the new event is the first one to expire
     scheduleNext();
   }
 
-  return EventId(*this, *i);
+  return EventId(*this, info);
 }
 
 void
@@ -110,28 +676,27 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
     return;
   }
 
-  if (info->queueIt == m_queue.begin()) {
+  if (m_queue->erase(*info)) {
+    // the timer was set for the canceled event
     m_timer->cancel();
-  }
-  m_queue.erase(info->queueIt);
-
-  if (!m_isEventExecuting) {
-    scheduleNext();
+    if (!m_isEventExecuting) {
+      scheduleNext();
+    }
   }
 }
 
 void
 Scheduler::cancelAllEvents()
 {
-  m_queue.clear();
+  m_queue->clear();
   m_timer->cancel();
 }
 
 void
 Scheduler::scheduleNext()
 {
-  if (!m_queue.empty()) {
-    m_timer->expires_from_now((*m_queue.begin())->expiresFromNow());
+  if (!m_queue->empty()) {
+    m_timer->expires_from_now(std::max(m_queue->getNextWakeup() - time::steady_clock::now(), 0_ns));
     m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
   }
 }
@@ -151,14 +716,7 @@ Scheduler::executeEvent(const boost::system::error_code& error)
 
   // process all expired events
   auto now = time::steady_clock::now();
-  while (!m_queue.empty()) {
-    auto head = m_queue.begin();
-    shared_ptr<EventInfo> info = *head;
-    if (info->expireTime > now) {
-      break;
-    }
-
-    m_queue.erase(head);
+  while (auto info = m_queue->popExpired(now)) {
     info->isExpired = true;
     info->callback();
   }
@@ -27,7 +27,6 @@
 #include "ndn-cxx/util/time.hpp"
 
 #include <boost/system/error_code.hpp>
-#include <set>
 
 namespace ndn {
 
@@ -132,8 +131,26 @@ using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 class Scheduler : noncopyable
 {
 public:
+  /** \brief Data structure that keeps the pending events
+   */
+  enum class Backend {
+    /** \brief Balanced tree ordered by expiration time
+     *
+     *  An event is executed as soon as it expires. Scheduling and canceling an event take
+     *  logarithmic time.
+     */
+    ORDERED_SET,
+    /** \brief Hierarchical timing wheel with pool-allocated, intrusively linked events
+     *
+     *  Scheduling and canceling an event take constant time. An event is executed at the first
+     *  wheel tick (one millisecond) at or after its expiration time; events that become due at
+     *  the same tick are executed in order of expiration time.
+     */
+    TIMING_WHEEL,
+  };
+
   explicit
-  Scheduler(boost::asio::io_service& ioService);
+  Scheduler(boost::asio::io_service& ioService, Backend backend = Backend::ORDERED_SET);
 
   ~Scheduler();
 
@@ -166,15 +183,11 @@ private:
   executeEvent(const boost::system::error_code& code);
 
 private:
-  class EventQueueCompare
-  {
-  public:
-    bool
-    operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
-  };
+  class EventQueue;
+  class OrderedSetQueue;
+  class TimingWheelQueue;
 
-  using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
-  EventQueue m_queue;
+  unique_ptr<EventQueue> m_queue;
 
   unique_ptr<detail::SteadyTimer> m_timer;
   bool m_isEventExecuting = false;
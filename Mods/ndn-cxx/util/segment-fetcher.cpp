@@ -23,7 +23,6 @@
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
 
@@ -54,6 +53,15 @@ SegmentFetcher::Options::validate()
   if (mdCoef < 0.0 || mdCoef > 1.0) {
     NDN_THROW(std::invalid_argument("mdCoef must be in range [0, 1]"));
   }
+
+  if (!directBuffer.empty()) {
+    if (directSegmentSize == 0) {
+      NDN_THROW(std::invalid_argument("directSegmentSize must be greater than 0 in 'direct' mode"));
+    }
+    if (inOrder) {
+      NDN_THROW(std::invalid_argument("'in order' and 'direct' modes are mutually exclusive"));
+    }
+  }
 }
 
 SegmentFetcher::SegmentFetcher(Face& face,
@@ -125,7 +133,7 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
 
   int64_t availableWindowSize;
   if (m_options.inOrder) {
-    availableWindowSize = std::min<int64_t>(m_cwnd, m_options.flowControlWindow - m_segmentBuffer.size());
+    availableWindowSize = std::min<int64_t>(m_cwnd, m_options.flowControlWindow - m_nBufferedSegments);
   }
   else {
     availableWindowSize = static_cast<int64_t>(m_cwnd);
@@ -146,7 +154,7 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
       segmentsToRequest.emplace_back(pendingSegmentIt->first, true);
     }
     else if (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) {
-      if (m_segmentBuffer.count(m_nextSegmentNum) > 0) {
+      if (isSegmentReceived(m_nextSegmentNum)) {
         // Don't request a segment a second time if received in response to first "discovery" Interest
         m_nextSegmentNum++;
         continue;
@@ -221,7 +229,7 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
 
   // The first received Interest could have any segment ID
   std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt;
-  if (m_receivedSegments.size() > 0) {
+  if (m_nReceived > 0) {
     pendingSegmentIt = m_pendingSegments.find(currentSegment);
   }
   else {
@@ -241,6 +249,75 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
     [=] (const Data& d, const auto& error) { afterValidationFailure(d, error, weakSelf); });
 }
 
+bool
+SegmentFetcher::isSegmentReceived(uint64_t segNum) const
+{
+  if (segNum < m_receivedBase) {
+    return true;
+  }
+  auto index = segNum - m_receivedBase;
+  return index < m_receivedSegments.size() && m_receivedSegments[index];
+}
+
+void
+SegmentFetcher::markSegmentReceived(uint64_t segNum)
+{
+  if (segNum < m_receivedBase) {
+    return;
+  }
+  auto index = segNum - m_receivedBase;
+  if (index >= m_receivedSegments.size()) {
+    m_receivedSegments.resize(index + 1, false);
+  }
+  m_receivedSegments[index] = true;
+
+  // slide the window past the segments received without gap
+  while (!m_receivedSegments.empty() && m_receivedSegments.front()) {
+    m_receivedSegments.pop_front();
+    ++m_receivedBase;
+  }
+}
+
+void
+SegmentFetcher::storeSegment(uint64_t segNum, const Data& data)
+{
+  if (segNum < m_nextSegmentInOrder) {
+    return;
+  }
+  auto index = segNum - m_nextSegmentInOrder;
+  if (index >= m_segmentBuffer.size()) {
+    m_segmentBuffer.resize(index + 1);
+  }
+  if (!m_segmentBuffer[index].isValid()) {
+    ++m_nBufferedSegments;
+  }
+  // the Content element shares the buffer of the Data packet, so that no copy is made;
+  // a segment without content is stored as an empty Content element
+  m_segmentBuffer[index] = data.hasContent() ? data.getContent() : Block(tlv::Content);
+}
+
+bool
+SegmentFetcher::writeSegment(uint64_t segNum, const Data& data)
+{
+  auto content = data.getContent().value_bytes();
+  auto output = m_options.directBuffer;
+  auto segmentSize = m_options.directSegmentSize;
+  if (content.size() > segmentSize || content.size() > output.size() ||
+      segNum > (output.size() - content.size()) / segmentSize) {
+    return false;
+  }
+  // a segment other than the last one must fill its slot, otherwise the object would have a gap
+  if (content.size() < segmentSize && data.getFinalBlock() && data.getFinalBlock()->isSegment() &&
+      data.getFinalBlock()->toSegment() != segNum) {
+    return false;
+  }
+
+  auto offset = static_cast<size_t>(segNum) * segmentSize;
+  std::copy(content.begin(), content.end(), output.begin() + offset);
+  m_directObjectSize = std::max(m_directObjectSize, offset + content.size());
+  return true;
+}
+
 void
 SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInterest,
                                        std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
@@ -257,7 +334,7 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   // It was verified in afterSegmentReceivedCb that the last Data name component is a segment number
   uint64_t currentSegment = data.getName().get(-1).toSegment();
-  m_receivedSegments.insert(currentSegment);
+  markSegmentReceived(currentSegment);
 
   // Add measurement to RTO estimator (if not retransmission)
   if (pendingSegmentIt->second.state == SegmentState::FirstInterest) {
@@ -269,11 +346,15 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   // Remove from pending segments map
   m_pendingSegments.erase(pendingSegmentIt);
 
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.try_emplace(currentSegment, data.getContent().value_size())
-                           .first;
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt->second.begin());
+  if (!m_options.directBuffer.empty()) {
+    if (!writeSegment(currentSegment, data)) {
+      return signalError(SEGMENT_DOES_NOT_FIT, "Segment " + to_string(currentSegment) +
+                         " does not fit at its offset in the output buffer");
+    }
+  }
+  else {
+    storeSegment(currentSegment, data);
+  }
   m_nBytesReceived += data.getContent().value_size();
   afterSegmentValidated(data);
 
@@ -291,12 +372,15 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
     do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
-      m_segmentBuffer.erase(m_nextSegmentInOrder++);
-    } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
+      const Block& content = m_segmentBuffer.front();
+      onInOrderData(std::make_shared<const Buffer>(content.value_begin(), content.value_end()));
+      m_segmentBuffer.pop_front();
+      --m_nBufferedSegments;
+      ++m_nextSegmentInOrder;
+    } while (!m_segmentBuffer.empty() && m_segmentBuffer.front().isValid());
   }
 
-  if (m_receivedSegments.size() == 1) {
+  if (m_nReceived == 1) {
     m_versionedDataName = data.getName().getPrefix(-1);
     if (currentSegment == 0) {
       // We received the first segment in response, so we can increment the next segment number
@@ -392,7 +476,7 @@ SegmentFetcher::afterNackOrTimeout(const Interest& origInterest)
 
   m_rttEstimator.backoffRto();
 
-  if (m_receivedSegments.size() == 0) {
+  if (m_nReceived == 0) {
     // Resend first Interest (until maximum receive timeout exceeded)
     fetchFirstSegment(origInterest, true);
   }
@@ -409,16 +493,25 @@ SegmentFetcher::finalizeFetch()
   if (m_options.inOrder) {
     onInOrderComplete();
   }
+  else if (!m_options.directBuffer.empty()) {
+    onDirectComplete(m_directObjectSize);
+  }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
-    BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
+    BOOST_ASSERT(m_segmentBuffer.size() >= static_cast<uint64_t>(m_nSegments));
 
+    // Combine segments into final buffer, releasing each segment once it has been copied
+    size_t objectSize = 0;
+    for (int64_t i = 0; i < m_nSegments; i++) {
+      objectSize += m_segmentBuffer[i].value_size();
+    }
+    auto buf = std::make_shared<Buffer>(objectSize);
+    auto out = buf->begin();
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      out = std::copy(m_segmentBuffer[i].value_begin(), m_segmentBuffer[i].value_end(), out);
+      m_segmentBuffer[i] = {};
     }
-    onComplete(buf.buf());
+    onComplete(buf);
   }
   stop();
 }
@@ -499,8 +592,8 @@ SegmentFetcher::checkAllSegmentsReceived()
   if (m_nSegments != 0 && m_nReceived >= m_nSegments) {
     haveReceivedAllSegments = true;
     // Verify that all segments in window have been received. If not, send Interests for missing segments.
-    for (uint64_t i = 0; i < static_cast<uint64_t>(m_nSegments); i++) {
-      if (m_receivedSegments.count(i) == 0) {
+    for (uint64_t i = m_receivedBase; i < static_cast<uint64_t>(m_nSegments); i++) {
+      if (!isSegmentReceived(i)) {
         m_retxQueue.push(i);
         haveReceivedAllSegments = false;
       }
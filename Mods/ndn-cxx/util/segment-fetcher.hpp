@@ -27,9 +27,10 @@
 #include "ndn-cxx/util/rtt-estimator.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/signal/signal.hpp"
+#include "ndn-cxx/util/span.hpp"
 
+#include <deque>
 #include <queue>
-#include <set>
 
 namespace ndn {
 
@@ -61,7 +62,15 @@ namespace ndn {
  * 4. If set to 'block' mode, signal #onComplete passing a memory buffer that combines the content
  *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
  *    upon validation of each segment in segment order, storing later segments that arrived out of
- *    order internally until all earlier segments have arrived and have been validated.
+ *    order internally until all earlier segments have arrived and have been validated. If set to
+ *    'direct' mode, the content of each segment is written upon validation into a buffer provided
+ *    by the caller, at an offset given by its segment number, and #onDirectComplete is signaled
+ *    once all segments have been written.
+ *
+ * Received segments are kept as Blocks that share the buffers of the Data packets, and they are
+ * tracked in a window that starts at the first segment not yet received (or not yet delivered, in
+ * 'in order' mode). Hence, 'in order' mode needs memory only for the segments that arrived out of
+ * order, and 'direct' mode does not keep any segment at all, which suits large objects.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
@@ -93,6 +102,8 @@ public:
     NACK_ERROR = 4,
     /// A received FinalBlockId did not contain a segment component
     FINALBLOCKID_NOT_SEGMENT = 5,
+    /// In 'direct' mode, a segment did not fit at its offset in the output buffer
+    SEGMENT_DOES_NOT_FIT = 6,
   };
 
   class Options
@@ -120,6 +131,15 @@ public:
     double mdCoef = 0.5; ///< multiplicative decrease coefficient
     util::RttEstimator::Options rttOptions; ///< options for RTT estimator
     size_t flowControlWindow = 25000; ///< maximum number of segments stored in the reorder buffer
+    /**
+     * @brief Output buffer for 'direct' mode, which is enabled if this is not empty.
+     *
+     * The content of segment N is written at offset `N * directSegmentSize`. The buffer may be
+     * a memory-mapped file, and must remain valid until #onDirectComplete or #onError is signaled.
+     */
+    span<uint8_t> directBuffer;
+    /// in 'direct' mode, size of the content of every segment except the last one
+    size_t directSegmentSize = 0;
   };
 
   /**
@@ -179,6 +199,18 @@ private:
   afterSegmentReceivedCb(const Interest& origInterest, const Data& data,
                          const weak_ptr<SegmentFetcher>& weakSelf);
 
+  bool
+  isSegmentReceived(uint64_t segNum) const;
+
+  void
+  markSegmentReceived(uint64_t segNum);
+
+  void
+  storeSegment(uint64_t segNum, const Data& data);
+
+  bool
+  writeSegment(uint64_t segNum, const Data& data);
+
   void
   afterValidationSuccess(const Data& data, const Interest& origInterest,
                          std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
@@ -272,6 +304,14 @@ public:
    */
   signal::Signal<SegmentFetcher> onInOrderComplete;
 
+  /**
+   * @brief Emitted on successful retrieval of all segments in 'direct' mode.
+   *
+   * Handlers are provided with the size of the object written into the output buffer.
+   * @note Emitted only if SegmentFetcher is operating in 'direct' mode.
+   */
+  signal::Signal<SegmentFetcher, size_t> onDirectComplete;
+
 private:
   enum class SegmentState {
     FirstInterest, ///< the first Interest for this segment has been sent
@@ -313,10 +353,16 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nReceived = 0;
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
+  size_t m_directObjectSize = 0;
 
-  std::map<uint64_t, Buffer> m_segmentBuffer;
+  /// content of received segments not yet delivered, starting at m_nextSegmentInOrder
+  std::deque<Block> m_segmentBuffer;
+  size_t m_nBufferedSegments = 0;
   std::map<uint64_t, PendingSegment> m_pendingSegments;
-  std::set<uint64_t> m_receivedSegments;
+  /// all segments below this number have been received
+  uint64_t m_receivedBase = 0;
+  /// bitmap of received segments, starting at m_receivedBase
+  std::deque<bool> m_receivedSegments;
 };
 
 namespace util {
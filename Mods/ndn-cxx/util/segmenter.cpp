@@ -20,6 +20,9 @@
  */
 
 #include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/impl/parallel-for.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include <boost/iostreams/read.hpp>
 
@@ -32,8 +35,8 @@ Segmenter::Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInf
 }
 
 std::vector<std::shared_ptr<Data>>
-Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
-                   time::milliseconds freshnessPeriod, uint32_t contentType)
+Segmenter::makeSegments(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+                        time::milliseconds freshnessPeriod, uint32_t contentType)
 {
   if (maxSegmentSize == 0) {
     NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
@@ -56,7 +59,6 @@ Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxS
     data->setFinalBlock(finalBlockId);
     data->setContent(buffer.first(segLen));
 
-    m_keyChain.sign(*data, m_signingInfo);
     segments.push_back(std::move(data));
 
     buffer = buffer.subspan(segLen);
@@ -66,6 +68,58 @@ Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxS
   return segments;
 }
 
+std::vector<std::shared_ptr<Data>>
+Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+                   time::milliseconds freshnessPeriod, uint32_t contentType)
+{
+  auto segments = makeSegments(buffer, dataName, maxSegmentSize, freshnessPeriod, contentType);
+  for (const auto& data : segments) {
+    m_keyChain.sign(*data, m_signingInfo);
+  }
+  return segments;
+}
+
+std::vector<std::shared_ptr<Data>>
+Segmenter::segmentParallel(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+                           time::milliseconds freshnessPeriod, size_t nThreads, uint32_t contentType)
+{
+  auto segments = makeSegments(buffer, dataName, maxSegmentSize, freshnessPeriod, contentType);
+  m_keyChain.sign(segments, m_signingInfo, nThreads);
+  return segments;
+}
+
+Segmenter::ManifestedObject
+Segmenter::segmentWithManifest(span<const uint8_t> buffer, const Name& dataName,
+                               const Name& manifestName, size_t maxSegmentSize,
+                               time::milliseconds freshnessPeriod, size_t nThreads,
+                               uint32_t contentType)
+{
+  // ImplicitSha256DigestComponent: TLV-TYPE and TLV-LENGTH of one octet each, 32-octet digest
+  constexpr size_t DIGEST_COMPONENT_SIZE = 2 + util::Sha256::DIGEST_SIZE;
+  const size_t digestsPerSegment = maxSegmentSize / DIGEST_COMPONENT_SIZE;
+  if (digestsPerSegment == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be at least " +
+                                    to_string(DIGEST_COMPONENT_SIZE) + " with a manifest"));
+  }
+
+  ManifestedObject object;
+  object.segments = makeSegments(buffer, dataName, maxSegmentSize, freshnessPeriod, contentType);
+  m_keyChain.sign(object.segments, security::signingWithSha256(), nThreads);
+
+  Buffer digests(object.segments.size() * DIGEST_COMPONENT_SIZE);
+  detail::parallelFor(object.segments.size(), nThreads, [&] (size_t i) {
+    const Block& digest = object.segments[i]->getFullName().at(-1).wireEncode();
+    BOOST_ASSERT(digest.size() == DIGEST_COMPONENT_SIZE);
+    std::copy(digest.begin(), digest.end(), digests.begin() + i * DIGEST_COMPONENT_SIZE);
+  });
+
+  // a manifest segment holds the digests of a whole number of segments
+  object.manifest = makeSegments(digests, manifestName, digestsPerSegment * DIGEST_COMPONENT_SIZE,
+                                 freshnessPeriod, tlv::ContentType_Blob);
+  m_keyChain.sign(object.manifest, m_signingInfo, nThreads);
+  return object;
+}
+
 std::vector<std::shared_ptr<Data>>
 Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentSize,
                    time::milliseconds freshnessPeriod, uint32_t contentType)
@@ -40,6 +40,17 @@ public:
    */
   Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo);
 
+  /**
+   * @brief Segments of an object together with the manifest that authenticates them.
+   */
+  struct ManifestedObject
+  {
+    /// segments of the object, signed with DigestSha256
+    std::vector<std::shared_ptr<Data>> segments;
+    /// segments of the manifest, signed according to the SigningInfo of the Segmenter
+    std::vector<std::shared_ptr<Data>> manifest;
+  };
+
   /**
    * @brief Splits a blob of bytes into one or more Data packets (segments).
    * @param buffer Contiguous range of bytes to divide into segments.
@@ -72,6 +83,56 @@ public:
           time::milliseconds freshnessPeriod,
           uint32_t contentType = tlv::ContentType_Blob);
 
+  /**
+   * @brief Splits a blob of bytes into segments like segment(), signing them on up to
+   *        @p nThreads threads.
+   * @param nThreads Maximum number of threads, including the calling thread.
+   * @sa KeyChain::sign(span<const shared_ptr<Data>>, const SigningInfo&, size_t)
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<Data>>
+  segmentParallel(span<const uint8_t> buffer,
+                  const Name& dataName,
+                  size_t maxSegmentSize,
+                  time::milliseconds freshnessPeriod,
+                  size_t nThreads,
+                  uint32_t contentType = tlv::ContentType_Blob);
+
+  /**
+   * @brief Splits a blob of bytes into segments that are authenticated by a signed manifest.
+   *
+   * Each segment is signed with DigestSha256 only. The manifest is itself a segmented object
+   * named @p manifestName, whose content is the sequence of the implicit digests of the segments
+   * (ImplicitSha256DigestComponent elements) in segment order, and whose segments are signed
+   * according to the SigningInfo of the Segmenter. Hence, one signature is computed for every
+   * `maxSegmentSize / 34` segments of the object, and the digests are computed on up to
+   * @p nThreads threads.
+   *
+   * @param buffer Contiguous range of bytes to divide into segments.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param manifestName Name prefix of the manifest. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param nThreads Maximum number of threads, including the calling thread.
+   * @param contentType The `ContentType` of the segments of the object.
+   * @throw std::invalid_argument @p maxSegmentSize cannot hold a single digest
+   */
+  [[nodiscard]] ManifestedObject
+  segmentWithManifest(span<const uint8_t> buffer,
+                      const Name& dataName,
+                      const Name& manifestName,
+                      size_t maxSegmentSize,
+                      time::milliseconds freshnessPeriod,
+                      size_t nThreads,
+                      uint32_t contentType = tlv::ContentType_Blob);
+
+private:
+  /**
+   * @brief Splits a blob of bytes into unsigned segments.
+   */
+  static std::vector<std::shared_ptr<Data>>
+  makeSegments(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+               time::milliseconds freshnessPeriod, uint32_t contentType);
+
 private:
   KeyChain& m_keyChain;
   security::SigningInfo m_signingInfo;